@@ -0,0 +1,2 @@
+shouldBeTrue("successfullyParsed");
+debug("\nTEST COMPLETE\n");
@@ -0,0 +1,36 @@
+description(
+"The IPD tables read back from the analysis cache place the pc pops where the analysis does, and a cache written by another cache version is discarded. run-ifc-jsc-tests runs this cold, warm and stale."
+);
+
+function ifElse(secret)
+{
+    var inside = 0;
+    if (secret)
+        inside = 1;
+    else
+        inside = 2;
+    var after = 1;
+    return [ifcLabelOf(inside), ifcLabelOf(after)];
+}
+
+function loopWithBreak(bound)
+{
+    var n = 0;
+    for (var i = 0; i < 10; i++) {
+        if (i == bound)
+            break;
+        n++;
+    }
+    var after = 1;
+    return [ifcLabelOf(n), ifcLabelOf(after)];
+}
+
+var ifElseLabels = ifElse(ifcLabel(false, 4));
+var loopLabels = loopWithBreak(ifcLabel(3, 8));
+
+shouldBe("ifElseLabels[0] & 4", "4");
+shouldBe("ifElseLabels[1] & 4", "0");
+shouldBe("loopLabels[0] & 8", "8");
+shouldBe("loopLabels[1] & 8", "0");
+
+var successfullyParsed = true;
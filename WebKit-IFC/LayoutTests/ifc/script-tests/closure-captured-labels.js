@@ -0,0 +1,55 @@
+description(
+"A closure reads and writes a captured variable under a raised pc, after its frame was relabelled in a new epoch; the frame and the closure agree on its label."
+);
+
+// Each runs through Function.prototype.call, in an execution that does not
+// track labels yet, so the ifcLabel() call relabels the frame.
+
+function closureWrite()
+{
+    var captured = 0;
+    var secret = ifcLabel(true, 4);
+    function write() {
+        if (secret)
+            captured = 1;
+    }
+    write();
+    return ifcLabelOf(captured);
+}
+
+function closureRead()
+{
+    var captured = 0;
+    var secret = ifcLabel(true, 8);
+    if (secret)
+        captured = 1;
+    function read() {
+        return captured;
+    }
+    return ifcLabelOf(read());
+}
+
+function closureReadAfterWrite()
+{
+    var captured = 0;
+    var secret = ifcLabel(true, 16);
+    function write() {
+        if (secret)
+            captured = 1;
+    }
+    function read() {
+        return captured;
+    }
+    write();
+    return ifcLabelOf(read());
+}
+
+var writeLabel = closureWrite.call(this);
+var readLabel = closureRead.call(this);
+var readAfterWriteLabel = closureReadAfterWrite.call(this);
+
+shouldBe("writeLabel & 4", "4");
+shouldBe("readLabel & 8", "8");
+shouldBe("readAfterWriteLabel & 16", "16");
+
+var successfullyParsed = true;
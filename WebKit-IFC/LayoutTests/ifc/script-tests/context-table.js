@@ -0,0 +1,96 @@
+description(
+"The compact ContextTable answers the IPD of every branch, call and catch block, and a CodeBlock that switches between the two analysis flavors keeps getting the right one."
+);
+
+function identity(x)
+{
+    return x;
+}
+
+// Calls and straight-line code between the branches, so that most positions
+// are not sites and take the next instruction as their IPD
+function callsInBranches(first, second)
+{
+    var a = 0;
+    var b = 0;
+    var c = identity(1) + identity(2);
+    if (first)
+        a = identity(1);
+    var between = identity(c) + 1;
+    if (second)
+        b = identity(2);
+    else
+        b = identity(3);
+    var after = between + 1;
+    return [ifcLabelOf(a), ifcLabelOf(b), ifcLabelOf(between), ifcLabelOf(after)];
+}
+
+function catchUnderBranch(secret)
+{
+    var caught = 0;
+    if (secret) {
+        try {
+            caught = identity(1);
+            throw 2;
+        } catch (e) {
+            caught = e;
+        }
+    }
+    var after = 1;
+    return [ifcLabelOf(caught), ifcLabelOf(after)];
+}
+
+function branchy(x)
+{
+    var inside = 0;
+    if (x)
+        inside = 1;
+    var after = 1;
+    return [ifcLabelOf(inside), ifcLabelOf(after)];
+}
+
+// Called inside a try block under a raised pc, branchy asks for the flavor
+// that sends exceptional edges to the SEN; called directly, for the other.
+var fromTry = [];
+function callInTry(secret, bit)
+{
+    try {
+        if (secret)
+            fromTry = branchy(ifcLabel(true, bit));
+    } catch (e) {
+    }
+}
+
+var calls = callsInBranches(ifcLabel(true, 4), ifcLabel(true, 8));
+var caught = catchUnderBranch(ifcLabel(true, 16));
+
+var switchesOk = true;
+for (var round = 0; round < 3; round++) {
+    var direct = branchy(ifcLabel(true, 4));
+    if ((direct[0] & 4) != 4 || (direct[1] & 4) != 0)
+        switchesOk = false;
+    callInTry(ifcLabel(true, 32), 8);
+    if ((fromTry[0] & 8) != 8 || (fromTry[1] & 8) != 0)
+        switchesOk = false;
+}
+
+// The same source in two CodeBlocks: each gets a table of its own
+var makeBranchy = "var inside = 0; if (x) inside = 1; var after = 1; return [ifcLabelOf(inside), ifcLabelOf(after)];";
+var first = new Function("x", makeBranchy)(ifcLabel(true, 4));
+var second = new Function("x", makeBranchy)(ifcLabel(true, 16));
+
+shouldBe("calls[0] & 4", "4");
+shouldBe("calls[0] & 8", "0");
+shouldBe("calls[1] & 8", "8");
+shouldBe("calls[1] & 4", "0");
+shouldBe("calls[2] & 4", "0");
+shouldBe("calls[3] & 12", "0");
+shouldBe("caught[0] & 16", "16");
+shouldBe("caught[1] & 16", "0");
+shouldBeTrue("switchesOk");
+shouldBe("first[0] & 4", "4");
+shouldBe("first[1] & 4", "0");
+shouldBe("second[0] & 16", "16");
+shouldBe("second[1] & 16", "0");
+
+var successfullyParsed = true;
@@ -0,0 +1,73 @@
+description(
+"Branches inside try blocks get IPDs that account for the edges to their handlers: a catch reached by a throw under a raised pc runs under it, and the pc drops after the try statement."
+);
+
+function throwInTry(secret)
+{
+    var caught = 0;
+    try {
+        if (secret)
+            throw 1;
+        caught = 2;
+    } catch (e) {
+        caught = e;
+    }
+    var after = 1;
+    return [ifcLabelOf(caught), ifcLabelOf(after)];
+}
+
+function throughFinally(secret)
+{
+    var caught = 0;
+    try {
+        try {
+            if (secret)
+                throw 1;
+        } finally {
+            caught = 2;
+        }
+    } catch (e) {
+        caught = e;
+    }
+    var after = 1;
+    return [ifcLabelOf(caught), ifcLabelOf(after)];
+}
+
+// Several handlers, one inside a loop, so each branch needs the right one
+function manyHandlers(secret)
+{
+    var caught = 0;
+    try {
+        caught = 1;
+    } catch (e) {
+        caught = -1;
+    }
+    for (var i = 0; i < 3; i++) {
+        try {
+            if (i == secret)
+                throw i;
+        } catch (e) {
+            caught = e;
+        }
+    }
+    try {
+        caught++;
+    } catch (e) {
+        caught = -1;
+    }
+    var after = 1;
+    return [ifcLabelOf(caught), ifcLabelOf(after)];
+}
+
+var throwLabels = throwInTry(ifcLabel(true, 4));
+var finallyLabels = throughFinally(ifcLabel(true, 8));
+var handlerLabels = manyHandlers(ifcLabel(1, 16));
+
+shouldBe("throwLabels[0] & 4", "4");
+shouldBe("throwLabels[1] & 4", "0");
+shouldBe("finallyLabels[0] & 8", "8");
+shouldBe("finallyLabels[1] & 8", "0");
+shouldBe("handlerLabels[0] & 16", "16");
+shouldBe("handlerLabels[1] & 16", "0");
+
+var successfullyParsed = true;
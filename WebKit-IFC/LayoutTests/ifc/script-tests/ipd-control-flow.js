@@ -0,0 +1,79 @@
+description(
+"The post-dominator analysis over basic blocks gives every kind of branch the IPD where the pc drops back, and keeps it raised to the end of a function a branch can return early from."
+);
+
+function switchOn(secret)
+{
+    var inside = 0;
+    switch (secret) {
+    case 1:
+        inside = 1;
+        break;
+    case 2:
+        inside = 2;
+    default:
+        inside = 3;
+    }
+    var after = 1;
+    return [ifcLabelOf(inside), ifcLabelOf(after)];
+}
+
+function logical(a, b)
+{
+    var both = a && b;
+    var either = a || b;
+    var after = 1;
+    return [ifcLabelOf(both), ifcLabelOf(either), ifcLabelOf(after)];
+}
+
+function conditional(secret)
+{
+    var chosen = secret ? 1 : 2;
+    var after = 1;
+    return [ifcLabelOf(chosen), ifcLabelOf(after)];
+}
+
+function nestedLoops(bound)
+{
+    var n = 0;
+    for (var i = 0; i < 3; i++) {
+        var j = 0;
+        do {
+            j++;
+            if (j < bound)
+                continue;
+            n++;
+        } while (j < 4);
+    }
+    var after = 1;
+    return [ifcLabelOf(n), ifcLabelOf(after)];
+}
+
+function earlyReturn(secret)
+{
+    var result = [0, 0];
+    if (secret)
+        return result;
+    var after = 1;
+    result[0] = ifcLabelOf(after);
+    return result;
+}
+
+var switchLabels = switchOn(ifcLabel(2, 4));
+var logicalLabels = logical(ifcLabel(true, 4), ifcLabel(false, 8));
+var conditionalLabels = conditional(ifcLabel(true, 4));
+var loopLabels = nestedLoops(ifcLabel(2, 8));
+var returnLabels = earlyReturn(ifcLabel(false, 16));
+
+shouldBe("switchLabels[0] & 4", "4");
+shouldBe("switchLabels[1] & 4", "0");
+shouldBe("logicalLabels[0] & 12", "12");
+shouldBe("logicalLabels[1] & 4", "4");
+shouldBe("logicalLabels[2] & 12", "0");
+shouldBe("conditionalLabels[0] & 4", "4");
+shouldBe("conditionalLabels[1] & 4", "0");
+shouldBe("loopLabels[0] & 8", "8");
+shouldBe("loopLabels[1] & 8", "0");
+shouldBe("returnLabels[0] & 16", "16");
+
+var successfullyParsed = true;
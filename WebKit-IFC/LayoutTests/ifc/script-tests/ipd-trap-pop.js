@@ -0,0 +1,74 @@
+description(
+"The pc a branch raises is popped by the trap at the branch's immediate post-dominator, including for nested branches, loops and recursion."
+);
+
+function afterBranch(secret)
+{
+    var inside = 0;
+    if (secret)
+        inside = 1;
+    var after = 2;
+    return [ifcLabelOf(inside), ifcLabelOf(after)];
+}
+
+function nested(outer, inner)
+{
+    var both = 0;
+    var outerOnly = 0;
+    if (outer) {
+        if (inner)
+            both = 1;
+        outerOnly = 1;
+    }
+    var after = 1;
+    return [ifcLabelOf(both), ifcLabelOf(outerOnly), ifcLabelOf(after)];
+}
+
+function loop(bound)
+{
+    var n = 0;
+    while (n < bound)
+        n++;
+    var after = 1;
+    return [ifcLabelOf(n), ifcLabelOf(after)];
+}
+
+// Each frame running recurse waits at the same IPD; its trap pops only the
+// context pushed in that frame.
+function recurse(secret, depth)
+{
+    var inside = 0;
+    if (secret) {
+        if (depth)
+            recurse(secret, depth - 1);
+        inside = 1;
+    }
+    var after = 1;
+    return [ifcLabelOf(inside), ifcLabelOf(after)];
+}
+
+var four = ifcLabel(true, 4);
+var eight = ifcLabel(true, 8);
+var bound = ifcLabel(3, 16);
+
+resetIFCStats();
+var branchLabels = afterBranch(four);
+var nestedLabels = nested(four, eight);
+var loopLabels = loop(bound);
+var recurseLabels = recurse(four, 3);
+var pushes = ifcCounter("push");
+var pops = ifcCounter("pop");
+
+shouldBe("branchLabels[0] & 4", "4");
+shouldBe("branchLabels[1] & 4", "0");
+shouldBe("nestedLabels[0] & 12", "12");
+shouldBe("nestedLabels[1] & 12", "4");
+shouldBe("nestedLabels[2] & 12", "0");
+shouldBe("loopLabels[0] & 16", "16");
+shouldBe("loopLabels[1] & 16", "0");
+shouldBe("recurseLabels[0] & 4", "4");
+shouldBe("recurseLabels[1] & 4", "0");
+shouldBeTrue("pushes > 0");
+shouldBe("pops", "pushes");
+
+var successfullyParsed = true;
@@ -0,0 +1,30 @@
+description(
+"When the frame label epoch wraps, live frames keep the labels of their registers, and registers written after the wrap read as written."
+);
+
+function relabelInCallback()
+{
+    // A callback runs in an execution of its own, which relabels its frame
+    // in a new epoch once ifcLabel() makes it track labels.
+    [0].forEach(function () { ifcLabel(0, 8); });
+}
+
+function wrapAround()
+{
+    var kept = ifcLabel(1, 4);
+    var plain = 0;
+    ifcAdvanceLabelEpoch(0xfffffffe);
+    for (var i = 0; i < 4; i++)
+        relabelInCallback();
+    var written = ifcLabel(2, 16);
+    return [ifcLabelOf(kept), ifcLabelOf(plain), ifcLabelOf(written)];
+}
+
+var labels = wrapAround.call(this);
+
+shouldBe("labels[0] & 4", "4");
+shouldBe("labels[1] & 4", "0");
+shouldBe("labels[2] & 16", "16");
+shouldBe("labels[2] & 4", "0");
+
+var successfullyParsed = true;
@@ -0,0 +1,35 @@
+description(
+"Moves the analysis finds label-free skip their labels under a raised pc, and what they copy still carries the pc label once it drops."
+);
+
+// Entered under the caller's raised pc: every register here carries it,
+// so the moves in the loop take the unlabelled path.
+function copies(n)
+{
+    var a = n;
+    var b = a;
+    for (var i = 0; i < 3; i++) {
+        b = a;
+        a = b;
+    }
+    return b;
+}
+
+function copyUnderRaisedPc(secret)
+{
+    var result = 0;
+    if (secret)
+        result = copies(1);
+    return result;
+}
+
+var secret = ifcLabel(true, 4);
+resetIFCStats();
+var copied = copyUnderRaisedPc(secret);
+var labelFree = ifcCounter("lblFree");
+
+shouldBe("copied", "1");
+shouldBe("ifcLabelOf(copied) & 4", "4");
+shouldBeTrue("labelFree > 0");
+
+var successfullyParsed = true;
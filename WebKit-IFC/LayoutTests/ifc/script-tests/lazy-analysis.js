@@ -0,0 +1,42 @@
+description(
+"The IPD analysis runs when a CodeBlock first branches on a labelled value, however long it ran without labels before, and for whichever flavor the latest entry asked for."
+);
+
+function branchy(x)
+{
+    var inside = 0;
+    if (x)
+        inside = 1;
+    var after = 1;
+    return [ifcLabelOf(inside), ifcLabelOf(after)];
+}
+
+// Warm up without labels: no branch needs an IPD yet
+for (var i = 0; i < 1000; i++)
+    branchy(i & 1);
+
+var direct = branchy(ifcLabel(true, 4));
+
+// Called inside a try block under a raised pc, so the entry asks for the
+// flavor that sends exceptional edges to the SEN
+var fromTry = [];
+function callInTry(secret)
+{
+    try {
+        if (secret)
+            fromTry = branchy(ifcLabel(true, 8));
+    } catch (e) {
+    }
+}
+callInTry(ifcLabel(true, 32));
+
+var directAgain = branchy(ifcLabel(true, 16));
+
+shouldBe("direct[0] & 4", "4");
+shouldBe("direct[1] & 4", "0");
+shouldBe("fromTry[0] & 8", "8");
+shouldBe("fromTry[1] & 8", "0");
+shouldBe("directAgain[0] & 16", "16");
+shouldBe("directAgain[1] & 16", "0");
+
+var successfullyParsed = true;
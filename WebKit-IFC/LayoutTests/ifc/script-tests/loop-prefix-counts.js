@@ -0,0 +1,84 @@
+description(
+"With --ifcCheckLoops=true, jsc checks the containsLoop bit of each branch, taken from prefix counts of loop opcodes, against a scan of the branch's range, and crashes if they differ. Nested loops and labelled break and continue give branches whose ranges hold loops, start inside them, or jump out of several."
+);
+
+// No early exits, so the merge regions give the IPDs
+function nestedLoops(secret)
+{
+    var count = 0;
+    if (secret) {
+        for (var i = 0; i < 3; i++) {
+            for (var j = 0; j < 3; j++)
+                count++;
+        }
+    }
+    var k = 0;
+    while (k < 2) {
+        if (secret)
+            count++;
+        k++;
+    }
+    var after = 1;
+    return [ifcLabelOf(count), ifcLabelOf(after)];
+}
+
+function labelledBreak(secret)
+{
+    var count = 0;
+    outer: for (var i = 0; i < 3; i++) {
+        for (var j = 0; j < 3; j++) {
+            if (secret && j == 1)
+                break outer;
+            count++;
+        }
+    }
+    var after = 1;
+    return [ifcLabelOf(count), ifcLabelOf(after)];
+}
+
+function labelledContinue(secret)
+{
+    var count = 0;
+    outer: for (var i = 0; i < 3; i++) {
+        var j = 0;
+        do {
+            j++;
+            if (secret)
+                continue outer;
+            count++;
+        } while (j < 3);
+    }
+    var after = 1;
+    return [ifcLabelOf(count), ifcLabelOf(after)];
+}
+
+// A branch after the loops, whose range holds none
+function loopsThenBranch(secret)
+{
+    var count = 0;
+    for (var i = 0; i < 2; i++) {
+        for (var j = 0; j < 2; j++)
+            count++;
+    }
+    var inside = 0;
+    if (secret)
+        inside = 1;
+    var after = 1;
+    return [ifcLabelOf(inside), ifcLabelOf(after)];
+}
+
+var nestedLabels = nestedLoops(ifcLabel(true, 4));
+var breakLabels = labelledBreak(ifcLabel(true, 8));
+var continueLabels = labelledContinue(ifcLabel(true, 16));
+var afterLoopsLabels = loopsThenBranch(ifcLabel(true, 32));
+
+shouldBe("nestedLabels[0] & 4", "4");
+shouldBe("nestedLabels[1] & 4", "0");
+shouldBe("breakLabels[0] & 8", "8");
+shouldBe("breakLabels[1] & 8", "0");
+shouldBe("continueLabels[0] & 16", "16");
+shouldBe("continueLabels[1] & 16", "0");
+shouldBe("afterLoopsLabels[0] & 32", "32");
+shouldBe("afterLoopsLabels[1] & 32", "0");
+
+var successfullyParsed = true;
@@ -0,0 +1,98 @@
+description(
+"Branches inside the merge regions the bytecode generator records drop the pc at the end of the region; a break or continue that leaves a region early falls back to the full analysis, which still drops it."
+);
+
+function identity(x)
+{
+    return x;
+}
+
+function ifElse(secret)
+{
+    var inside = 0;
+    if (secret)
+        inside = 1;
+    else
+        inside = 2;
+    var after = 1;
+    return [ifcLabelOf(inside), ifcLabelOf(after)];
+}
+
+function operators(secret)
+{
+    var chosen = secret ? 1 : 2;
+    var both = secret && 1;
+    var either = secret || 1;
+    var after = 1;
+    return [ifcLabelOf(chosen), ifcLabelOf(both), ifcLabelOf(either), ifcLabelOf(after)];
+}
+
+function ifInLoops(secret)
+{
+    var count = 0;
+    for (var i = 0; i < 3; i++) {
+        if (secret)
+            count++;
+    }
+    var j = 0;
+    do {
+        if (secret)
+            count++;
+        j++;
+    } while (j < 2);
+    for (var p in { a: 1, b: 2 }) {
+        if (secret)
+            count++;
+    }
+    var after = 1;
+    return [ifcLabelOf(count), ifcLabelOf(after)];
+}
+
+// f.call() branches on whether call is the builtin one
+function callDotCall(f)
+{
+    var result = f.call(null, 1);
+    var after = 1;
+    return [ifcLabelOf(result), ifcLabelOf(after)];
+}
+
+// The break and continue leave the if early, so these take the fallback
+function leaveEarly(secret)
+{
+    var count = 0;
+    for (var i = 0; i < 3; i++) {
+        if (secret)
+            break;
+        count++;
+    }
+    var j = 0;
+    while (j < 3) {
+        j++;
+        if (secret)
+            continue;
+        count++;
+    }
+    var after = 1;
+    return [ifcLabelOf(count), ifcLabelOf(after)];
+}
+
+var ifElseLabels = ifElse(ifcLabel(true, 4));
+var operatorLabels = operators(ifcLabel(true, 8));
+var loopLabels = ifInLoops(ifcLabel(true, 16));
+var callLabels = callDotCall(ifcLabel(identity, 32));
+var earlyLabels = leaveEarly(ifcLabel(true, 4));
+
+shouldBe("ifElseLabels[0] & 4", "4");
+shouldBe("ifElseLabels[1] & 4", "0");
+shouldBe("operatorLabels[0] & 8", "8");
+shouldBe("operatorLabels[1] & 8", "8");
+shouldBe("operatorLabels[2] & 8", "8");
+shouldBe("operatorLabels[3] & 8", "0");
+shouldBe("loopLabels[0] & 16", "16");
+shouldBe("loopLabels[1] & 16", "0");
+shouldBe("callLabels[0] & 32", "32");
+shouldBe("callLabels[1] & 32", "0");
+shouldBe("earlyLabels[0] & 4", "4");
+shouldBe("earlyLabels[1] & 4", "0");
+
+var successfullyParsed = true;
@@ -0,0 +1,44 @@
+description(
+"Run with --ifcCheckPostDominators=true, which runs every post-dominator engine and crashes if one disagrees with Lengauer-Tarjan. Deep nesting must not exhaust the native stack."
+);
+
+// The exception handler makes the branches take the full CFG and
+// dominator analysis rather than the generator's merge regions.
+function buildNested(depth)
+{
+    var body = "var inside = 0;\ntry {\n";
+    for (var i = 0; i < depth; i++)
+        body += "if (s) {\n";
+    body += "inside = 1;\n";
+    for (var i = 0; i < depth; i++)
+        body += "}\n";
+    body += "} catch (e) {\n}\nvar after = 1;\nreturn [ifcLabelOf(inside), ifcLabelOf(after)];\n";
+    return new Function("s", body);
+}
+
+// Breaks and continues that leave several loops at once
+function tangled(bound)
+{
+    var n = 0;
+    outer: for (var i = 0; i < 4; i++) {
+        for (var j = 0; j < 4; j++) {
+            if (j == bound)
+                continue outer;
+            if (i == bound)
+                break outer;
+            n++;
+        }
+    }
+    var after = 1;
+    return [ifcLabelOf(n), ifcLabelOf(after)];
+}
+
+var nestedLabels = buildNested(500)(ifcLabel(true, 4));
+var tangledLabels = tangled(ifcLabel(2, 8));
+
+shouldBe("nestedLabels[0] & 4", "4");
+shouldBe("nestedLabels[1] & 4", "0");
+shouldBe("tangledLabels[0] & 8", "8");
+shouldBe("tangledLabels[1] & 8", "0");
+
+var successfullyParsed = true;
@@ -0,0 +1,30 @@
+description(
+"ifcCounter() sums an IFC counter over every CodeBlock; a branch on a labelled value pushes the pc and the IPD pops it."
+);
+
+function branchOn(x)
+{
+    var y = 0;
+    if (x)
+        y = 1;
+    return y;
+}
+
+resetIFCStats();
+var pushesBefore = ifcCounter("push");
+var popsBefore = ifcCounter("pop");
+var secret = ifcLabel(true, 4);
+var result = branchOn(secret);
+var pushes = ifcCounter("push") - pushesBefore;
+var pops = ifcCounter("pop") - popsBefore;
+
+shouldBe("result", "1");
+shouldBeTrue("pushes > 0");
+shouldBe("pops", "pushes");
+shouldBeTrue("ifcCounter('hostCall') > 0");
+shouldBeTrue("ifcCounter('nsuFail') > 0");
+resetIFCStats();
+shouldBe("ifcCounter('nsuFail')", "0");
+shouldThrow("ifcCounter('noSuchCounter')");
+
+var successfullyParsed = true;
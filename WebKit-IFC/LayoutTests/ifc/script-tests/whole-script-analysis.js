@@ -0,0 +1,87 @@
+description(
+"With whole-script analysis on, the functions a script declares are compiled and analysed as it loads; whichever worker or caller finishes the analysis, branches in referenced, unreferenced, redeclared and nested functions drop the pc at their IPDs."
+);
+
+// Called before its declaration is reached
+var early = hoisted(ifcLabel(true, 4));
+
+function hoisted(secret)
+{
+    var inside = 0;
+    if (secret)
+        inside = 1;
+    var after = 1;
+    return [ifcLabelOf(inside), ifcLabelOf(after)];
+}
+
+// Only reached through referenced(), so found breadth first
+function referenced(secret)
+{
+    return helper(secret);
+}
+
+function helper(secret)
+{
+    var inside = 0;
+    while (secret) {
+        inside = 1;
+        secret = false;
+    }
+    var after = 1;
+    return [ifcLabelOf(inside), ifcLabelOf(after)];
+}
+
+// Not named anywhere in the top-level code
+function unreferenced(secret)
+{
+    var inside = secret ? 1 : 2;
+    var after = 1;
+    return [ifcLabelOf(inside), ifcLabelOf(after)];
+}
+
+// The second declaration is the one that runs
+function redeclared(secret)
+{
+    return [0, 0];
+}
+
+function redeclared(secret)
+{
+    var inside = 0;
+    if (secret)
+        inside = 1;
+    var after = 1;
+    return [ifcLabelOf(inside), ifcLabelOf(after)];
+}
+
+// The nested function is only generated, and queued, when outer runs
+function outer(secret)
+{
+    function nested(x)
+    {
+        var inside = 0;
+        if (x)
+            inside = 1;
+        var after = 1;
+        return [ifcLabelOf(inside), ifcLabelOf(after)];
+    }
+    return nested(secret);
+}
+
+var viaHelper = referenced(ifcLabel(true, 8));
+var unnamed = eval("unref" + "erenced")(ifcLabel(true, 16));
+var second = redeclared(ifcLabel(true, 32));
+var nestedLabels = outer(ifcLabel(true, 4));
+
+shouldBe("early[0] & 4", "4");
+shouldBe("early[1] & 4", "0");
+shouldBe("viaHelper[0] & 8", "8");
+shouldBe("viaHelper[1] & 8", "0");
+shouldBe("unnamed[0] & 16", "16");
+shouldBe("unnamed[1] & 16", "0");
+shouldBe("second[0] & 32", "32");
+shouldBe("second[1] & 32", "0");
+shouldBe("nestedLabels[0] & 4", "4");
+shouldBe("nestedLabels[1] & 4", "0");
+
+var successfullyParsed = true;
@@ -0,0 +1,28 @@
+// Inserts count inline scripts, each a block of top-level code with the
+// given number of conditionals and loops, the shape of a large library's
+// initialization. Every script is analysed before its first labelled branch.
+function loadScripts(count, branches)
+{
+    for (var i = 0; i < count; i++) {
+        var lines = ["var lib" + i + " = {};", "var seed" + i + " = " + i + ";"];
+        for (var j = 0; j < branches; j++) {
+            lines.push("if ((seed" + i + " + " + j + ") & 1) lib" + i + ".f" + j + " = " + j + "; else lib" + i + ".f" + j + " = -" + j + ";");
+            if (j % 10 == 0)
+                lines.push("for (var k" + j + " = 0; k" + j + " < 3; k" + j + "++) seed" + i + " ^= k" + j + ";");
+        }
+        var script = document.createElement("script");
+        script.text = lines.join("\n");
+        document.head.appendChild(script);
+    }
+}
+
+function reportFirstHandler(output)
+{
+    var now = Date.now();
+    var start = window.performance ? window.performance.timing.navigationStart : 0;
+    if (!start) {
+        output.textContent += "window.performance.timing is not available\n";
+        return;
+    }
+    output.textContent += "first event handler after " + (now - start) + " ms\n";
+}
@@ -0,0 +1,39 @@
+// Synthetic page with N script origins. Each origin labels one value; the
+// loop then joins values from many origins, which exercises both the inline
+// label word and the spilled origin sets.
+function labelledValues(count)
+{
+    var values = [];
+    for (var i = 0; i < count; i++) {
+        var value = { id: i };
+        value.setLabel("http://origin" + i + ".example.test/");
+        values.push(value);
+    }
+    return values;
+}
+
+function timeJoins(values, iterations)
+{
+    var start = Date.now();
+    var acc = 0;
+    for (var n = 0; n < iterations; n++) {
+        var a = values[n % values.length];
+        var b = values[(n * 7 + 3) % values.length];
+        acc = acc + a.id + b.id;
+        if (a.id < b.id)
+            acc++;
+    }
+    return Date.now() - start;
+}
+
+function runOriginScaling(counts, output)
+{
+    var iterations = 200000;
+    for (var i = 0; i < counts.length; i++) {
+        var setupStart = Date.now();
+        var values = labelledValues(counts[i]);
+        var setup = Date.now() - setupStart;
+        var ms = timeJoins(values, iterations);
+        output.textContent += counts[i] + " origins: setup " + setup + " ms, " + iterations + " joins " + ms + " ms\n";
+    }
+}
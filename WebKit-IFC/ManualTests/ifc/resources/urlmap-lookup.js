@@ -0,0 +1,28 @@
+function timeLookups(urls, iterations)
+{
+    var value = {};
+    var start = Date.now();
+    for (var n = 0; n < iterations; n++)
+        value.setLabel(urls[n % urls.length]);
+    var ms = Math.max(Date.now() - start, 1);
+    return Math.round(iterations * 1000 / ms);
+}
+
+function runURLMapLookups(output)
+{
+    var iterations = 100000;
+    var origins = [];
+    for (var i = 0; i < 8; i++)
+        origins.push("http://origin" + i + ".example.test/script.js");
+    var paths = [];
+    for (var i = 0; i < 64; i++)
+        paths.push("http://cdn.example.test/lib/" + i + ".js?v=" + i);
+
+    var cases = [
+        ["repeated url", ["http://cdn.example.test/lib/jquery.js"]],
+        ["8 origins", origins],
+        ["64 paths, 1 origin", paths]
+    ];
+    for (var i = 0; i < cases.length; i++)
+        output.textContent += cases[i][0] + ": " + timeLookups(cases[i][1], iterations) + " lookups/s\n";
+}
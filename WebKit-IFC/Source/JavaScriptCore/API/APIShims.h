@@ -28,6 +28,7 @@
 
 #include "CallFrame.h"
 #include "GCActivityCallback.h"
+#include "IFCContext.h"
 #include "IncrementalSweeper.h"
 #include "JSLock.h"
 #include <wtf/WTFThreadData.h>
@@ -43,6 +44,7 @@ protected:
         : m_shouldRefGlobalData(shouldRefGlobalData)
         , m_globalData(globalData)
         , m_entryIdentifierTable(wtfThreadData().setCurrentIdentifierTable(globalData->identifierTable))
+        , m_entryIFCContext(wtfThreadData().setCurrentIFCContext(globalData->ifcContext))
     {
         if (shouldRefGlobalData)
             m_globalData->ref();
@@ -56,6 +58,7 @@ protected:
     ~APIEntryShimWithoutLock()
     {
         wtfThreadData().setCurrentIdentifierTable(m_entryIdentifierTable);
+        wtfThreadData().setCurrentIFCContext(m_entryIFCContext);
         if (m_shouldRefGlobalData)
             m_globalData->deref();
     }
@@ -64,6 +67,7 @@ protected:
     RefGlobalDataTag m_shouldRefGlobalData;
     JSGlobalData* m_globalData;
     IdentifierTable* m_entryIdentifierTable;
+    IFCContext* m_entryIFCContext;
 };
 
 class APIEntryShim : public APIEntryShimWithoutLock {
@@ -111,11 +115,13 @@ public:
         , m_globalData(&exec->globalData())
     {
         wtfThreadData().resetCurrentIdentifierTable();
+        wtfThreadData().setCurrentIFCContext(&IFCContext::threadDefault());
     }
 
     ~APICallbackShim()
     {
         wtfThreadData().setCurrentIdentifierTable(m_globalData->identifierTable);
+        wtfThreadData().setCurrentIFCContext(m_globalData->ifcContext);
     }
 
 private:
@@ -0,0 +1,432 @@
+/*
+ *  AnalysisCache.cpp
+ *  JavaScriptCore
+ *
+ */
+
+#include "config.h"
+#include "AnalysisCache.h"
+
+#include "CodeBlock.h"
+#include "Executable.h"
+#include "Instruction.h"
+#include "Interpreter.h"
+#include "Options.h"
+#include "SourceCode.h"
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <wtf/SHA1.h>
+#include <wtf/Threading.h>
+
+namespace JSC {
+
+    namespace {
+
+        // Bump when the bytecode or the analysis changes what a key maps to.
+        const uint32_t cacheVersion = 2;
+        const size_t keySize = 20;
+        const size_t capacityPerSlot = 1024;
+        const uint32_t minimumSlots = 256;
+        const size_t pageAlignment = 4096;
+
+        struct FileHeader {
+            char magic[8];
+            uint32_t version;
+            uint32_t slotCount;     // power of two
+            uint64_t capacity;      // size of the file
+            uint64_t dataStart;
+            uint64_t used;          // end of the data written so far
+            uint64_t clock;         // LRU clock, advanced by every hit and store
+            uint32_t entries;
+            uint32_t padding;
+        };
+
+        // An entry is int32 idom[count], then bool loop[count] and bool
+        // containsLoop[count], padded to 8 bytes.
+        struct Slot {
+            uint8_t key[keySize];
+            uint32_t count;         // 0 while the slot is empty
+            uint64_t offset;
+            uint64_t lastUse;
+        };
+
+        COMPILE_ASSERT(sizeof(bool) == 1, AnalysisCache_bool_tables_are_byte_arrays);
+        COMPILE_ASSERT(sizeof(int) == sizeof(int32_t), AnalysisCache_idom_is_int32);
+        COMPILE_ASSERT(numOpcodeIDs <= 256, AnalysisCache_opcode_ids_fit_in_a_byte);
+
+        size_t entrySize(uint32_t count)
+        {
+            return (static_cast<size_t>(count) * (sizeof(int32_t) + 2) + 7) & ~static_cast<size_t>(7);
+        }
+
+        int compareLastUse(const void* left, const void* right)
+        {
+            uint64_t leftUse = (*static_cast<Slot* const*>(left))->lastUse;
+            uint64_t rightUse = (*static_cast<Slot* const*>(right))->lastUse;
+            return (leftUse < rightUse) ? 1 : (leftUse > rightUse) ? -1 : 0;
+        }
+
+        class CacheState {
+        public:
+            CacheState()
+                : m_path(getenv("JSC_IFC_ANALYSIS_CACHE"))
+                , m_fd(-1)
+                , m_mapping(0)
+                , m_mappedSize(0)
+                , m_failed(!m_path || !*m_path)
+            {
+            }
+
+            bool isEnabled() const { return !m_failed; }
+
+            // The interpreter arms a trap by writing the instruction at an
+            // IPD, so a damaged or foreign file must not get one out of range.
+            static bool validIPDs(const char* data, int count)
+            {
+                const int32_t* idom = reinterpret_cast<const int32_t*>(data);
+                for (int i = 0; i < count; i++) {
+                    if (idom[i] < 0 || idom[i] >= count)
+                        return false;
+                }
+                return true;
+            }
+
+            bool lookup(const AnalysisCache::Key& key, int count, AnalysisCache::Tables& tables)
+            {
+                MutexLocker locker(m_lock);
+                if (!lockCurrent(LOCK_SH))
+                    return false;
+                bool found = false;
+                Slot* slot = probe(header(), key.data());
+                if (slot->count && slot->count == static_cast<uint32_t>(count) && contains(slot)
+                    && validIPDs(static_cast<const char*>(m_mapping) + slot->offset, count)) {
+                    const char* data = static_cast<const char*>(m_mapping) + slot->offset;
+                    tables.count = count;
+                    tables.idom = reinterpret_cast<const int*>(data);
+                    tables.loop = reinterpret_cast<const bool*>(data + count * sizeof(int32_t));
+                    tables.containsLoop = tables.loop + count;
+                    // Racy under a shared lock, which only makes the LRU order approximate.
+                    slot->lastUse = ++header()->clock;
+                    found = true;
+                }
+                flock(m_fd, LOCK_UN);
+                return found;
+            }
+
+            void store(const AnalysisCache::Key& key, const AnalysisCache::Tables& tables)
+            {
+                MutexLocker locker(m_lock);
+                if (!lockCurrent(LOCK_EX))
+                    return;
+                uint32_t count = tables.count;
+                size_t size = entrySize(count);
+                if (!hasRoom(header(), size) && (!compact() || !hasRoom(header(), size))) {
+                    flock(m_fd, LOCK_UN);
+                    return;
+                }
+
+                FileHeader* fileHeader = header();
+                Slot* slot = probe(fileHeader, key.data());
+                if (!slot->count) {
+                    char* data = static_cast<char*>(m_mapping) + fileHeader->used;
+                    memcpy(data, tables.idom, count * sizeof(int32_t));
+                    memcpy(data + count * sizeof(int32_t), tables.loop, count);
+                    memcpy(data + count * sizeof(int32_t) + count, tables.containsLoop, count);
+                    memcpy(slot->key, key.data(), keySize);
+                    slot->offset = fileHeader->used;
+                    slot->lastUse = ++fileHeader->clock;
+                    slot->count = count;
+                    fileHeader->used += size;
+                    fileHeader->entries++;
+                }
+                flock(m_fd, LOCK_UN);
+            }
+
+        private:
+            FileHeader* header() { return static_cast<FileHeader*>(m_mapping); }
+
+            Slot* slots(FileHeader* fileHeader)
+            {
+                return reinterpret_cast<Slot*>(reinterpret_cast<char*>(fileHeader) + sizeof(FileHeader));
+            }
+
+            // The slot holding key, or the empty slot where it would go. The
+            // table is kept at most three quarters full.
+            Slot* probe(FileHeader* fileHeader, const uint8_t* key)
+            {
+                uint32_t mask = fileHeader->slotCount - 1;
+                uint32_t index;
+                memcpy(&index, key, sizeof(index));
+                Slot* table = slots(fileHeader);
+                for (index &= mask; ; index = (index + 1) & mask) {
+                    Slot* slot = &table[index];
+                    if (!slot->count || !memcmp(slot->key, key, keySize))
+                        return slot;
+                }
+            }
+
+            bool contains(Slot* slot)
+            {
+                FileHeader* fileHeader = header();
+                return slot->offset >= fileHeader->dataStart && slot->offset + entrySize(slot->count) <= fileHeader->used;
+            }
+
+            bool hasRoom(FileHeader* fileHeader, size_t size)
+            {
+                return fileHeader->used + size <= fileHeader->capacity
+                    && (fileHeader->entries + 1) * 4 <= fileHeader->slotCount * 3;
+            }
+
+            static bool isValid(const void* mapping, size_t size)
+            {
+                const FileHeader* fileHeader = static_cast<const FileHeader*>(mapping);
+                return size >= sizeof(FileHeader)
+                    && !memcmp(fileHeader->magic, "IFCCACHE", 8)
+                    && fileHeader->version == cacheVersion
+                    && fileHeader->capacity == size
+                    && fileHeader->slotCount >= minimumSlots
+                    && !(fileHeader->slotCount & (fileHeader->slotCount - 1))
+                    && fileHeader->dataStart >= sizeof(FileHeader) + fileHeader->slotCount * sizeof(Slot)
+                    && fileHeader->used >= fileHeader->dataStart
+                    && fileHeader->used <= fileHeader->capacity;
+            }
+
+            // Locks the file currently at m_path, reopening it if another
+            // process has replaced it since we mapped ours.
+            bool lockCurrent(int operation)
+            {
+                for (unsigned attempt = 0; attempt < 4 && !m_failed; attempt++) {
+                    if (m_fd < 0 && !openFile())
+                        return false;
+                    if (flock(m_fd, operation)) {
+                        disable("cannot lock");
+                        return false;
+                    }
+                    struct stat current;
+                    struct stat mapped;
+                    if (!stat(m_path, &current) && !fstat(m_fd, &mapped)
+                        && current.st_dev == mapped.st_dev && current.st_ino == mapped.st_ino)
+                        return true;
+                    flock(m_fd, LOCK_UN);
+                    retire();
+                }
+                return false;
+            }
+
+            bool openFile()
+            {
+                int fd = open(m_path, O_RDWR | O_CREAT, 0644);
+                if (fd < 0) {
+                    disable("cannot open");
+                    return false;
+                }
+                struct stat status;
+                void* mapping = MAP_FAILED;
+                if (!fstat(fd, &status) && status.st_size >= static_cast<off_t>(sizeof(FileHeader)))
+                    mapping = mmap(0, status.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                if (mapping != MAP_FAILED && isValid(mapping, status.st_size)) {
+                    m_fd = fd;
+                    m_mapping = mapping;
+                    m_mappedSize = status.st_size;
+                    return true;
+                }
+                // Empty, from another version or damaged: replace it rather
+                // than rewrite a file other processes may have mapped.
+                if (mapping != MAP_FAILED)
+                    munmap(mapping, status.st_size);
+                close(fd);
+                Vector<Slot*> none;
+                if (!createFile(none))
+                    return false;
+                flock(m_fd, LOCK_UN);
+                return true;
+            }
+
+            // Writes a new file holding as many of survivors, most recently
+            // used first, as fit in half of it, renames it over m_path and
+            // switches to it. Returns with the new file locked exclusively.
+            bool createFile(Vector<Slot*>& survivors)
+            {
+                uint64_t capacity = static_cast<uint64_t>(Options::ifcAnalysisCacheSize() ? Options::ifcAnalysisCacheSize() : 1) << 20;
+                uint32_t slotCount = minimumSlots;
+                while (slotCount < capacity / capacityPerSlot)
+                    slotCount <<= 1;
+                uint64_t dataStart = (sizeof(FileHeader) + slotCount * sizeof(Slot) + pageAlignment - 1) & ~static_cast<uint64_t>(pageAlignment - 1);
+                if (capacity < 2 * dataStart)
+                    capacity = 2 * dataStart;
+
+                char temporaryPath[PATH_MAX];
+                snprintf(temporaryPath, sizeof(temporaryPath), "%s.%d", m_path, static_cast<int>(getpid()));
+                int fd = open(temporaryPath, O_RDWR | O_CREAT | O_TRUNC, 0644);
+                if (fd < 0) {
+                    disable("cannot create");
+                    return false;
+                }
+                void* mapping = MAP_FAILED;
+                if (!ftruncate(fd, capacity))
+                    mapping = mmap(0, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                if (mapping == MAP_FAILED) {
+                    close(fd);
+                    unlink(temporaryPath);
+                    disable("cannot map");
+                    return false;
+                }
+                // Nobody else can see the file yet, so this cannot block.
+                flock(fd, LOCK_EX);
+
+                FileHeader* fileHeader = static_cast<FileHeader*>(mapping);
+                memcpy(fileHeader->magic, "IFCCACHE", 8);
+                fileHeader->version = cacheVersion;
+                fileHeader->slotCount = slotCount;
+                fileHeader->capacity = capacity;
+                fileHeader->dataStart = dataStart;
+                fileHeader->used = dataStart;
+                fileHeader->clock = 0;
+                fileHeader->entries = 0;
+
+                uint64_t budget = dataStart + (capacity - dataStart) / 2;
+                for (size_t i = 0; i < survivors.size() && fileHeader->entries * 2 < slotCount; i++) {
+                    Slot* old = survivors[i];
+                    size_t size = entrySize(old->count);
+                    if (fileHeader->used + size > budget)
+                        break;
+                    Slot* slot = probe(fileHeader, old->key);
+                    memcpy(static_cast<char*>(mapping) + fileHeader->used, static_cast<char*>(m_mapping) + old->offset, size);
+                    memcpy(slot->key, old->key, keySize);
+                    slot->offset = fileHeader->used;
+                    slot->lastUse = survivors.size() - i;
+                    slot->count = old->count;
+                    fileHeader->used += size;
+                    fileHeader->entries++;
+                }
+                fileHeader->clock = survivors.size() + 1;
+
+                if (rename(temporaryPath, m_path)) {
+                    munmap(mapping, capacity);
+                    close(fd);
+                    unlink(temporaryPath);
+                    disable("cannot replace");
+                    return false;
+                }
+                if (m_fd >= 0) {
+                    flock(m_fd, LOCK_UN);
+                    retire();
+                }
+                m_fd = fd;
+                m_mapping = mapping;
+                m_mappedSize = capacity;
+                return true;
+            }
+
+            // NOTE: caller holds the exclusive lock
+            bool compact()
+            {
+                FileHeader* fileHeader = header();
+                Slot* table = slots(fileHeader);
+                Vector<Slot*> live;
+                for (uint32_t i = 0; i < fileHeader->slotCount; i++) {
+                    if (table[i].count && contains(&table[i]))
+                        live.append(&table[i]);
+                }
+                qsort(live.begin(), live.size(), sizeof(Slot*), compareLastUse);
+                return createFile(live);
+            }
+
+            // Views handed out by lookup() may point into the mapping, so it
+            // stays for the life of the process.
+            void retire()
+            {
+                if (m_mapping)
+                    m_retired.append(m_mapping);
+                if (m_fd >= 0)
+                    close(m_fd);
+                m_fd = -1;
+                m_mapping = 0;
+                m_mappedSize = 0;
+            }
+
+            void disable(const char* what)
+            {
+                fprintf(stderr, "AnalysisCache: %s %s, caching disabled\n", what, m_path);
+                m_failed = true;
+            }
+
+            const char* m_path;
+            Mutex m_lock;           // flock() does not exclude threads sharing m_fd
+            int m_fd;
+            void* m_mapping;
+            size_t m_mappedSize;
+            Vector<void*> m_retired;
+            bool m_failed;
+        };
+
+        CacheState& cacheState()
+        {
+            AtomicallyInitializedStatic(CacheState&, state = *new CacheState);
+            return state;
+        }
+
+    }
+
+    bool AnalysisCache::isEnabled()
+    {
+        return Options::ifcAnalysisCacheSize() && cacheState().isEnabled();
+    }
+
+    void AnalysisCache::computeKey(CodeBlock* codeBlock, Interpreter* interpreter, bool withSEN, Key& key)
+    {
+        SHA1 sha1;
+        Instruction* begin = codeBlock->instructions().begin();
+        Instruction* end = codeBlock->instructions().end();
+
+        uint32_t description[] = {
+            cacheVersion,
+            withSEN,
+            static_cast<uint32_t>(codeBlock->codeType()),
+            static_cast<uint32_t>(codeBlock->specializationKind()),
+            static_cast<uint32_t>(end - begin)
+        };
+        sha1.addBytes(reinterpret_cast<const uint8_t*>(description), sizeof(description));
+
+        const SourceCode& source = codeBlock->ownerExecutable()->source();
+        const StringImpl* text = source.provider()->data();
+        if (text->is8Bit())
+            sha1.addBytes(text->characters8() + source.startOffset(), source.length());
+        else
+            sha1.addBytes(reinterpret_cast<const uint8_t*>(text->characters16() + source.startOffset()), source.length() * sizeof(UChar));
+
+        Vector<uint8_t> opcodes;
+        for (Instruction* vPC = begin; vPC < end; ) {
+            OpcodeID opcode = interpreter->getOpcodeID(vPC->u.opcode);
+            opcodes.append(static_cast<uint8_t>(opcode));
+            vPC += opcodeLengths[opcode];
+        }
+        sha1.addBytes(opcodes);
+
+        for (size_t i = 0; i < codeBlock->numberOfExceptionHandlers(); i++) {
+            HandlerInfo& handler = codeBlock->exceptionHandler(i);
+            uint32_t range[] = { handler.start, handler.end, handler.target };
+            sha1.addBytes(reinterpret_cast<const uint8_t*>(range), sizeof(range));
+        }
+
+        sha1.computeHash(key);
+    }
+
+    bool AnalysisCache::lookup(const Key& key, int count, Tables& tables)
+    {
+        return cacheState().lookup(key, count, tables);
+    }
+
+    void AnalysisCache::store(const Key& key, const Tables& tables)
+    {
+        cacheState().store(key, tables);
+    }
+
+}
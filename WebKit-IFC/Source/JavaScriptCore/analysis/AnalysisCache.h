@@ -0,0 +1,54 @@
+/*
+ *  AnalysisCache.h
+ *  JavaScriptCore
+ *
+ *  Persistent cache of the StaticAnalyzer tables (IPDs, loop heads and
+ *  loop containment), shared by every process that points
+ *  JSC_IFC_ANALYSIS_CACHE at the same file. Entries are keyed by a SHA-1
+ *  of the CodeBlock's source text, its opcodes and handler table, the
+ *  analysis flavor (with or without the SEN) and the cache format
+ *  version, so a library loaded from any url on any page hits the same
+ *  entry.
+ *
+ *  The file is memory-mapped and a hit is a view into the mapping, which
+ *  the analyzer packs into a ContextTable. Entries are never modified once written:
+ *  new ones are appended, and when the file is full the most recently
+ *  used half is copied into a fresh file that is renamed over the old
+ *  one. Mappings of replaced files are kept, so views stay valid for the
+ *  life of the process. The file size is Options::ifcAnalysisCacheSize()
+ *  megabytes. Access is serialized across processes with flock().
+ *
+ */
+
+#ifndef AnalysisCache_h
+#define AnalysisCache_h
+
+#include <stdint.h>
+#include <wtf/Vector.h>
+
+namespace JSC {
+
+    class CodeBlock;
+    class Interpreter;
+
+    class AnalysisCache {
+    public:
+        typedef WTF::Vector<uint8_t, 20> Key;
+
+        // Read only; a hit points into the cache file.
+        struct Tables {
+            int count;
+            const int* idom;
+            const bool* loop;
+            const bool* containsLoop;
+        };
+
+        static bool isEnabled();
+        static void computeKey(CodeBlock*, Interpreter*, bool withSEN, Key&);
+        static bool lookup(const Key&, int count, Tables&);
+        static void store(const Key&, const Tables&);
+    };
+
+}
+
+#endif // AnalysisCache_h
@@ -0,0 +1,167 @@
+/*
+ *  AnalysisQueue.cpp
+ *  JavaScriptCore
+ *
+ */
+
+#include "config.h"
+#include "AnalysisQueue.h"
+
+#include "CodeBlock.h"
+#include "ContextTable.h"
+#include "Interpreter.h"
+#include "JSGlobalData.h"
+#include "Options.h"
+#include "StaticAnalyzer.h"
+#include <wtf/HashMap.h>
+#include <wtf/ListHashSet.h>
+#include <wtf/Threading.h>
+
+namespace JSC {
+
+    namespace {
+
+        class Workers {
+        public:
+            Workers()
+            {
+                for (unsigned i = 0; i < Options::ifcAnalysisThreads(); i++)
+                    createThread(threadMain, this, "JavaScriptCore::AnalysisQueue");
+            }
+
+            void enqueue(CodeBlock* codeBlock, AnalysisQueue::Priority priority)
+            {
+                MutexLocker locker(m_lock);
+                if (codeBlock->backgroundAnalysis == AnalysisQueue::Queued) {
+                    if (m_jobs[priority].contains(codeBlock))
+                        return;
+                    removeJob(codeBlock);
+                } else if (codeBlock->backgroundAnalysis != AnalysisQueue::NoJob)
+                    return;
+                codeBlock->backgroundAnalysis = AnalysisQueue::Queued;
+                m_jobs[priority].add(codeBlock);
+                m_jobAvailable.signal();
+            }
+
+            PassRefPtr<ContextTable> waitFor(CodeBlock* codeBlock)
+            {
+                MutexLocker locker(m_lock);
+                switch (codeBlock->backgroundAnalysis) {
+                case AnalysisQueue::Queued:
+                    // Cheaper to run it here than to wait for a worker.
+                    removeJob(codeBlock);
+                    codeBlock->backgroundAnalysis = AnalysisQueue::NoJob;
+                    return 0;
+                case AnalysisQueue::Running:
+                    while (codeBlock->backgroundAnalysis == AnalysisQueue::Running)
+                        m_jobFinished.wait(m_lock);
+                    // Fall through.
+                case AnalysisQueue::Finished:
+                    codeBlock->backgroundAnalysis = AnalysisQueue::NoJob;
+                    return m_results.take(codeBlock);
+                default:
+                    return 0;
+                }
+            }
+
+            void cancel(CodeBlock* codeBlock)
+            {
+                MutexLocker locker(m_lock);
+                if (codeBlock->backgroundAnalysis == AnalysisQueue::Queued)
+                    removeJob(codeBlock);
+                while (codeBlock->backgroundAnalysis == AnalysisQueue::Running)
+                    m_jobFinished.wait(m_lock);
+                m_results.remove(codeBlock);
+                codeBlock->backgroundAnalysis = AnalysisQueue::NoJob;
+            }
+
+        private:
+            static void threadMain(void* workers)
+            {
+                static_cast<Workers*>(workers)->run();
+            }
+
+            void removeJob(CodeBlock* codeBlock)
+            {
+                for (unsigned i = 0; i < AnalysisQueue::NumberOfPriorities; i++)
+                    m_jobs[i].remove(codeBlock);
+            }
+
+            // The oldest job of the most urgent priority, or 0.
+            CodeBlock* takeJob()
+            {
+                for (unsigned i = 0; i < AnalysisQueue::NumberOfPriorities; i++) {
+                    if (!m_jobs[i].isEmpty()) {
+                        CodeBlock* codeBlock = m_jobs[i].first();
+                        m_jobs[i].remove(codeBlock);
+                        return codeBlock;
+                    }
+                }
+                return 0;
+            }
+
+            void run()
+            {
+                m_lock.lock();
+                while (true) {
+                    CodeBlock* codeBlock;
+                    while (!(codeBlock = takeJob()))
+                        m_jobAvailable.wait(m_lock);
+                    codeBlock->backgroundAnalysis = AnalysisQueue::Running;
+                    m_lock.unlock();
+
+                    // Only reads the bytecode and tables the generator has
+                    // finished with. The interpreter may rewrite an opcode
+                    // for an inline cache or to its labeled handler
+                    // meanwhile; either version has the same length.
+                    RefPtr<ContextTable> table = StaticAnalyzer().genContextTable(codeBlock, codeBlock->globalData()->interpreter, false);
+
+                    m_lock.lock();
+                    m_results.set(codeBlock, table.release());
+                    codeBlock->backgroundAnalysis = AnalysisQueue::Finished;
+                    m_jobFinished.broadcast();
+                }
+            }
+
+            Mutex m_lock;
+            ThreadCondition m_jobAvailable;
+            ThreadCondition m_jobFinished;
+            ListHashSet<CodeBlock*> m_jobs[AnalysisQueue::NumberOfPriorities]; // each in enqueue order
+            HashMap<CodeBlock*, RefPtr<ContextTable> > m_results; // Finished, not yet taken
+        };
+
+        Workers& workers()
+        {
+            AtomicallyInitializedStatic(Workers&, workers = *new Workers);
+            return workers;
+        }
+
+    }
+
+    bool AnalysisQueue::isEnabled()
+    {
+        return Options::ifcAnalysisThreads();
+    }
+
+    void AnalysisQueue::enqueue(CodeBlock* codeBlock, Priority priority)
+    {
+        workers().enqueue(codeBlock, priority);
+    }
+
+    PassRefPtr<ContextTable> AnalysisQueue::waitFor(CodeBlock* codeBlock)
+    {
+        if (!isEnabled())
+            return 0;
+        return workers().waitFor(codeBlock);
+    }
+
+    void AnalysisQueue::cancel(CodeBlock* codeBlock)
+    {
+        // Only the CodeBlock's own thread leaves NoJob, so that needs no
+        // lock.
+        if (codeBlock->backgroundAnalysis == NoJob)
+            return;
+        workers().cancel(codeBlock);
+    }
+
+}
@@ -0,0 +1,70 @@
+/*
+ *  AnalysisQueue.h
+ *  JavaScriptCore
+ *
+ *  Worker threads that run the static analysis (without the SEN, the
+ *  flavor almost every entry uses) as soon as the BytecodeGenerator has
+ *  finished a CodeBlock, so the first labelled branch usually finds the
+ *  IPDs ready. The interpreter only blocks if it reaches that branch
+ *  while the job is running; a job that has not started yet is taken
+ *  back and run on the spot.
+ *
+ *  Workers take the oldest job of the most urgent priority. Code about to
+ *  run comes first. With Options::ifcAnalyzeWholeScript()
+ *  (JSC_ifcAnalyzeWholeScript=true; off by default, since it compiles
+ *  functions the page may never call) a script's function declarations
+ *  are compiled as it loads and queued behind it, those its top-level
+ *  code refers to (directly or through each other) ahead of the rest.
+ *  Nested functions still wait for their first call, since their scope
+ *  chain is only known then.
+ *
+ *  The number of workers is Options::ifcAnalysisThreads()
+ *  (JSC_ifcAnalysisThreads=<n>); 0 leaves all analysis to the first
+ *  labelled branch.
+ *
+ */
+
+#ifndef AnalysisQueue_h
+#define AnalysisQueue_h
+
+#include <wtf/PassRefPtr.h>
+
+namespace JSC {
+
+    class CodeBlock;
+    class ContextTable;
+
+    class AnalysisQueue {
+    public:
+        // CodeBlock::backgroundAnalysis, guarded by the queue's lock
+        enum JobState {
+            NoJob,
+            Queued,
+            Running,
+            Finished
+        };
+
+        // Most urgent first
+        enum Priority {
+            OnDemand,     // generated because it is about to run
+            Referenced,   // reachable by name from loaded top-level code
+            Unreferenced, // declared by loaded code, not yet referenced
+            NumberOfPriorities
+        };
+
+        static bool isEnabled();
+
+        // Moves a job that is still queued to the given priority.
+        static void enqueue(CodeBlock*, Priority = OnDemand);
+
+        // The table a worker computed, or 0 if the caller should run the
+        // analysis itself.
+        static PassRefPtr<ContextTable> waitFor(CodeBlock*);
+
+        // From ~CodeBlock: drops a queued job or waits out a running one.
+        static void cancel(CodeBlock*);
+    };
+
+}
+
+#endif // AnalysisQueue_h
@@ -0,0 +1,55 @@
+/*
+ *  ContextTable.cpp
+ *  JavaScriptCore
+ *
+ */
+
+#include "config.h"
+#include "ContextTable.h"
+
+#include "CodeBlock.h"
+#include "Instruction.h"
+#include "Interpreter.h"
+#include "LabelFreeAnalysis.h"
+#include "Opcode.h"
+
+namespace JSC {
+
+    PassRefPtr<ContextTable> ContextTable::create(CodeBlock* codeBlock, Interpreter* interpreter, int count, const int* idom, const bool* loop, const bool* containsLoop)
+    {
+        COMPILE_ASSERT(sizeof(Site) == 8, ContextTable_Site_is_packed);
+        RefPtr<ContextTable> table = adoptRef(new ContextTable);
+        Instruction* begin = codeBlock->instructions().begin();
+        int end = count - 1;
+        for (int pos = 0; pos < end; ) {
+            OpcodeID opcode = interpreter->getOpcodeID(begin[pos].u.opcode);
+            int next = pos + opcodeLengths[opcode];
+            bool site = idom[pos] != next || loop[pos] || containsLoop[pos];
+            switch (opcode) {
+            case op_call:
+            case op_call_eval:
+            case op_call_varargs:
+            case op_construct:
+            case op_catch:
+                site = true;
+                break;
+            default:
+                break;
+            }
+            if (site) {
+                ASSERT(idom[pos] >= 0 && idom[pos] < (1 << 30));
+                Site entry;
+                entry.position = pos;
+                entry.ipd = idom[pos];
+                entry.loop = loop[pos];
+                entry.containsLoop = containsLoop[pos];
+                table->m_sites.append(entry);
+            }
+            pos = next;
+        }
+        table->m_sites.shrinkToFit();
+        LabelFreeAnalysis::compute(codeBlock, interpreter, count, idom, table->m_labelFree);
+        return table.release();
+    }
+
+}
@@ -0,0 +1,94 @@
+/*
+ *  ContextTable.h
+ *  JavaScriptCore
+ *
+ *  Frozen result of the static analysis for one CodeBlock and flavor:
+ *  the immediate post-dominator and the loop bits of each branch site,
+ *  packed into 8 bytes and sorted by position. Only the instructions
+ *  whose IPD is not simply the next instruction are sites (block ends,
+ *  and code that cannot reach the exit), plus calls and catch blocks so
+ *  that the interpreter's other lookups stay on the fast path. Alongside
+ *  the sites, one bit per instruction marks those LabelFreeAnalysis
+ *  found label-free.
+ *
+ *  Built once by StaticAnalyzer and never modified, so a CodeBlock
+ *  switches between flavors by swapping a pointer.
+ *
+ */
+
+#ifndef ContextTable_h
+#define ContextTable_h
+
+#include <stdint.h>
+#include <wtf/BitVector.h>
+#include <wtf/PassRefPtr.h>
+#include <wtf/RefCounted.h>
+#include <wtf/Vector.h>
+
+namespace JSC {
+
+    class CodeBlock;
+    class Interpreter;
+
+    class ContextTable : public RefCounted<ContextTable> {
+    public:
+        // Dense tables indexed by instruction offset, as the analysis
+        // computes them; count is instructions().size() + 1.
+        static PassRefPtr<ContextTable> create(CodeBlock*, Interpreter*, int count, const int* idom, const bool* loop, const bool* containsLoop);
+
+        // False if position is not a site, in which case its IPD is the
+        // next instruction.
+        bool ipd(int position, int& result) const
+        {
+            const Site* site = find(position);
+            if (!site)
+                return false;
+            result = site->ipd;
+            return true;
+        }
+
+        bool loop(int position) const { const Site* site = find(position); return site && site->loop; }
+        bool cLoop(int position) const { const Site* site = find(position); return site && site->containsLoop; }
+        bool labelFree(int position) const { return m_labelFree.get(position); }
+
+        size_t sizeInBytes() const
+        {
+            size_t bits = m_labelFree.size() < sizeof(void*) * 8 ? 0 : (m_labelFree.size() + 7) / 8; // out of line
+            return sizeof(*this) + m_sites.capacity() * sizeof(Site) + bits;
+        }
+
+    private:
+        struct Site {
+            int32_t position;
+            uint32_t ipd : 30;
+            uint32_t loop : 1;         // loop head or backward jump
+            uint32_t containsLoop : 1; // the branch's region has a loop
+        };
+
+        // Built on an AnalysisQueue worker and used on the CodeBlock's thread
+        ContextTable() { turnOffVerifier(); }
+
+        const Site* find(int position) const
+        {
+            const Site* low = m_sites.data();
+            size_t size = m_sites.size();
+            while (size) {
+                size_t half = size / 2;
+                if (low[half].position < position) {
+                    low += half + 1;
+                    size -= half + 1;
+                } else
+                    size = half;
+            }
+            if (low == m_sites.data() + m_sites.size() || low->position != position)
+                return 0;
+            return low;
+        }
+
+        WTF::Vector<Site> m_sites;
+        WTF::BitVector m_labelFree;
+    };
+
+}
+
+#endif // ContextTable_h
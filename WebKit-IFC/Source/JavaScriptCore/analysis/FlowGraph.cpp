@@ -15,33 +15,438 @@
 
 #include "FlowGraph.h"
 #include "CodeBlock.h"
+#include "Options.h"
+#include <algorithm>
+#include <limits.h>
+#include <wtf/BitVector.h>
+#include <wtf/DataLog.h>
 
 namespace JSC
 {
     
+    // A merge region structuredIPDs() is inside, with the lowest and highest
+    // edge targets of its instructions so far
+    struct OpenRegion {
+        size_t region;
+        int low;
+        int high;
+        bool used; // some branch takes its IPD from the region
+    };
+    
+    // False if a branch took its IPD from the region and an edge leaves it
+    // other than to its end.
+    static bool closeRegion(const WTF::Vector<MergeRegion>& regions, WTF::Vector<OpenRegion, 16>& open) {
+        OpenRegion closed = open.last();
+        open.removeLast();
+        const MergeRegion& region = regions[closed.region];
+        if (closed.used && (closed.low < (int) region.start || closed.high > (int) region.end))
+            return false;
+        if (!open.isEmpty()) {
+            open.last().low = std::min(open.last().low, closed.low);
+            open.last().high = std::max(open.last().high, closed.high);
+        }
+        return true;
+    }
+    
+    // Find with path compression over HandlerIndex::build's skip links
+    static size_t unpainted(WTF::Vector<size_t>& next, size_t i) {
+        size_t root = i;
+        while (next[root] != root)
+            root = next[root];
+        while (next[i] != root) {
+            size_t following = next[i];
+            next[i] = root;
+            i = following;
+        }
+        return root;
+    }
+    
+    void HandlerIndex::build(CodeBlock* codeBlock) {
+        const size_t numHandlers = codeBlock->numberOfExceptionHandlers();
+        boundaries.shrink(0);
+        segmentTarget.shrink(0);
+        if (!numHandlers)
+            return;
+        
+        for (size_t i = 0; i < numHandlers; i++) {
+            HandlerInfo& handler = codeBlock->exceptionHandler(i);
+            boundaries.append(handler.start);
+            boundaries.append(handler.end);
+        }
+        std::sort(boundaries.begin(), boundaries.end());
+        boundaries.shrink(std::unique(boundaries.begin(), boundaries.end()) - boundaries.begin());
+        
+        size_t segments = boundaries.size() - 1;
+        segmentTarget.fill(-1, segments);
+        
+        // next[i] is the first unpainted segment at or after i, so every
+        // segment is painted once, by the first handler covering it.
+        WTF::Vector<size_t> next(segments + 1);
+        for (size_t i = 0; i <= segments; i++)
+            next[i] = i;
+        for (size_t h = 0; h < numHandlers; h++) {
+            HandlerInfo& handler = codeBlock->exceptionHandler(h);
+            size_t first = std::lower_bound(boundaries.begin(), boundaries.end(), handler.start) - boundaries.begin();
+            size_t last = std::lower_bound(boundaries.begin(), boundaries.end(), handler.end) - boundaries.begin();
+            for (size_t i = unpainted(next, first); i < last; i = unpainted(next, i + 1)) {
+                segmentTarget[i] = handler.target;
+                next[i] = i + 1;
+            }
+        }
+    }
+    
+    int HandlerIndex::handlerFor(int pos) const {
+        if (boundaries.isEmpty())
+            return -1;
+        // First boundary after pos; the segment before it holds pos.
+        size_t i = std::upper_bound(boundaries.begin(), boundaries.end(), static_cast<unsigned>(pos)) - boundaries.begin();
+        if (!i || i == boundaries.size())
+            return -1;
+        return segmentTarget[i - 1];
+    }
+    
     // Start AlistNode class functions
     AListNode::AListNode() {
     }
     // End AlistNode class functions
     
-    FlowGraph::FlowGraph() {
+    FlowGraph::FlowGraph()
+        : n(0)
+        , count(0)
+        , blocks(0)
+        , codeBlock(0)
+        , edges(0)
+        , preorder(0)
+        , postorder(0)
+        , vertex(0)
+        , parent(0)
+        , blockStart(0)
+        , blockEnd(0)
+        , impException(false)
+        , loop(0)
+        , loopsBefore(0)
+    {
+    }
+    
+    // Appends every instruction offset control can reach from pos, count - 1
+    // for the SEN. Targets may repeat.
+    void FlowGraph::instructionEdges(Interpreter* interpreter, Instruction* vPC, int pos, int length, bool existsHandler, int retNode, const HandlerIndex& handlers, WTF::Vector<int, 4>& targets) {
+        
+        int opcode = interpreter->getOpcodeID(vPC->u.opcode);
         
+        bool found = false;     // Check if handler found
+        bool expExc = false;
+        // Abhi -- For edges for "implicit" exceptions
+        switch (opcode) {
+                
+                // direct throws
+            case op_throw:
+            case op_throw_reference_error:
+                
+                expExc = true;
+                // CHECK_FOR_EXCEPTION / TIMEOUT might not be required for edges
+                // Throw exception via CHECK_FOR_TIMEOUT
+                
+            case op_loop:
+            case op_loop_if_true:
+            case op_loop_if_false:
+            
+            // Throw exception via CHECK_FOR_EXCEPTION
+            case op_jless:
+            case op_jlesseq:
+            case op_jgreater:
+            case op_jgreatereq:
+            case op_jnless:
+            case op_jnlesseq:
+            case op_jngreater:
+            case op_jngreatereq:
+            case op_strcat:
+            case op_push_scope:
+            case op_next_pname:
+            case op_eq:
+            case op_neq:
+            case op_stricteq:
+            case op_nstricteq:
+            case op_less:
+            case op_lesseq:
+            case op_greater:
+            case op_greatereq:
+            case op_pre_inc:
+            case op_post_inc:
+            case op_pre_dec:
+            case op_post_dec:
+            case op_to_jsnumber:
+            case op_negate:
+            case op_add:
+            case op_mul:
+            case op_div:
+            case op_mod:
+            case op_sub:
+            case op_lshift:
+            case op_rshift:
+            case op_urshift:
+            case op_bitand:
+            case op_bitxor:
+            case op_bitor:
+            case op_not:
+            case op_instanceof:
+            case op_resolve_base:
+            case op_get_by_id:
+            case op_get_by_id_getter_proto:
+            case op_get_by_id_custom_proto:
+            case op_get_by_id_getter_self:
+            case op_get_by_id_custom_self:
+            case op_get_by_id_generic:
+            case op_get_by_id_getter_chain:
+            case op_get_by_id_custom_chain:
+            case op_put_by_id:
+            case op_put_by_id_generic:
+            case op_get_by_pname:
+            case op_get_arguments_length:
+            case op_get_by_val:
+            case op_put_by_val:
+            
+             // CHECK_FOR_TIMEOUT/EXCEPTION
+            case op_loop_if_less:
+            case op_loop_if_lesseq:
+            case op_loop_if_greater:
+            case op_loop_if_greatereq:
+            
+                // Direct throw
+            case op_new_regexp:
+            case op_check_has_instance:
+            case op_resolve:
+            case op_resolve_skip:
+            case op_resolve_global:
+            case op_resolve_global_dynamic:
+            case op_ensure_property_exists:
+            case op_resolve_with_base:
+            case op_resolve_with_this:
+            case op_del_by_val:
+            case op_call_eval:
+                
+                // Throw and CHECK_FOR_EXCEPTION
+                // Currently, the called function returns and retains the label in both cases - exception/no-exception
+                // On normal return, we pop at op_call; else we pop at the idom (exception handler)
+            case op_call:
+            case op_call_varargs:
+            case op_del_by_id:
+            case op_construct:
+            case op_in:
+            {
+                if (expExc || impException){
+                    int handler = handlers.handlerFor(pos);
+                    if (handler >= 0) {
+                        targets.append(handler);  // target contains where it should be handled
+                        found = true;
+                    }
+                    // If no handler is found, add an edge to the exception node. Making count as exception node
+                    // ----- Hope this does not break anything ----- 
+                    // ret might occur in between causing confusion as synthetic exit node might be the IPD,
+                    // even though there is no handler or the handler is present in the same function itself.
+                    if (!found && existsHandler)
+                        targets.append(count - 1);
+                }
+            }
+            default:
+                break;
+        }
+        
+        // Add edges for implicit exceptions across functions
+        // The edges would go to the synthetic exit node of the function.
+        // Abhi ---------------------------------------------------------------------
+        
+        switch (opcode) {
+                //----------- CONDITIONAL JUMPS (I.E. BRANCHES) -----------//
+                
+                // Conditional w/ single offset in vPC[2]
+            case op_loop_if_true:
+            case op_loop_if_false:
+            case op_jtrue:
+            case op_jfalse:
+            case op_jempty: // Abhi -- opcode for finally block
+            case op_jeq_null:
+            case op_jneq_null:
+                targets.append(pos + vPC[2].u.operand);
+                targets.append(pos + length);
+                break;
+  
+                // Conditional w/ single offset in vPC[3]
+            case op_jneq_ptr:
+            case op_loop_if_less:
+            case op_loop_if_lesseq:
+            case op_loop_if_greater:
+            case op_loop_if_greatereq:
+            case op_jnless:
+            case op_jless:
+            case op_jnlesseq:
+            case op_jlesseq:
+            case op_jgreater:
+            case op_jgreatereq:
+            case op_jngreater:
+            case op_jngreatereq:
+                targets.append(pos + vPC[3].u.operand);
+                targets.append(pos + length);
+                break;
+                
+                // Property name getter may branch; stores offset in vPC[5]
+            case op_get_pnames:
+                targets.append(pos + vPC[5].u.operand);
+                targets.append(pos + length);
+                break;
+                
+                // Property name interator stores offset in vPC[6]
+            case op_next_pname:
+                targets.append(pos + vPC[6].u.operand);
+                targets.append(pos + length);
+                break;
+                
+// Macro to loop over a SimpleJumpTable, as in CodeBlock::dump()
+#define ADD_SWITCH_EDGES() \
+Vector<int32_t>::const_iterator end = table.branchOffsets.end(); \
+for (Vector<int32_t>::const_iterator iter = table.branchOffsets.begin(); iter != end; ++iter) { \
+if (!*iter) \
+continue; \
+targets.append(pos + *iter); \
+}
+                
+                // Switches have jump table index in vPC[1] and default target in vPC[2]
+            case op_switch_imm: {
+                SimpleJumpTable table = codeBlock->immediateSwitchJumpTable(vPC[1].u.operand);
+                ADD_SWITCH_EDGES();
+                targets.append(pos + vPC[2].u.operand);
+                break;
+            }
+                
+            case op_switch_char: {
+                SimpleJumpTable table = codeBlock->characterSwitchJumpTable(vPC[1].u.operand);
+                ADD_SWITCH_EDGES();
+                targets.append(pos + vPC[2].u.operand);
+                break;
+            }
+                
+                // String Switches use a different type for storing the table, so our macro doesn't work
+            case op_switch_string: {
+                StringJumpTable table = codeBlock->stringSwitchJumpTable(vPC[1].u.operand);
+                StringJumpTable::StringOffsetTable::const_iterator end = table.offsetTable.end();
+                for ( StringJumpTable::StringOffsetTable::const_iterator iter = table.offsetTable.begin(); iter != end; ++iter) {
+                    targets.append(pos + iter->second.branchOffset);
+                }
+                targets.append(pos + vPC[2].u.operand);
+                break;
+            }
+                
+                //----------- UNCONDITIONAL JUMPS -----------//
+                
+                // Unconditional w/ offset in vPC[1]
+            case op_jmp:
+            case op_loop:
+                targets.append(pos + vPC[1].u.operand);
+                break;
+                
+                // Unconditional w/ offset in vPC[2]
+            case op_jmp_scopes:
+                //Vineet - Commenting the op_jsr case, as it is not a valid opcode in this Javascriptcore
+                //case op_jsr:
+                targets.append(pos + vPC[2].u.operand);
+                break;
+                
+                //----------- OTHER OPCODES -----------//
+                // Abhi -- Handled above
+                /* Abhi - EXCEPTION HANDLING
+                
+            case op_throw_reference_error:   // Statements which throw reference error -- Explicit error
+            case op_throw:
+            {
+                bool found = false;     // Check if handler found
+                int num = 0;
+                while ((unsigned)num < numHandlers) {
+                    hInfo = &codeBlock->exceptionHandler(num++);
+                    if ((hInfo->start <= (unsigned)pos) && (hInfo->end > (unsigned)pos)) {
+                        targets.append(hInfo->target);  // target contains where it should be handled
+                        found = true;
+                        break;
+                    }
+                }
+                // No handler found. Jump to end of the program!
+                if (!found)     targets.append(count - 3); // Assuming, end is 2 bytes long.
+                break;
+            }
+                //Abhi -- End of Exception Handling case */
+                
+                // End of method
+            case op_end:
+            case op_ret:
+                if (pos == count - 3)
+                    targets.append(count - 1); // edge to last node - SEN
+                else
+                    targets.append(retNode); // edge to itself or last ret node
+
+                break;
+                
+            case op_ret_object_or_this:
+                if (pos == count - 4)
+                    targets.append(count - 1); // edge to last node - SEN
+                else
+                    targets.append(retNode); // edge to last constructor_ret node
+                break;
+                
+                // Non-jumping/branching opcodes
+            default:
+                targets.append(pos+length);
+                break;
+        }
     }
     
+    void FlowGraph::successors(CodeBlock* cb, Interpreter* interpreter, int pos, WTF::Vector<int, 4>& targets) {
+        codeBlock = cb;
+        count = (int) cb->instructions().size() + 1;
+        Instruction* vPC = cb->instructions().begin() + pos;
+        int length = opcodeLengths[interpreter->getOpcodeID(vPC->u.opcode)];
+        HandlerIndex noHandlers;
+        WTF::Vector<int, 4> all;
+        instructionEdges(interpreter, vPC, pos, length, false, -1, noHandlers, all);
+        targets.shrink(0);
+        for (size_t i = 0; i < all.size(); i++) {
+            if (all[i] >= 0 && all[i] < count - 1)
+                targets.append(all[i]);
+        }
+    }
     
-    void FlowGraph::createGraph(CodeBlock* cb, Interpreter* interpreter, bool existsHandler) {
-        
+    // Marks the loop head of a loop opcode; false for any other opcode.
+    bool FlowGraph::markLoop(Instruction* vPC, int pos, int opcode) {
+        int offset;
+        switch (opcode) {
+            case op_loop:
+                offset = vPC[1].u.operand;
+                break;
+            case op_loop_if_true:
+            case op_loop_if_false:
+                offset = vPC[2].u.operand;
+                break;
+            case op_loop_if_less:
+            case op_loop_if_lesseq:
+            case op_loop_if_greater:
+            case op_loop_if_greatereq:
+                offset = vPC[3].u.operand;
+                break;
+            default:
+                return false;
+        }
+        if (pos > pos + offset)
+            loop[pos + offset] = true;
+        else
+            loop[pos] = true;
+        return true;
+    }
+    
+    // Sets codeBlock and count, allocates loop[] and loopsBefore[] and
+    // returns the node that returns reach (0 if there is none).
+    int FlowGraph::prepare(CodeBlock* cb, Interpreter* interpreter) {
         
         // Initialize instance variables
         codeBlock = cb;
         
-        // Initialize locals
-        Instruction* begin = codeBlock->instructions().begin();
-        Instruction* vPC = begin;
-        
-        // Exception Handling details
-        const size_t numHandlers = codeBlock->numberOfExceptionHandlers();
-        HandlerInfo* hInfo;
         int retNode = 0;
         
         // Get number of instructions
@@ -56,17 +461,36 @@ namespace JSC
             retNode = count - 4;
         }
         
-        edges = new AListNode[count];
-        for(int i = 0; i < count; i++) {
-            edges[i] = AListNode();
-        }
-        
         // Set the loop information
         loop = new bool[count];
         memset(loop, false, sizeof(bool) * count);
+        loopsBefore = new int[count];
+        memset(loopsBefore, 0, sizeof(int) * count);
+        return retNode;
+    }
+    
+    void FlowGraph::createGraph(CodeBlock* cb, Interpreter* interpreter, bool existsHandler) {
         
-        // Iterate over OPCODES to build control flow graph (CFG)
-        while (vPC < codeBlock->instructions().end()) {
+        int retNode = prepare(cb, interpreter);
+        
+        // Initialize locals
+        Instruction* begin = codeBlock->instructions().begin();
+        Instruction* end = codeBlock->instructions().end();
+        Instruction* vPC = begin;
+        
+        HandlerIndex handlers;
+        handlers.build(codeBlock);
+        
+        int loops = 0;
+        
+        // First pass: find the leaders. An instruction ends its block unless
+        // its only successor is the next instruction; every other successor
+        // starts one.
+        WTF::BitVector leaders;
+        leaders.ensureSize(count);
+        leaders.quickSet(0);
+        WTF::Vector<int, 4> targets;
+        while (vPC < end) {
             // Pull out opcode
             int opcode = interpreter->getOpcodeID(vPC->u.opcode);
             
@@ -74,330 +498,192 @@ namespace JSC
             int pos = (long) (vPC-begin);
             // Get length of particular opcode, use to inrement to next instruction
             int length = opcodeLengths[opcode];
-
-            bool found = false;     // Check if handler found
-            bool expExc = false;
-            // Abhi -- For edges for "implicit" exceptions
-            switch (opcode) {
-                    
-                    // direct throws
-                case op_throw:
-                case op_throw_reference_error:
-                    
-                    expExc = true;
-                    // CHECK_FOR_EXCEPTION / TIMEOUT might not be required for edges
-                    // Throw exception via CHECK_FOR_TIMEOUT
-                    
-                case op_loop:
-                case op_loop_if_true:
-                case op_loop_if_false:
-                
-                // Throw exception via CHECK_FOR_EXCEPTION
-                case op_jless:
-                case op_jlesseq:
-                case op_jgreater:
-                case op_jgreatereq:
-                case op_jnless:
-                case op_jnlesseq:
-                case op_jngreater:
-                case op_jngreatereq:
-                case op_strcat:
-                case op_push_scope:
-                case op_next_pname:
-                case op_eq:
-                case op_neq:
-                case op_stricteq:
-                case op_nstricteq:
-                case op_less:
-                case op_lesseq:
-                case op_greater:
-                case op_greatereq:
-                case op_pre_inc:
-                case op_post_inc:
-                case op_pre_dec:
-                case op_post_dec:
-                case op_to_jsnumber:
-                case op_negate:
-                case op_add:
-                case op_mul:
-                case op_div:
-                case op_mod:
-                case op_sub:
-                case op_lshift:
-                case op_rshift:
-                case op_urshift:
-                case op_bitand:
-                case op_bitxor:
-                case op_bitor:
-                case op_not:
-                case op_instanceof:
-                case op_resolve_base:
-                case op_get_by_id:
-                case op_get_by_id_getter_proto:
-                case op_get_by_id_custom_proto:
-                case op_get_by_id_getter_self:
-                case op_get_by_id_custom_self:
-                case op_get_by_id_generic:
-                case op_get_by_id_getter_chain:
-                case op_get_by_id_custom_chain:
-                case op_put_by_id:
-                case op_put_by_id_generic:
-                case op_get_by_pname:
-                case op_get_arguments_length:
-                case op_get_by_val:
-                case op_put_by_val:
-                
-                 // CHECK_FOR_TIMEOUT/EXCEPTION
-                case op_loop_if_less:
-                case op_loop_if_lesseq:
-                case op_loop_if_greater:
-                case op_loop_if_greatereq:
-                
-                    // Direct throw
-                case op_new_regexp:
-                case op_check_has_instance:
-                case op_resolve:
-                case op_resolve_skip:
-                case op_resolve_global:
-                case op_resolve_global_dynamic:
-                case op_ensure_property_exists:
-                case op_resolve_with_base:
-                case op_resolve_with_this:
-                case op_del_by_val:
-                case op_call_eval:
-                    
-                    // Throw and CHECK_FOR_EXCEPTION
-                    // Currently, the called function returns and retains the label in both cases - exception/no-exception
-                    // On normal return, we pop at op_call; else we pop at the idom (exception handler)
-                case op_call:
-                case op_call_varargs:
-                case op_del_by_id:
-                case op_construct:
-                case op_in:
-                {
-                    if (expExc || impException){
-                        if (numHandlers > 0) {
-                            int num = 0;
-                            while ((unsigned)num < numHandlers) {
-                                hInfo = &codeBlock->exceptionHandler(num++);
-                                if ((hInfo->start <= (unsigned)pos) && (hInfo->end > (unsigned)pos)) {
-                                    add_edge(pos, hInfo->target);  // target contains where it should be handled
-                                    found = true;
-                                    break;
-                                }
-                            }
-                        }
-                        // If no handler is found, add an edge to the exception node. Making count as exception node
-                        // ----- Hope this does not break anything ----- 
-                        // ret might occur in between causing confusion as synthetic exit node might be the IPD,
-                        // even though there is no handler or the handler is present in the same function itself.
-                        if (!found && existsHandler)
-                            add_edge(pos, count - 1);
-                    }
-                }
-                default:
-                    break;
-            }
             
-            // Add edges for implicit exceptions across functions
-            // The edges would go to the synthetic exit node of the function.
-            // Abhi ---------------------------------------------------------------------
-            
-            switch (opcode) {
-                    //----------- CONDITIONAL JUMPS (I.E. BRANCHES) -----------//
-                    
-                    // Conditional w/ single offset in vPC[2]
-                case op_loop_if_true:
-                case op_loop_if_false:
-                case op_jtrue:
-                case op_jfalse:
-                case op_jempty: // Abhi -- opcode for finally block
-                case op_jeq_null:
-                case op_jneq_null:
-                    add_edge(pos, pos + vPC[2].u.operand);
-                    add_edge(pos, pos + length);
-                    break;
-  
-                    // Conditional w/ single offset in vPC[3]
-                case op_jneq_ptr:
-                case op_loop_if_less:
-                case op_loop_if_lesseq:
-                case op_loop_if_greater:
-                case op_loop_if_greatereq:
-                case op_jnless:
-                case op_jless:
-                case op_jnlesseq:
-                case op_jlesseq:
-                case op_jgreater:
-                case op_jgreatereq:
-                case op_jngreater:
-                case op_jngreatereq:
-                    add_edge(pos, pos + vPC[3].u.operand);
-                    add_edge(pos, pos + length);
-                    break;
-                    
-                    // Property name getter may branch; stores offset in vPC[5]
-                case op_get_pnames:
-                    add_edge(pos, pos + vPC[5].u.operand);
-                    add_edge(pos, pos + length);
-                    break;
-                    
-                    // Property name interator stores offset in vPC[6]
-                case op_next_pname:
-                    add_edge(pos, pos + vPC[6].u.operand);
-                    add_edge(pos, pos + length);
-                    break;
-                    
-// Macro to loop over a SimpleJumpTable, as in CodeBlock::dump()
-#define ADD_SWITCH_EDGES() \
-Vector<int32_t>::const_iterator end = table.branchOffsets.end(); \
-for (Vector<int32_t>::const_iterator iter = table.branchOffsets.begin(); iter != end; ++iter) { \
-if (!*iter) \
-continue; \
-add_edge(pos, pos + *iter); \
-}
-                    
-                    // Switches have jump table index in vPC[1] and default target in vPC[2]
-                case op_switch_imm: {
-                    SimpleJumpTable table = codeBlock->immediateSwitchJumpTable(vPC[1].u.operand);
-                    ADD_SWITCH_EDGES();
-                    add_edge(pos, pos + vPC[2].u.operand);
-                    break;
-                }
-                    
-                case op_switch_char: {
-                    SimpleJumpTable table = codeBlock->characterSwitchJumpTable(vPC[1].u.operand);
-                    ADD_SWITCH_EDGES();
-                    add_edge(pos, pos + vPC[2].u.operand);
-                    break;
-                }
-                    
-                    // String Switches use a different type for storing the table, so our macro doesn't work
-                case op_switch_string: {
-                    StringJumpTable table = codeBlock->stringSwitchJumpTable(vPC[1].u.operand);
-                    StringJumpTable::StringOffsetTable::const_iterator end = table.offsetTable.end();
-                    for ( StringJumpTable::StringOffsetTable::const_iterator iter = table.offsetTable.begin(); iter != end; ++iter) {
-                        add_edge(pos, pos + iter->second.branchOffset);
-                    }
-                    add_edge(pos, pos + vPC[2].u.operand);
-                    break;
-                }
-                    
-                    //----------- UNCONDITIONAL JUMPS -----------//
-                    
-                    // Unconditional w/ offset in vPC[1]
-                case op_jmp:
-                case op_loop:
-                    add_edge(pos, pos + vPC[1].u.operand);
-                    break;
-                    
-                    // Unconditional w/ offset in vPC[2]
-                case op_jmp_scopes:
-                    //Vineet - Commenting the op_jsr case, as it is not a valid opcode in this Javascriptcore
-                    //case op_jsr:
-                    add_edge(pos, pos + vPC[2].u.operand);
-                    break;
-                    
-                    //----------- OTHER OPCODES -----------//
-                    // Abhi -- Handled above
-                    /* Abhi - EXCEPTION HANDLING
-                    
-                case op_throw_reference_error:   // Statements which throw reference error -- Explicit error
-                case op_throw:
-                {
-                    bool found = false;     // Check if handler found
-                    int num = 0;
-                    while ((unsigned)num < numHandlers) {
-                        hInfo = &codeBlock->exceptionHandler(num++);
-                        if ((hInfo->start <= (unsigned)pos) && (hInfo->end > (unsigned)pos)) {
-                            add_edge(pos, hInfo->target);  // target contains where it should be handled
-                            found = true;
-                            break;
-                        }
-                    }
-                    // No handler found. Jump to end of the program!
-                    if (!found)     add_edge(pos, count - 3); // Assuming, end is 2 bytes long.
-                    break;
-                }
-                    //Abhi -- End of Exception Handling case */
-                    
-                    // End of method
-                case op_end:
-                case op_ret:
-                    if (pos == count - 3)
-                        add_edge(pos, count - 1); // edge to last node - SEN
-                    else
-                        add_edge(pos, retNode); // edge to itself or last ret node
-
-                    break;
-                    
-                case op_ret_object_or_this:
-                    if (pos == count - 4)
-                        add_edge(pos, count - 1); // edge to last node - SEN
-                    else
-                        add_edge(pos, retNode); // edge to last constructor_ret node
-                    break;
-                    
-                    // Non-jumping/branching opcodes
-                default:
-                    add_edge(pos, pos+length);
-                    break;
+            targets.shrink(0);
+            instructionEdges(interpreter, vPC, pos, length, existsHandler, retNode, handlers, targets);
+            if (targets.size() != 1 || targets[0] != pos + length) {
+                for (size_t i = 0; i < targets.size(); i++)
+                    leaders.quickSet(targets[i]);
+                leaders.quickSet(pos + length);
             }
+            
             // Loop indication
-            switch (opcode) {
-                case op_loop:
-                    if (pos > pos + vPC[1].u.operand)
-                        loop[pos + vPC[1].u.operand] = true;
-                    else
-                        loop[pos] = true;
-                    break;
-                case op_loop_if_true:
-                case op_loop_if_false:
-                    if (pos > pos + vPC[2].u.operand)
-                        loop[pos + vPC[2].u.operand] = true;
-                    else
-                        loop[pos] = true;
-                    break;
-                case op_loop_if_less:
-                case op_loop_if_lesseq:
-                case op_loop_if_greater:
-                case op_loop_if_greatereq:
-                    if (pos > pos + vPC[3].u.operand)
-                        loop[pos + vPC[3].u.operand] = true;
-                    else
-                        loop[pos] = true;
-                    break;
-                    
-                default:
-                    break;
-            }
+            loopsBefore[pos] = loops;
+            if (markLoop(vPC, pos, opcode))
+                loops++;
             
             vPC += length; // advance the length of the given opcode
         }
+        loopsBefore[count - 1] = loops;
+        
+        // Second pass: number the blocks in instruction order. Node 0 is
+        // unused and the SEN comes last.
+        WTF::Vector<int> starts;
+        WTF::Vector<int> ends;
+        for (vPC = begin; vPC < end; vPC += opcodeLengths[interpreter->getOpcodeID(vPC->u.opcode)]) {
+            int pos = (int) (vPC - begin);
+            if (leaders.quickGet(pos)) {
+                starts.append(pos);
+                ends.append(pos);
+            } else
+                ends.last() = pos;
+        }
+        
+        blocks = (int) starts.size() + 2;
+        blockStart = new int[blocks];
+        blockEnd = new int[blocks];
+        blockStart[0] = blockEnd[0] = -1;
+        memcpy(blockStart + 1, starts.data(), sizeof(int) * starts.size());
+        memcpy(blockEnd + 1, ends.data(), sizeof(int) * ends.size());
+        blockStart[blocks - 1] = count - 1;
+        blockEnd[blocks - 1] = -1;
+        
+        // Third pass: only block ends have edges that leave the block.
+        edges = new AListNode[blocks];
+        for (int b = 1; b < blocks - 1; b++) {
+            vPC = begin + blockEnd[b];
+            int length = opcodeLengths[interpreter->getOpcodeID(vPC->u.opcode)];
+            targets.shrink(0);
+            instructionEdges(interpreter, vPC, blockEnd[b], length, existsHandler, retNode, handlers, targets);
+            for (size_t i = 0; i < targets.size(); i++)
+                add_edge(b, blockAt(targets[i]));
+        }
         
         // Initialize arrays
         
-        semi = new int[count];
-        memset(semi, 0, sizeof(int) * count);
+        preorder = new int[blocks];
+        memset(preorder, 0, sizeof(int) * blocks);
         
-        label = new int[count];
-        memset(label, 0, sizeof(int) * count);
+        postorder = new int[blocks];
+        memset(postorder, 0, sizeof(int) * blocks);
         
-        vertex = new int[count];
-        memset(vertex, 0, sizeof(int) * count);
+        vertex = new int[blocks];
+        memset(vertex, 0, sizeof(int) * blocks);
         
-        parent = new int[count];
-        memset(parent, 0, sizeof(int) * count);
+        parent = new int[blocks];
+        memset(parent, 0, sizeof(int) * blocks);
         
-        ancestor = new int[count];
-        memset(ancestor, 0, sizeof(int) * count);
+    }
+    
+    bool FlowGraph::structuredIPDs(CodeBlock* cb, Interpreter* interpreter, int* ipd, bool* containsLoop) {
+        if (cb->numberOfExceptionHandlers())
+            return false;
         
-        child = new int[count];
-        memset(child, 0, sizeof(int) * count);
+        const WTF::Vector<MergeRegion>& regions = cb->mergeRegions();
+        int retNode = prepare(cb, interpreter);
+        Instruction* begin = codeBlock->instructions().begin();
+        HandlerIndex handlers; // empty
         
-        size = new int[count];
-        memset(size, 0, sizeof(int) * count);
+        // Regions are in the order they begin, so the innermost open one
+        // is last. Instructions outside every region need no check.
+        WTF::Vector<OpenRegion, 16> open;
+        WTF::Vector<int, 4> targets;
+        WTF::Vector<int> jumps;
+        size_t next = 0;
+        int loops = 0;
+        bool structured = true;
+        for (int pos = 0; structured && pos < count - 1; ) {
+            while (structured && !open.isEmpty() && (int) regions[open.last().region].end <= pos)
+                structured = closeRegion(regions, open);
+            for (; structured && next < regions.size() && (int) regions[next].start <= pos; next++) {
+                if ((int) regions[next].end <= pos)
+                    continue; // empty
+                if (!open.isEmpty() && regions[next].end > regions[open.last().region].end) {
+                    structured = false; // not nested
+                    break;
+                }
+                OpenRegion region = { next, INT_MAX, INT_MIN, false };
+                open.append(region);
+            }
+            if (!structured)
+                break;
+            
+            Instruction* vPC = begin + pos;
+            int opcode = interpreter->getOpcodeID(vPC->u.opcode);
+            int length = opcodeLengths[opcode];
+            
+            targets.shrink(0);
+            instructionEdges(interpreter, vPC, pos, length, false, retNode, handlers, targets);
+            if (targets.isEmpty()) {
+                structured = false;
+                break;
+            }
+            int low = targets[0];
+            int high = targets[0];
+            for (size_t i = 1; i < targets.size(); i++) {
+                low = std::min(low, targets[i]);
+                high = std::max(high, targets[i]);
+            }
+            if (!open.isEmpty()) {
+                open.last().low = std::min(open.last().low, low);
+                open.last().high = std::max(open.last().high, high);
+            }
+            
+            if (low == high)
+                ipd[pos] = low;
+            else if (open.isEmpty() || !regions[open.last().region].merges) {
+                structured = false;
+                break;
+            } else {
+                ipd[pos] = regions[open.last().region].end;
+                open.last().used = true;
+            }
+            if (ipd[pos] != pos + length)
+                jumps.append(pos);
+            
+            // Loop indication
+            loopsBefore[pos] = loops;
+            if (markLoop(vPC, pos, opcode))
+                loops++;
+            
+            pos += length;
+        }
+        while (structured && !open.isEmpty())
+            structured = closeRegion(regions, open);
         
+        if (!structured) {
+            destroyGraph();
+            return false;
+        }
+        
+        loopsBefore[count - 1] = loops;
+        for (size_t i = 0; i < jumps.size(); i++) {
+            int pos = jumps[i];
+            if (pos && ipd[pos])
+                containsLoop[pos] = checkLoop(codeBlock, interpreter, pos, ipd[pos]);
+        }
+        return true;
+    }
+    
+    void FlowGraph::destroyGraph() {
+        delete[] edges;
+        delete[] preorder;
+        delete[] postorder;
+        delete[] vertex;
+        delete[] parent;
+        delete[] blockStart;
+        delete[] blockEnd;
+        delete[] loop;
+        delete[] loopsBefore;
+        edges = 0;
+        preorder = postorder = vertex = parent = 0;
+        blockStart = blockEnd = loopsBefore = 0;
+        loop = 0;
+    }
+    
+    // Block whose first instruction is pos; pos must be a leader or the SEN.
+    int FlowGraph::blockAt(int pos) {
+        int low = 1;
+        int high = blocks - 1;
+        while (low < high) {
+            int middle = low + (high - low) / 2;
+            if (blockStart[middle] < pos)
+                low = middle + 1;
+            else
+                high = middle;
+        }
+        ASSERT(blockStart[low] == pos);
+        return low;
     }
     
     void FlowGraph::add_edge(int from, int to) {
@@ -409,32 +695,36 @@ add_edge(pos, pos + *iter); \
     
     void FlowGraph::dfs() {
         n = 1;
+        int finished = 1;
+        
+        // nextSuccessor[v] is the index of the next edge of v to follow
+        // while v is on the stack.
+        WTF::Vector<size_t> nextSuccessor(blocks);
+        WTF::Vector<int> stack;
+        
         // Going in reverse to make post-dominator
-        dfs(count - 1);
-    }
-    
-    
-    void FlowGraph::dfs(int v) {
-        vertex[n] = label[v] = v;
-        semi[v] = n++;
-        ancestor[v] = child[v] = 0;
-        size[v] = 1;
-        for (size_t i = 0; i < edges[v].successor.size(); i++) {
-            int w = edges[v].successor.at(i);
-            if(semi[w] == 0) {
-                parent[w] = v;
-                dfs(w);
+        int root = exitNode();
+        vertex[n] = root;
+        preorder[root] = n++;
+        nextSuccessor[root] = 0;
+        stack.append(root);
+        while (!stack.isEmpty()) {
+            int v = stack.last();
+            if (nextSuccessor[v] == edges[v].successor.size()) {
+                postorder[v] = finished++;
+                stack.removeLast();
+                continue;
             }
+            int w = edges[v].successor.at(nextSuccessor[v]++);
             edges[w].predecessor.append(v);
+            if (preorder[w] == 0) {
+                parent[w] = v;
+                vertex[n] = w;
+                preorder[w] = n++;
+                nextSuccessor[w] = 0;
+                stack.append(w);
+            }
         }
-        
-        //        for (int w : edges[v].successor) {
-        //            if(semi[w] == 0) {
-        //                parent[w] = v;
-        //                dfs(w);
-        //            }
-        //            edges[w].predecessor.append(v);
-        //        }
     }
     
     
@@ -455,7 +745,10 @@ add_edge(pos, pos + *iter); \
     void FlowGraph::dump_tree() {
         printf("\nCFG has\n");
         
-        for(int i = 0; i < count; i++ ) {
+        for(int i = 1; i < blocks; i++ ) {
+            printf("block %d: [%d, %d]\n", i, blockStart[i], blockEnd[i]);
+        }
+        for(int i = 0; i < blocks; i++ ) {
             // Abhi - Changing to depict the CFG edges -- Included it inside the for loop
             //            printf("%d:\t", i);
             for(size_t w = 0; w < edges[i].successor.size(); w++) {
@@ -476,33 +769,22 @@ add_edge(pos, pos + *iter); \
     }
     
     
-    void FlowGraph::dump_semi() {
-        printf("semi has\n");
-        for (int i=0; i<count; i++) {
-            if (semi[i]) printf("%d\t%d\n", i, semi[i]);
+    void FlowGraph::dump_preorder() {
+        printf("preorder has\n");
+        for (int i=0; i<blocks; i++) {
+            if (preorder[i]) printf("%d\t%d\n", i, preorder[i]);
         }
     }
     
     bool FlowGraph::checkLoop(CodeBlock* codeBlock, Interpreter* interpreter, int pos, int idom)
     {
-        // Set contains loop
-        Instruction* begin = codeBlock->instructions().begin();
-        Instruction* vPC;
-        Instruction* end;
-        if (pos <= idom) {
-            vPC = begin + pos;
-            end = begin + idom;
-        }
-        else {
-            vPC = begin + idom;
-            end = begin + pos;
-        }
-        // Get number of instructions
-        count = (int) (codeBlock->instructions().end() - codeBlock->instructions().begin()) + 1;
+        // Set contains loop: a jump at the start of the range with a loop
+        // opcode anywhere in [start, end)
+        int start = pos <= idom ? pos : idom;
+        int end = pos <= idom ? idom : pos;
         
-        int opcode = interpreter->getOpcodeID(vPC->u.opcode);
-        int length = opcodeLengths[opcode];
-        switch (opcode) {
+        Instruction* begin = codeBlock->instructions().begin();
+        switch (interpreter->getOpcodeID(begin[start].u.opcode)) {
             case op_jmp:
             case op_jtrue:
             case op_jfalse:
@@ -518,28 +800,40 @@ add_edge(pos, pos + *iter); \
             case op_jgreatereq:
             case op_jngreater:
             case op_jngreatereq:
-                while (vPC < end) {
-                    int opcode = interpreter->getOpcodeID(vPC->u.opcode);
-                    int pos = (long) (vPC-begin);
-                    int length = opcodeLengths[opcode];
-                    
-                    switch (opcode) {
-                        case op_loop:
-                        case op_loop_if_true:
-                        case op_loop_if_false:
-                        case op_loop_if_less:
-                        case op_loop_if_lesseq:
-                        case op_loop_if_greater:
-                        case op_loop_if_greatereq:
-                            return true;
-                        default:
-                            break;
-                    }
-                    vPC += length;
-                }
                 break;
             default:
-                break;
+                return false;
+        }
+        
+        bool containsLoop = loopsBefore[end] > loopsBefore[start];
+        if (UNLIKELY(Options::ifcCheckLoops()) && containsLoop != scanForLoop(codeBlock, interpreter, start, end)) {
+            dataLog("FlowGraph: checkLoop disagrees with a scan in CodeBlock %p: branch at %d with ipd %d has %d loop opcodes before it and %d before the ipd\n",
+                codeBlock, pos, idom, loopsBefore[start], loopsBefore[end]);
+            CRASH();
+        }
+        return containsLoop;
+    }
+    
+    // Whether a loop opcode lies in [start, end), by walking the instructions;
+    // what checkLoop() computed before the prefix counts, kept to check them.
+    bool FlowGraph::scanForLoop(CodeBlock* codeBlock, Interpreter* interpreter, int start, int end)
+    {
+        Instruction* begin = codeBlock->instructions().begin();
+        for (int pos = start; pos < end; ) {
+            int opcode = interpreter->getOpcodeID(begin[pos].u.opcode);
+            switch (opcode) {
+                case op_loop:
+                case op_loop_if_true:
+                case op_loop_if_false:
+                case op_loop_if_less:
+                case op_loop_if_lesseq:
+                case op_loop_if_greater:
+                case op_loop_if_greatereq:
+                    return true;
+                default:
+                    break;
+            }
+            pos += opcodeLengths[opcode];
         }
         return false;
     }
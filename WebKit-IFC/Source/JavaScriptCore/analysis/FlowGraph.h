@@ -25,13 +25,30 @@ namespace JSC {
     // To make includes all work properly -- we get errors if we straight-up #include CodeBlock.h
     class CodeBlock;
     class Interpreter;
+    struct Instruction;
     
+    // Target of the first handler in table order whose [start, end) range
+    // covers an offset. The handler boundaries split the code into
+    // segments, each painted with its handler once, so building is
+    // O(h log h) and a lookup is a binary search over the segments.
+    class HandlerIndex {
+    public:
+        void build(CodeBlock*);
+        int handlerFor(int pos) const; // -1 if no handler covers pos
+        
+    private:
+        WTF::Vector<unsigned> boundaries; // sorted, distinct start and end offsets
+        WTF::Vector<int> segmentTarget;   // handler of [boundaries[i], boundaries[i + 1])
+    };
+    
+    // One node per basic block. Node 0 is unused so that 0 can stay the
+    // "none" value in the post-dominator arrays; the last node is the
+    // synthetic exit node (SEN).
     class AListNode {
     public:
         AListNode();
         WTF::Vector<int> successor;
         WTF::Vector<int> predecessor;
-        WTF::Vector<int> bucket;
         
         void dump();
     };
@@ -39,40 +56,61 @@ namespace JSC {
     class FlowGraph {
         int n;
         int count;
+        int blocks;
         CodeBlock* codeBlock;
         void add_edge( int from, int to);
-        void dfs(int);
+        int blockAt(int pos);
+        int prepare(CodeBlock*, Interpreter*);
+        bool markLoop(Instruction*, int pos, int opcode);
+        bool scanForLoop(CodeBlock*, Interpreter*, int start, int end);
+        void instructionEdges(Interpreter*, Instruction*, int pos, int length, bool existsHandler, int retNode, const HandlerIndex&, WTF::Vector<int, 4>& targets);
         
         
     public:
         
         AListNode* edges;
         
-        int* semi;
-        int* label;
-        int* size;
+        // Filled by dfs(), which walks the reverse CFG from the SEN. Blocks
+        // it does not reach keep 0 in preorder[] and postorder[].
+        int* preorder;  // block -> preorder number, from 1
+        int* postorder; // block -> postorder number, from 1
+        int* vertex;    // preorder number -> block
+        int* parent;    // block -> parent in the DFS tree
         
-        int* vertex;
-        int* parent;
-        int* ancestor;
-        int* child;
+        int* blockStart; // first instruction of each block; count - 1 for the SEN
+        int* blockEnd;   // last instruction of each block, the only one that can branch
         
         bool impException; // Abhi -- Include impexception or not
         
-        // Return n-1 becuase of extra increment in last call to dfs(v)
+        // Number of blocks reached by dfs()
         int getN() { return n-1; }        
-        void dfs();
+        void dfs(); // iterative; generated code can nest deeper than the native stack
         FlowGraph();
         void createGraph(CodeBlock* cb, Interpreter*, bool);
+        // For code without exception handlers: fills ipd[] and
+        // containsLoop[] from the CodeBlock's merge regions (see
+        // MergeRegion.h) in one pass, with no CFG. A branch's IPD is the
+        // end of the innermost region around it, which post-dominates it
+        // as long as nothing else leaves the region. False, keeping
+        // nothing, if some region is left early or a branch has none;
+        // createGraph() and the dominator computation are needed then.
+        bool structuredIPDs(CodeBlock*, Interpreter*, int* ipd, bool* containsLoop);
+        // Instructions that can run right after the one at pos, for code
+        // without exception handlers; returns and the SEN are left out.
+        void successors(CodeBlock*, Interpreter*, int pos, WTF::Vector<int, 4>& targets);
+        void destroyGraph();
         CodeBlock* code_block() { return codeBlock; }
         int Count() { return count; } // IFC4BC - removed -1 as added another exception node
+        int Blocks() { return blocks; } // including the unused node 0 and the SEN
+        int exitNode() { return blocks - 1; }
         
         bool* loop; // indicating whether loop or not
-        bool checkLoop (CodeBlock* cb, Interpreter*, int, int); // whether the branch contains loop or not
+        int* loopsBefore; // number of loop opcodes before each instruction, count - 1 for all
+        bool checkLoop (CodeBlock* cb, Interpreter*, int, int); // whether the branch contains loop or not, O(1)
         
         void dump_tree();
         void dump_vertex();
-        void dump_semi();
+        void dump_preorder();
     };
     
 }
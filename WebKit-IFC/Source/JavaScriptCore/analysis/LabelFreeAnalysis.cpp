@@ -0,0 +1,423 @@
+/*
+ *  LabelFreeAnalysis.cpp
+ *  JavaScriptCore
+ *
+ */
+
+#include "config.h"
+#include "LabelFreeAnalysis.h"
+
+#include "CodeBlock.h"
+#include "FlowGraph.h"
+#include "Instruction.h"
+#include "Interpreter.h"
+#include "Opcode.h"
+#include "RegisterFile.h"
+#include <algorithm>
+#include <wtf/Vector.h>
+
+namespace JSC {
+
+    namespace {
+
+        class Analysis {
+        public:
+            Analysis(CodeBlock* codeBlock, Interpreter* interpreter, int count, const int* idom)
+                : m_codeBlock(codeBlock)
+                , m_interpreter(interpreter)
+                , m_begin(codeBlock->instructions().begin())
+                , m_count(count)
+                , m_idom(idom)
+                , m_firstSlot(RegisterFile::CallFrameHeaderSize + codeBlock->numParameters())
+                , m_slots(m_firstSlot + codeBlock->m_numCalleeRegisters)
+            {
+            }
+
+            void run(WTF::BitVector& labelFree);
+
+        private:
+            typedef WTF::Vector<bool> State; // per slot: label-free
+
+            OpcodeID opcodeAt(int pos) { return m_interpreter->getOpcodeID(m_begin[pos].u.opcode); }
+            int operand(int pos, int i) { return m_begin[pos + i].u.operand; }
+
+            // Locals from 0, the arguments below the call frame header
+            int slot(int r) { return r + m_firstSlot; }
+            bool isHeader(int r) { return r < 0 && r >= -RegisterFile::CallFrameHeaderSize; }
+
+            bool isFree(const State& state, int r)
+            {
+                if (m_codeBlock->isConstantRegisterIndex(r))
+                    return true;
+                if (isHeader(r) || slot(r) < 0 || slot(r) >= m_slots)
+                    return false;
+                return state[slot(r)];
+            }
+
+            void setFree(State& state, int r, bool value)
+            {
+                if (isHeader(r) || slot(r) < 0 || slot(r) >= m_slots)
+                    return;
+                state[slot(r)] = value;
+            }
+
+            // dst = pc joined with the sources; label-free if dst and the
+            // sources were.
+            bool assign(State& state, int dst, int src1, int src2)
+            {
+                bool result = isFree(state, dst) && isFree(state, src1) && isFree(state, src2);
+                setFree(state, dst, result);
+                return result;
+            }
+
+            void clearFrom(State& state, int r)
+            {
+                for (int s = std::max(slot(r), 0); s < m_slots; s++)
+                    state[s] = false;
+            }
+
+            void clear(State& state) { clearFrom(state, -m_firstSlot); }
+
+            bool transfer(int pos, State&);
+            void taint(int ipd);
+            void findBlocks();
+            void meet(int block, const State&);
+
+            CodeBlock* m_codeBlock;
+            Interpreter* m_interpreter;
+            Instruction* m_begin;
+            int m_count;
+            const int* m_idom;
+            int m_firstSlot;
+            int m_slots;
+
+            FlowGraph m_graph;
+            WTF::Vector<int> m_blockStart;
+            WTF::Vector<int> m_blockOf;           // instruction -> block, -1 inside one
+            WTF::BitVector m_clearAt;             // blocks starting at the IPD of a tainted branch
+            WTF::Vector<State> m_in;
+            WTF::Vector<bool> m_reached;
+            WTF::Vector<int> m_worklist;
+        };
+
+        // Updates state past the instruction at pos; true if the
+        // instruction is label-free.
+        bool Analysis::transfer(int pos, State& state)
+        {
+            OpcodeID opcode = opcodeAt(pos);
+            switch (opcode) {
+            // The unlabelled mov copies the source's label, so a constant
+            // source (labelled bottom) leaves it labelled.
+            case op_mov:
+                return assign(state, operand(pos, 1), operand(pos, 2), operand(pos, 2)) && !m_codeBlock->isConstantRegisterIndex(operand(pos, 2));
+
+            case op_pre_inc:
+            case op_pre_dec:
+                return isFree(state, operand(pos, 1));
+
+            case op_post_inc:
+            case op_post_dec:
+                return assign(state, operand(pos, 1), operand(pos, 2), operand(pos, 2));
+
+            case op_add:
+            case op_sub:
+            case op_mul:
+            case op_less:
+            case op_lesseq:
+            case op_greater:
+            case op_greatereq:
+                return assign(state, operand(pos, 1), operand(pos, 2), operand(pos, 3));
+
+            // Label dst like the marked opcodes, but are not marked
+            case op_not:
+            case op_typeof:
+            case op_negate:
+                assign(state, operand(pos, 1), operand(pos, 2), operand(pos, 2));
+                return false;
+            case op_eq:
+            case op_neq:
+            case op_stricteq:
+            case op_nstricteq:
+            case op_div:
+            case op_mod:
+            case op_lshift:
+            case op_rshift:
+            case op_urshift:
+            case op_bitand:
+            case op_bitxor:
+            case op_bitor:
+                assign(state, operand(pos, 1), operand(pos, 2), operand(pos, 3));
+                return false;
+            case op_new_object:
+            case op_new_array:
+            case op_new_array_buffer:
+                return false;
+
+            // Write dst with a label the analysis does not follow
+            case op_create_this:
+            case op_convert_this:
+            case op_init_lazy_reg:
+            case op_new_regexp:
+            case op_mov_empty:
+            case op_eq_null:
+            case op_neq_null:
+            case op_to_jsnumber:
+            case op_instanceof:
+            case op_is_undefined:
+            case op_is_boolean:
+            case op_is_number:
+            case op_is_string:
+            case op_is_object:
+            case op_is_function:
+            case op_in:
+            case op_resolve:
+            case op_resolve_skip:
+            case op_resolve_global:
+            case op_resolve_global_dynamic:
+            case op_get_scoped_var:
+            case op_get_global_var:
+            case op_get_global_var_watchable:
+            case op_resolve_base:
+            case op_get_by_id:
+            case op_get_by_id_out_of_line:
+            case op_get_by_id_self:
+            case op_get_by_id_proto:
+            case op_get_by_id_chain:
+            case op_get_by_id_getter_self:
+            case op_get_by_id_getter_proto:
+            case op_get_by_id_getter_chain:
+            case op_get_by_id_custom_self:
+            case op_get_by_id_custom_proto:
+            case op_get_by_id_custom_chain:
+            case op_get_by_id_generic:
+            case op_get_array_length:
+            case op_get_string_length:
+            case op_get_arguments_length:
+            case op_del_by_id:
+            case op_get_by_val:
+            case op_get_argument_by_val:
+            case op_get_by_pname:
+            case op_del_by_val:
+            case op_new_func:
+            case op_new_func_exp:
+            case op_call_put_result:
+            case op_strcat:
+            case op_to_primitive:
+            case op_push_new_scope:
+                setFree(state, operand(pos, 1), false);
+                return false;
+            case op_resolve_with_base:
+            case op_resolve_with_this:
+                setFree(state, operand(pos, 1), false);
+                setFree(state, operand(pos, 2), false);
+                return false;
+
+            // Write nothing in this frame
+            case op_enter:
+            case op_ensure_property_exists:
+            case op_check_has_instance:
+            case op_put_scoped_var:
+            case op_put_global_var:
+            case op_put_global_var_check:
+            case op_put_by_id:
+            case op_put_by_id_out_of_line:
+            case op_put_by_id_transition:
+            case op_put_by_id_transition_direct:
+            case op_put_by_id_transition_direct_out_of_line:
+            case op_put_by_id_transition_normal:
+            case op_put_by_id_transition_normal_out_of_line:
+            case op_put_by_id_replace:
+            case op_put_by_id_generic:
+            case op_put_by_val:
+            case op_put_by_index:
+            case op_put_getter_setter:
+            case op_jmp:
+            case op_jmp_scopes:
+            case op_loop:
+            case op_loop_hint:
+            case op_push_scope:
+            case op_pop_scope:
+            case op_method_check:
+            case op_debug:
+            case op_profile_will_call:
+            case op_profile_did_call:
+            case op_ret:
+            case op_ret_object_or_this:
+            case op_end:
+            case op_throw:
+            case op_throw_reference_error:
+                return false;
+
+            // The callee's frame starts at the arguments
+            case op_call:
+            case op_call_eval:
+            case op_construct:
+                clearFrom(state, operand(pos, 3) - RegisterFile::CallFrameHeaderSize - operand(pos, 2));
+                return false;
+
+            // Conditional branches: a tainted condition may raise the pc.
+            case op_jtrue:
+            case op_jfalse:
+            case op_loop_if_true:
+            case op_loop_if_false:
+            case op_jeq_null:
+            case op_jneq_null:
+            case op_jempty:
+            case op_jneq_ptr:
+                if (!isFree(state, operand(pos, 1)))
+                    break;
+                return false;
+            case op_jless:
+            case op_jlesseq:
+            case op_jgreater:
+            case op_jgreatereq:
+            case op_jnless:
+            case op_jnlesseq:
+            case op_jngreater:
+            case op_jngreatereq:
+            case op_loop_if_less:
+            case op_loop_if_lesseq:
+            case op_loop_if_greater:
+            case op_loop_if_greatereq:
+                if (!isFree(state, operand(pos, 1)) || !isFree(state, operand(pos, 2)))
+                    break;
+                return false;
+            case op_switch_imm:
+            case op_switch_char:
+            case op_switch_string:
+                if (!isFree(state, operand(pos, 3)))
+                    break;
+                return false;
+            case op_get_pnames:
+            case op_next_pname:
+                break;
+
+            default:
+                clear(state);
+                return false;
+            }
+
+            // A tainted branch
+            clear(state);
+            if (m_idom[pos] >= 0 && m_idom[pos] < m_count - 1)
+                taint(m_idom[pos]);
+            return false;
+        }
+
+        // The pc drops back at a tainted branch's IPD, which may have been
+        // reached already.
+        void Analysis::taint(int ipd)
+        {
+            if (m_clearAt.quickGet(ipd))
+                return;
+            m_clearAt.quickSet(ipd);
+            int block = m_blockOf[ipd];
+            if (!m_reached[block])
+                return;
+            clear(m_in[block]);
+            m_worklist.append(block);
+        }
+
+        void Analysis::findBlocks()
+        {
+            WTF::BitVector leaders;
+            leaders.ensureSize(m_count);
+            leaders.quickSet(0);
+            WTF::Vector<int, 4> targets;
+            for (int pos = 0; pos < m_count - 1; pos += opcodeLengths[opcodeAt(pos)]) {
+                int next = pos + opcodeLengths[opcodeAt(pos)];
+                m_graph.successors(m_codeBlock, m_interpreter, pos, targets);
+                if (targets.size() != 1 || targets[0] != next) {
+                    for (size_t i = 0; i < targets.size(); i++)
+                        leaders.quickSet(targets[i]);
+                    leaders.quickSet(next);
+                    if (m_idom[pos] >= 0 && m_idom[pos] < m_count - 1)
+                        leaders.quickSet(m_idom[pos]);
+                }
+            }
+
+            m_blockOf.fill(-1, m_count);
+            for (int pos = 0; pos < m_count - 1; pos += opcodeLengths[opcodeAt(pos)]) {
+                if (leaders.quickGet(pos)) {
+                    m_blockOf[pos] = m_blockStart.size();
+                    m_blockStart.append(pos);
+                }
+            }
+            m_blockStart.append(m_count - 1);
+        }
+
+        void Analysis::meet(int block, const State& state)
+        {
+            State& in = m_in[block];
+            bool changed = false;
+            if (!m_reached[block]) {
+                m_reached[block] = true;
+                in = state;
+                if (m_clearAt.get(m_blockStart[block]))
+                    clear(in);
+                changed = true;
+            } else {
+                for (int s = 0; s < m_slots; s++) {
+                    if (in[s] && !state[s]) {
+                        in[s] = false;
+                        changed = true;
+                    }
+                }
+            }
+            if (changed)
+                m_worklist.append(block);
+        }
+
+        void Analysis::run(WTF::BitVector& labelFree)
+        {
+            findBlocks();
+            size_t blocks = m_blockStart.size() - 1;
+            m_in.resize(blocks);
+            m_reached.fill(false, blocks);
+            m_clearAt.ensureSize(m_count);
+
+            State entry;
+            entry.fill(true, m_slots);
+            for (int r = -RegisterFile::CallFrameHeaderSize; r < 0; r++)
+                setFree(entry, r, false);
+            meet(0, entry);
+
+            WTF::Vector<int, 4> targets;
+            while (!m_worklist.isEmpty()) {
+                int block = m_worklist.last();
+                m_worklist.removeLast();
+                State state = m_in[block];
+                int last = m_blockStart[block];
+                for (int pos = last; pos < m_blockStart[block + 1]; pos += opcodeLengths[opcodeAt(pos)]) {
+                    transfer(pos, state);
+                    last = pos;
+                }
+                m_graph.successors(m_codeBlock, m_interpreter, last, targets);
+                for (size_t i = 0; i < targets.size(); i++)
+                    meet(m_blockOf[targets[i]], state);
+            }
+
+            // Mark with the final states
+            for (size_t block = 0; block < blocks; block++) {
+                if (!m_reached[block])
+                    continue;
+                State state = m_in[block];
+                for (int pos = m_blockStart[block]; pos < m_blockStart[block + 1]; pos += opcodeLengths[opcodeAt(pos)]) {
+                    if (transfer(pos, state))
+                        labelFree.quickSet(pos);
+                }
+            }
+        }
+
+    }
+
+    void LabelFreeAnalysis::compute(CodeBlock* codeBlock, Interpreter* interpreter, int count, const int* idom, WTF::BitVector& labelFree)
+    {
+        labelFree.clearAll();
+        if (codeBlock->needsActivation() || codeBlock->usesArguments() || codeBlock->usesEval() || codeBlock->numberOfExceptionHandlers())
+            return;
+        labelFree.ensureSize(count);
+        Analysis(codeBlock, interpreter, count, idom).run(labelFree);
+    }
+
+}
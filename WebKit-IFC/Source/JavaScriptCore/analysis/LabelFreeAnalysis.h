@@ -0,0 +1,46 @@
+/*
+ *  LabelFreeAnalysis.h
+ *  JavaScriptCore
+ *
+ *  Forward dataflow over a CodeBlock's registers that finds the
+ *  instructions whose labelled path cannot change anything: every
+ *  register they write, and every register they read, carries exactly
+ *  the pc label on all paths. A register is label-free from op_enter,
+ *  which labels the locals with the pc (the arguments are assumed to
+ *  carry the caller's pc), until something other than a label-free value
+ *  is written to it. A branch on a register that is not label-free may
+ *  raise the pc, so it clears every register, and so does its IPD, where
+ *  the pc drops again. Calls clear the registers of the callee's frame.
+ *
+ *  Only the common arithmetic, comparison, increment and move opcodes
+ *  are marked. Code that uses an activation, the arguments object, eval
+ *  or exception handlers is left unmarked, since its registers can be
+ *  written behind the bytecode's back.
+ *
+ *  The marks are a prediction, not a proof: the interpreter still checks
+ *  the labels before taking the unlabelled path (see
+ *  Interpreter::isLabelFree), since a register labelled before labelReq
+ *  was set, or an argument, may carry another label.
+ *
+ */
+
+#ifndef LabelFreeAnalysis_h
+#define LabelFreeAnalysis_h
+
+#include <wtf/BitVector.h>
+
+namespace JSC {
+
+    class CodeBlock;
+    class Interpreter;
+
+    class LabelFreeAnalysis {
+    public:
+        // Sets the bit of each label-free instruction; idom is the
+        // StaticAnalyzer's IPD table, count is instructions().size() + 1.
+        static void compute(CodeBlock*, Interpreter*, int count, const int* idom, WTF::BitVector& labelFree);
+    };
+
+}
+
+#endif // LabelFreeAnalysis_h
@@ -0,0 +1,352 @@
+/*
+ *  PostDominators.cpp
+ *  JavaScriptCore
+ *
+ *  Lengauer-Tarjan adapted from "A Fast Algorithm for Finding Dominators
+ *  in a Flowgraph", Thomas Lengauer and Robert Endre Tarjan.
+ *  Semi-NCA from "Finding Dominators in Practice", Loukas Georgiadis,
+ *  Robert E. Tarjan and Renato F. Werneck.
+ *  Cooper-Harvey-Kennedy from "A Simple, Fast Dominance Algorithm", Keith
+ *  D. Cooper, Timothy J. Harvey and Ken Kennedy.
+ *
+ *  All three run on the reverse CFG, so the dominators they find are
+ *  post-dominators of the original graph.
+ *
+ */
+
+#include "config.h"
+#include "PostDominators.h"
+
+#include "FlowGraph.h"
+#include "Options.h"
+#include <string.h>
+#include <wtf/Assertions.h>
+#include <wtf/DataLog.h>
+#include <wtf/Vector.h>
+
+namespace JSC {
+
+    namespace {
+
+        class LengauerTarjan {
+        public:
+            LengauerTarjan(FlowGraph& graph)
+                : m_graph(graph)
+                , m_semi(graph.Blocks())
+                , m_label(graph.Blocks())
+                , m_ancestor(graph.Blocks())
+                , m_child(graph.Blocks())
+                , m_size(graph.Blocks())
+                , m_bucket(graph.Blocks())
+            {
+                for (int v = 0; v < graph.Blocks(); v++) {
+                    m_semi[v] = graph.preorder[v];
+                    m_label[v] = graph.preorder[v] ? v : 0;
+                    m_size[v] = graph.preorder[v] ? 1 : 0;
+                }
+            }
+
+            void run(int* idom)
+            {
+                FlowGraph& graph = m_graph;
+                for (int i = graph.getN(); i >= 2; i--) {
+                    int w = graph.vertex[i];
+                    for (size_t v = 0; v < graph.edges[w].predecessor.size(); v++) {
+                        int u = eval(graph.edges[w].predecessor.at(v));
+                        if (m_semi[u] < m_semi[w])
+                            m_semi[w] = m_semi[u];
+                    }
+                    // add w to bucket(vertex(semi(w)))
+                    m_bucket[graph.vertex[m_semi[w]]].append(w);
+
+                    int p = graph.parent[w];
+                    link(p, w);
+                    for (size_t j = 0; j < m_bucket[p].size(); j++) {
+                        int v = m_bucket[p].at(j);
+                        int u = eval(v);
+                        if (m_semi[u] < m_semi[v])
+                            idom[v] = u;
+                        else
+                            idom[v] = p;
+                    }
+                    m_bucket[p].clear();
+                }
+
+                for (int i = 2; i <= graph.getN(); i++) {
+                    int w = graph.vertex[i];
+                    if (idom[w] != graph.vertex[m_semi[w]])
+                        idom[w] = idom[idom[w]];
+                }
+            }
+
+        private:
+            int eval(int v)
+            {
+                if (m_ancestor[v] == 0)
+                    return m_label[v];
+                compress(v);
+                if (m_semi[m_label[m_ancestor[v]]] >= m_semi[m_label[v]])
+                    return m_label[v];
+                return m_label[m_ancestor[v]];
+            }
+
+            void link(int v, int w)
+            {
+                int s = w;
+                while (m_semi[m_label[w]] < m_semi[m_label[m_child[s]]]) {
+                    if (m_size[s] + m_size[m_child[m_child[s]]] >= 2 * m_size[m_child[s]]) {
+                        m_ancestor[m_child[s]] = s;
+                        m_child[s] = m_child[m_child[s]];
+                    } else {
+                        m_size[m_child[s]] = m_size[s];
+                        s = m_ancestor[s] = m_child[s];
+                    }
+                }
+                m_label[s] = m_label[w];
+                m_size[v] = m_size[v] + m_size[w];
+                if (m_size[v] < 2 * m_size[w]) {
+                    int temp = s;
+                    s = m_child[v];
+                    m_child[v] = temp;
+                }
+                while (s != 0) {
+                    m_ancestor[s] = v;
+                    s = m_child[s];
+                }
+            }
+
+            // Walks up to the root of v's tree, then compresses top down.
+            void compress(int v)
+            {
+                m_path.shrink(0);
+                for (int x = v; m_ancestor[m_ancestor[x]] != 0; x = m_ancestor[x])
+                    m_path.append(x);
+                while (!m_path.isEmpty()) {
+                    int x = m_path.last();
+                    m_path.removeLast();
+                    int a = m_ancestor[x];
+                    if (m_semi[m_label[a]] < m_semi[m_label[x]])
+                        m_label[x] = m_label[a];
+                    m_ancestor[x] = m_ancestor[a];
+                }
+            }
+
+            FlowGraph& m_graph;
+            Vector<int> m_semi;
+            Vector<int> m_label;
+            Vector<int> m_ancestor;
+            Vector<int> m_child;
+            Vector<int> m_size;
+            Vector<Vector<int> > m_bucket;
+            Vector<int> m_path;
+        };
+
+        class SemiNCA {
+        public:
+            SemiNCA(FlowGraph& graph)
+                : m_graph(graph)
+                , m_semi(graph.Blocks())
+                , m_label(graph.Blocks())
+                , m_ancestor(graph.Blocks())
+            {
+                for (int v = 0; v < graph.Blocks(); v++) {
+                    m_semi[v] = graph.preorder[v];
+                    m_label[v] = v;
+                }
+            }
+
+            void run(int* idom)
+            {
+                FlowGraph& graph = m_graph;
+                for (int i = graph.getN(); i >= 2; i--) {
+                    int w = graph.vertex[i];
+                    for (size_t v = 0; v < graph.edges[w].predecessor.size(); v++) {
+                        int u = eval(graph.edges[w].predecessor.at(v));
+                        if (m_semi[u] < m_semi[w])
+                            m_semi[w] = m_semi[u];
+                    }
+                    m_ancestor[w] = graph.parent[w];
+                }
+
+                // The idom is the nearest ancestor of the parent whose
+                // preorder number is no larger than the semidominator's.
+                for (int i = 2; i <= graph.getN(); i++) {
+                    int w = graph.vertex[i];
+                    int d = graph.parent[w];
+                    while (graph.preorder[d] > m_semi[w])
+                        d = idom[d];
+                    idom[w] = d;
+                }
+            }
+
+        private:
+            int eval(int v)
+            {
+                if (m_ancestor[v] == 0)
+                    return v;
+                compress(v);
+                return m_label[v];
+            }
+
+            void compress(int v)
+            {
+                m_path.shrink(0);
+                for (int x = v; m_ancestor[m_ancestor[x]] != 0; x = m_ancestor[x])
+                    m_path.append(x);
+                while (!m_path.isEmpty()) {
+                    int x = m_path.last();
+                    m_path.removeLast();
+                    int a = m_ancestor[x];
+                    if (m_semi[m_label[a]] < m_semi[m_label[x]])
+                        m_label[x] = m_label[a];
+                    m_ancestor[x] = m_ancestor[a];
+                }
+            }
+
+            FlowGraph& m_graph;
+            Vector<int> m_semi;
+            Vector<int> m_label;
+            Vector<int> m_ancestor;
+            Vector<int> m_path;
+        };
+
+        class CooperHarveyKennedy {
+        public:
+            CooperHarveyKennedy(FlowGraph& graph)
+                : m_graph(graph)
+                , m_byPostorder(graph.getN() + 1)
+            {
+                for (int v = 0; v < graph.Blocks(); v++) {
+                    if (graph.postorder[v])
+                        m_byPostorder[graph.postorder[v]] = v;
+                }
+            }
+
+            void run(int* idom)
+            {
+                FlowGraph& graph = m_graph;
+                int root = graph.exitNode();
+                int last = graph.getN();
+                ASSERT(m_byPostorder[last] == root);
+
+                idom[root] = root;
+                bool changed = true;
+                while (changed) {
+                    changed = false;
+                    // Reverse postorder, skipping the root
+                    for (int k = last - 1; k >= 1; k--) {
+                        int b = m_byPostorder[k];
+                        int newIdom = 0;
+                        for (size_t i = 0; i < graph.edges[b].predecessor.size(); i++) {
+                            int p = graph.edges[b].predecessor.at(i);
+                            if (!idom[p])
+                                continue;
+                            newIdom = newIdom ? intersect(idom, p, newIdom) : p;
+                        }
+                        if (idom[b] != newIdom) {
+                            idom[b] = newIdom;
+                            changed = true;
+                        }
+                    }
+                }
+                idom[root] = 0;
+            }
+
+        private:
+            int intersect(int* idom, int a, int b)
+            {
+                int* postorder = m_graph.postorder;
+                while (a != b) {
+                    while (postorder[a] < postorder[b])
+                        a = idom[a];
+                    while (postorder[b] < postorder[a])
+                        b = idom[b];
+                }
+                return a;
+            }
+
+            FlowGraph& m_graph;
+            Vector<int> m_byPostorder;
+        };
+
+        void computeWith(PostDominators::Engine engine, FlowGraph& graph, int* idom)
+        {
+            memset(idom, 0, sizeof(int) * graph.Blocks());
+            switch (engine) {
+            case PostDominators::LengauerTarjan:
+                LengauerTarjan(graph).run(idom);
+                break;
+            case PostDominators::SemiNCA:
+                SemiNCA(graph).run(idom);
+                break;
+            case PostDominators::CooperHarveyKennedy:
+                CooperHarveyKennedy(graph).run(idom);
+                break;
+            default:
+                ASSERT_NOT_REACHED();
+                break;
+            }
+        }
+
+        void checkEngines(FlowGraph& graph)
+        {
+            int blocks = graph.Blocks();
+            Vector<int> expected(blocks);
+            Vector<int> actual(blocks);
+            computeWith(PostDominators::LengauerTarjan, graph, expected.data());
+            for (int engine = PostDominators::LengauerTarjan + 1; engine < PostDominators::NumberOfEngines; engine++) {
+                computeWith(static_cast<PostDominators::Engine>(engine), graph, actual.data());
+                bool mismatch = false;
+                for (int b = 0; b < blocks; b++) {
+                    if (expected[b] == actual[b])
+                        continue;
+                    dataLog("PostDominators: %s disagrees with %s in CodeBlock %p: block %d [%d, %d] has ipd %d, expected %d\n",
+                        PostDominators::engineName(static_cast<PostDominators::Engine>(engine)),
+                        PostDominators::engineName(PostDominators::LengauerTarjan),
+                        graph.code_block(), b, graph.blockStart[b], graph.blockEnd[b], actual[b], expected[b]);
+                    mismatch = true;
+                }
+                if (mismatch) {
+                    graph.dump_tree();
+                    CRASH();
+                }
+            }
+        }
+
+    }
+
+    PostDominators::Engine PostDominators::selectedEngine()
+    {
+        unsigned engine = Options::ifcPostDominators();
+        if (engine >= NumberOfEngines)
+            return SemiNCA;
+        return static_cast<Engine>(engine);
+    }
+
+    const char* PostDominators::engineName(Engine engine)
+    {
+        switch (engine) {
+        case LengauerTarjan:
+            return "Lengauer-Tarjan";
+        case SemiNCA:
+            return "Semi-NCA";
+        case CooperHarveyKennedy:
+            return "Cooper-Harvey-Kennedy";
+        default:
+            return "unknown";
+        }
+    }
+
+    void PostDominators::compute(FlowGraph& graph, int* idom)
+    {
+        if (UNLIKELY(Options::ifcCheckPostDominators()))
+            checkEngines(graph);
+        computeWith(selectedEngine(), graph, idom);
+    }
+
+    void PostDominators::compute(Engine engine, FlowGraph& graph, int* idom)
+    {
+        computeWith(engine, graph, idom);
+    }
+
+}
@@ -0,0 +1,49 @@
+/*
+ *  PostDominators.h
+ *  JavaScriptCore
+ *
+ *  Immediate post-dominators of the blocks of a FlowGraph, computed over
+ *  the reverse CFG that FlowGraph::dfs() has already walked. Three engines
+ *  are available:
+ *    0 - Lengauer-Tarjan with balanced link/eval (the original analysis)
+ *    1 - Semi-NCA: semidominators with simple path compression, then a
+ *        nearest-common-ancestor walk up the DFS tree (default)
+ *    2 - Cooper-Harvey-Kennedy: iterative dataflow in reverse postorder
+ *  None of them recurse, so the native stack use does not grow with the
+ *  size of the function.
+ *
+ *  The engine is Options::ifcPostDominators() (JSC_ifcPostDominators=<n>,
+ *  --ifcPostDominators=<n> in jsc). With Options::ifcCheckPostDominators()
+ *  every engine is run and compared against Lengauer-Tarjan; a mismatch is
+ *  logged and crashes.
+ *
+ */
+
+#ifndef PostDominators_h
+#define PostDominators_h
+
+namespace JSC {
+
+    class FlowGraph;
+
+    class PostDominators {
+    public:
+        enum Engine {
+            LengauerTarjan = 0,
+            SemiNCA = 1,
+            CooperHarveyKennedy = 2,
+            NumberOfEngines
+        };
+
+        static Engine selectedEngine();
+        static const char* engineName(Engine);
+
+        // idom[] has one slot per block. The SEN and blocks that cannot
+        // reach it get 0.
+        static void compute(FlowGraph&, int* idom);
+        static void compute(Engine, FlowGraph&, int* idom);
+    };
+
+}
+
+#endif // PostDominators_h
@@ -6,92 +6,52 @@
  *  Copyright 2011 Utah State University. All rights reserved.
  * 
  *  Rewritten by Brandon Shirley on 10/22/2011
- *  Implementation adapted from "A Fast Algorithm for Finding Dominators in a Flowgraph"
- *  by Thomas Lengauer and Robert Endre Tarjan
- *  - slight modification to produce immediate post-dominator
+ *  The post-dominator engines live in PostDominators.cpp
  *
  */
 
 #include "StaticAnalyzer.h"
+#include "AnalysisCache.h"
 #include "CodeBlock.h"
 #include "Instruction.h"
+#include "PostDominators.h"
 
 
 namespace JSC {
     
 #if STAT_TIME	
     double  StaticAnalyzer::rtime = 0;
-#endif  
     
-    // Constructor
-    StaticAnalyzer::StaticAnalyzer() {
-        graph = FlowGraph();
+    // AnalysisQueue workers and the interpreter thread all add to rtime
+    static Mutex& timeLock()
+    {
+        AtomicallyInitializedStatic(Mutex&, lock = *new Mutex);
+        return lock;
     }
     
-    
-    int StaticAnalyzer::eval(int v) {
-        if(graph.ancestor[v] == 0) return graph.label[v];
-        else {
-            compress(v);
-            if(graph.semi[graph.label[graph.ancestor[v]]] >= graph.semi[graph.label[v]])
-                return graph.label[v];
-            else return graph.label[graph.ancestor[v]];
-        }
-    }
-    
-    void StaticAnalyzer::link(int v, int w) {
-        int s = w;
-        while (graph.semi[graph.label[w]] <  graph.semi[graph.label[graph.child[s]]]) {
-            if(graph.size[s] + graph.size[graph.child[graph.child[s]]] >= 2 * graph.size[graph.child[s]]) {
-                graph.ancestor[graph.child[s]] = s;
-                graph.child[s] = graph.child[graph.child[s]];
-            } else {
-                graph.size[graph.child[s]] = graph.size[s];
-                s = graph.ancestor[s] = graph.child[s];
-            }
-        }
-        graph.label[s] = graph.label[w];
-        graph.size[v] = graph.size[v] + graph.size[w];
-        if (graph.size[v] < 2 * graph.size[w]) {
-            int temp = s;
-            s = graph.child[v];
-            graph.child[v] = temp;
-        }
-        while (s != 0) {
-            graph.ancestor[s] = v;
-            s = graph.child[s];
-        }
+    void StaticAnalyzer::addTime(clock_t start)
+    {
+        double elapsed = (clock() - start) / (double)CLOCKS_PER_SEC;
+        MutexLocker locker(timeLock());
+        rtime += elapsed;
     }
+#endif  
     
-    void StaticAnalyzer::compress(int v) {
-        if(graph.ancestor[graph.ancestor[v]] != 0) {
-            compress(graph.ancestor[v]);
-            if(graph.semi[graph.label[graph.ancestor[v]]] < graph.semi[graph.label[v]]) {
-                graph.label[v] = graph.label[graph.ancestor[v]];
-            }
-            graph.ancestor[v] = graph.ancestor[graph.ancestor[v]];
-        }
+    // Constructor
+    StaticAnalyzer::StaticAnalyzer()
+    {
+        graph = FlowGraph();
     }
     
     
-    void StaticAnalyzer::genContextTable(CodeBlock* codeBlock, Interpreter* interpreter, bool existsHandler) {
-        
-#if STAT_TIME
-        clock_t start;
-        clock_t end;
-        start = clock();
-#endif
+    // The general case: IPDs from the post-dominator tree of the CFG
+    void StaticAnalyzer::computeIPDs(CodeBlock* codeBlock, Interpreter* interpreter, bool existsHandler, int* ipd, bool* branchLoops) {
         
-        // Abhi -- to run with impException
-        graph.impException = true;
-    
-        // Generate the control flow graph (CFG)
+        // Generate the control flow graph (CFG) over basic blocks
         graph.createGraph(codeBlock, interpreter, existsHandler);
         
-        count = graph.Count();
-        idom = new int[count];
-        
-        memset(idom, 0, sizeof(int) * count);
+        int blocks = graph.Blocks();
+        int* blockIdom = new int[blocks];
         
         
         // Perform DFS
@@ -105,84 +65,112 @@ namespace JSC {
 //        graph.dump_vertex();  // Abhi -- Not needed for now
 #endif
         
-        graph.size[0] = graph.label[0] = graph.semi[0] = 0;
+        // Block post-dominators, by the engine picked in Options
+        PostDominators::compute(graph, blockIdom);
         
-        for(int i = graph.getN(); i >= 2; i--) {
-            int w = graph.vertex[i];
-            for (size_t v = 0; v < graph.edges[w].predecessor.size(); v++) {
-                int u = eval(graph.edges[w].predecessor.at(v));
-                if(graph.semi[u] < graph.semi[w]) {
-                    graph.semi[w] = graph.semi[u];
-                }
-            }
-//            for (int v : graph.edges[w].predecessor) {
-//                int u = eval(v);
-//                if(graph.semi[u] < graph.semi[w]) {
-//                    graph.semi[w] = graph.semi[u];
-//                }
-//            }
-            // add w to bucket(vertex(semi(w)))
-            graph.edges[graph.vertex[graph.semi[w]]].bucket.append(w);
-            
-            link(graph.parent[w],w);
-            int u;
-            for (size_t i = 0; i < graph.edges[graph.parent[w]].bucket.size(); i++) {
-                int v = graph.edges[graph.parent[w]].bucket.at(i);
-                u = eval(v); 
-                if(graph.semi[u] < graph.semi[v]) idom[v] = u;
-                else idom[v] = graph.parent[w];
+        // Map the block post-dominators back to instruction offsets. Inside a
+        // block each instruction is post-dominated by the next one; the last
+        // one by the first instruction of the post-dominating block. Blocks
+        // that cannot reach the exit keep 0, as do operand words.
+        Instruction* begin = codeBlock->instructions().begin();
+        for (int b = 1; b < graph.exitNode(); b++) {
+            if (!graph.preorder[b])
+                continue;
+            int last = graph.blockEnd[b];
+            for (int pos = graph.blockStart[b]; pos < last; ) {
+                int next = pos + opcodeLengths[interpreter->getOpcodeID(begin[pos].u.opcode)];
+                ipd[pos] = next;
+                pos = next;
             }
-//            for (int v : graph.edges[graph.parent[w]].bucket) {
-//                u = eval(v); 
-//                if(graph.semi[u] < graph.semi[v]) idom[v] = u;
-//                else idom[v] = graph.parent[w];
-//            }
-            graph.edges[graph.parent[w]].bucket.clear();           
+            ipd[last] = graph.blockStart[blockIdom[b]];
         }
         
-        for (int i = 2; i <= graph.getN(); i++) {
-            int w = graph.vertex[i];
-            if(idom[w] != graph.vertex[graph.semi[w]]){
-                idom[w] = idom[idom[w]];
+        // set the loop information; only block ends can branch
+        for (int b = 1; b < graph.exitNode(); b++) {
+            int i = graph.blockEnd[b];
+            if (i && ipd[i] != 0) {
+                branchLoops[i] = graph.checkLoop (codeBlock, interpreter, i, ipd[i]);
             }
         }
         
-        // Artifically set to 0 node 1
-        //idom[count-1] = 0;    //original
-        idom[0] = 1;            // artificially set, should always be "true"
+#if ADEBUG
+        // Dump DFS numbering of the blocks
+        graph.dump_preorder();
+#endif        
+        delete[] blockIdom;
+    }
     
-        // set the loop information 
-        containsLoop = new bool[count];
-        memset(containsLoop, false, sizeof(bool) * count);
-
-        for (int i = 1; i < count; i++) {
-            if (idom[i] != 0) {
-                containsLoop[i] = graph.checkLoop (codeBlock, interpreter, i, idom[i]);
+    PassRefPtr<ContextTable> StaticAnalyzer::genContextTable(CodeBlock* codeBlock, Interpreter* interpreter, bool existsHandler) {
+        
+#if STAT_TIME
+        clock_t start = clock();
+#endif
+        
+        // Tables computed for the same code on an earlier run or page
+        AnalysisCache::Key key;
+        bool cached = AnalysisCache::isEnabled();
+        if (cached) {
+            AnalysisCache::computeKey(codeBlock, interpreter, existsHandler, key);
+            AnalysisCache::Tables tables;
+            int instructions = (int) codeBlock->instructions().size() + 1;
+            if (AnalysisCache::lookup(key, instructions, tables)) {
+                RefPtr<ContextTable> table = ContextTable::create(codeBlock, interpreter, tables.count, tables.idom, tables.loop, tables.containsLoop);
+#if STAT_TIME
+                addTime(start);
+#endif
+                return table.release();
             }
         }
         
-#if ADEBUG
-        // Dump semi post-dominators
-        graph.dump_semi();
-#endif        
+        // Abhi -- to run with impException
+        graph.impException = true;
+        
+        int count = (int) codeBlock->instructions().size() + 1;
+        int* ipd = new int[count];
+        memset(ipd, 0, sizeof(int) * count);
+        bool* branchLoops = new bool[count];
+        memset(branchLoops, false, sizeof(bool) * count);
+        
+        // Structured code merges where BytecodeGenerator said it does
+        if (existsHandler || !graph.structuredIPDs(codeBlock, interpreter, ipd, branchLoops)) {
+            memset(ipd, 0, sizeof(int) * count); // a failed attempt leaves some
+            computeIPDs(codeBlock, interpreter, existsHandler, ipd, branchLoops);
+        }
+        
+        // Artifically set to 0 node 1
+        //ipd[count-1] = 0;    //original
+        ipd[0] = 1;            // artificially set, should always be "true"
+        
+        RefPtr<ContextTable> table = ContextTable::create(codeBlock, interpreter, count, ipd, graph.loop, branchLoops);
+        
 #if ADEBUG || DIDOM        
         printf("idom has\n");
         for (int i=0; i<count; i++) {
-            if (idom[i]) printf("%d\t%d\n", i, idom[i]);
+            if (ipd[i]) printf("%d\t%d\n", i, ipd[i]);
         }
         printf("\n");
+        printf("context table: %lu bytes, dense tables %lu bytes\n", (unsigned long) table->sizeInBytes(), (unsigned long) (count * (sizeof(int) + 2 * sizeof(bool))));
 #endif
         
+        if (cached) {
+            AnalysisCache::Tables tables = { count, ipd, graph.loop, branchLoops };
+            AnalysisCache::store(key, tables);
+        }
+        
+        delete[] ipd;
+        delete[] branchLoops;
+        graph.destroyGraph();
+        
 #if STAT_TIME
-        end = clock();
-        clock_t diff = end - start;
-        rtime += diff / (double)CLOCKS_PER_SEC;
+        addTime(start);
 #endif
+        return table.release();
     }
     
 #if STAT_TIME
     void StaticAnalyzer::printTime() {
         //TODO: hack, write conversion to minutes and seconds?
+        MutexLocker locker(timeLock());
         fprintf(stderr, "static\t0m%fs", rtime);
     }
 #endif
@@ -18,6 +18,7 @@
 #define StaticAnalyzer_h
 
 #include "config.h"
+#include "ContextTable.h"
 #include "FlowGraph.h"
 #include <time.h>
 
@@ -28,26 +29,19 @@ namespace JSC {
     
     class CodeBlock;
     
+    // Used once per CodeBlock and flavor; everything but the returned
+    // table is freed before genContextTable returns.
     class StaticAnalyzer {
-        int* idom;
-        int eval(int);
-        void link(int, int);
-        void compress(int);
         FlowGraph graph;
-        
-        bool* containsLoop;
-
+        void computeIPDs(CodeBlock*, Interpreter*, bool existsHandler, int* ipd, bool* branchLoops);
         
 #if STAT_TIME
-        static double   rtime;
+        static double   rtime; // summed over every thread that runs the analysis
+        static void addTime(clock_t start);
 #endif  
     public:
         StaticAnalyzer();
-        void    genContextTable(CodeBlock*, Interpreter*, bool =false);
-        int     IDom(int node) {return idom[node];} //{ printf("node: %d idom[node]: %d\n", node, idom[node]); return idom[node]; }
-        int     count;
-        bool    loop (int node) {return graph.loop[node];} // whether loop or not
-        bool    cLoop (int node) {return containsLoop[node];} // whether the branch contains loop or not
+        PassRefPtr<ContextTable> genContextTable(CodeBlock*, Interpreter*, bool =false);
 #if STAT_TIME
         static void printTime();
 #endif
@@ -30,6 +30,7 @@
 #include "config.h"
 #include "CodeBlock.h"
 
+#include "AnalysisQueue.h"
 #include "BytecodeGenerator.h"
 #include "DFGCapabilities.h"
 #include "DFGNode.h"
@@ -473,46 +474,47 @@ void CodeBlock::printStructures(const Instruction* vPC)
 {
     Interpreter* interpreter = m_globalData->interpreter;
     unsigned instructionOffset = vPC - instructions().begin();
+    OpcodeID opcodeID = interpreter->getOpcodeID(vPC[0].u.opcode);
 
-    if (vPC[0].u.opcode == interpreter->getOpcode(op_get_by_id)) {
+    if (opcodeID == op_get_by_id) {
         printStructure("get_by_id", vPC, 4);
         return;
     }
-    if (vPC[0].u.opcode == interpreter->getOpcode(op_get_by_id_self)) {
+    if (opcodeID == op_get_by_id_self) {
         printStructure("get_by_id_self", vPC, 4);
         return;
     }
-    if (vPC[0].u.opcode == interpreter->getOpcode(op_get_by_id_proto)) {
+    if (opcodeID == op_get_by_id_proto) {
         dataLog("  [%4d] %s: %s, %s\n", instructionOffset, "get_by_id_proto", pointerToSourceString(vPC[4].u.structure).utf8().data(), pointerToSourceString(vPC[5].u.structure).utf8().data());
         return;
     }
-    if (vPC[0].u.opcode == interpreter->getOpcode(op_put_by_id_transition)) {
+    if (opcodeID == op_put_by_id_transition) {
         dataLog("  [%4d] %s: %s, %s, %s\n", instructionOffset, "put_by_id_transition", pointerToSourceString(vPC[4].u.structure).utf8().data(), pointerToSourceString(vPC[5].u.structure).utf8().data(), pointerToSourceString(vPC[6].u.structureChain).utf8().data());
         return;
     }
-    if (vPC[0].u.opcode == interpreter->getOpcode(op_get_by_id_chain)) {
+    if (opcodeID == op_get_by_id_chain) {
         dataLog("  [%4d] %s: %s, %s\n", instructionOffset, "get_by_id_chain", pointerToSourceString(vPC[4].u.structure).utf8().data(), pointerToSourceString(vPC[5].u.structureChain).utf8().data());
         return;
     }
-    if (vPC[0].u.opcode == interpreter->getOpcode(op_put_by_id)) {
+    if (opcodeID == op_put_by_id) {
         printStructure("put_by_id", vPC, 4);
         return;
     }
-    if (vPC[0].u.opcode == interpreter->getOpcode(op_put_by_id_replace)) {
+    if (opcodeID == op_put_by_id_replace) {
         printStructure("put_by_id_replace", vPC, 4);
         return;
     }
-    if (vPC[0].u.opcode == interpreter->getOpcode(op_resolve_global)) {
+    if (opcodeID == op_resolve_global) {
         printStructure("resolve_global", vPC, 4);
         return;
     }
-    if (vPC[0].u.opcode == interpreter->getOpcode(op_resolve_global_dynamic)) {
+    if (opcodeID == op_resolve_global_dynamic) {
         printStructure("resolve_global_dynamic", vPC, 4);
         return;
     }
 
     // These m_instructions doesn't ref Structures.
-    ASSERT(vPC[0].u.opcode == interpreter->getOpcode(op_get_by_id_generic) || vPC[0].u.opcode == interpreter->getOpcode(op_put_by_id_generic) || vPC[0].u.opcode == interpreter->getOpcode(op_call) || vPC[0].u.opcode == interpreter->getOpcode(op_call_eval) || vPC[0].u.opcode == interpreter->getOpcode(op_construct));
+    ASSERT(opcodeID == op_get_by_id_generic || opcodeID == op_put_by_id_generic || opcodeID == op_call || opcodeID == op_call_eval || opcodeID == op_construct);
 }
 
 void CodeBlock::dump(ExecState* exec)
@@ -1578,7 +1580,8 @@ static HashSet<CodeBlock*> liveCodeBlockSet;
     macro(linkedCallerList) \
     macro(identifiers) \
     macro(functionExpressions) \
-    macro(constantRegisters)
+    macro(constantRegisters) \
+    macro(mergeRegions)
 
 #define FOR_EACH_MEMBER_VECTOR_RARE_DATA(macro) \
     macro(regexps) \
@@ -1727,6 +1730,7 @@ CodeBlock::CodeBlock(CopyParsedBlockTag, CodeBlock& other, SymbolTable* symTab)
     , m_optimizationDelayCounter(0)
     , m_reoptimizationRetryCounter(0)
     , m_lineInfo(other.m_lineInfo)
+    , m_mergeRegions(other.m_mergeRegions)
 #if ENABLE(BYTECODE_COMMENTS)
     , m_bytecodeCommentIterator(0)
 #endif
@@ -1754,6 +1758,15 @@ CodeBlock::CodeBlock(CopyParsedBlockTag, CodeBlock& other, SymbolTable* symTab)
         m_rareData->m_stringSwitchJumpTables = other.m_rareData->m_stringSwitchJumpTables;
         m_rareData->m_expressionInfo = other.m_rareData->m_expressionInfo;
     }
+
+    context = 0;
+    analysisWithSEN = false;
+    backgroundAnalysis = AnalysisQueue::NoJob;
+    labeledInstructions = other.labeledInstructions; // the instructions are shared
+    ipdMergeTraps = other.ipdMergeTraps;
+#if ENABLE(IFC_STATS)
+    ifcStats = other.ifcStats;
+#endif
 }
 
 CodeBlock::CodeBlock(ScriptExecutable* ownerExecutable, CodeType codeType, JSGlobalObject *globalObject, PassRefPtr<SourceProvider> sourceProvider, unsigned sourceOffset, SymbolTable* symTab, bool isConstructor, PassOwnPtr<CodeBlock> alternative)
@@ -1795,16 +1808,21 @@ CodeBlock::CodeBlock(ScriptExecutable* ownerExecutable, CodeType codeType, JSGlo
 #endif
     
     // ----Vineet Instrumentation ----
-    analyzer = StaticAnalyzer();
-    analyzerNOR = StaticAnalyzer();
-	has_analysis = false;
-    analyzerSEN = StaticAnalyzer();
-	has_SENanalysis = false;
+    context = 0;
+    analysisWithSEN = false;
+    backgroundAnalysis = AnalysisQueue::NoJob;
+    labeledInstructions = false;
+#if ENABLE(IFC_STATS)
+    ifcStats = 0;
+#endif
     // -------------------------
 }
 
 CodeBlock::~CodeBlock()
 {
+    // IFC4BC - a worker may still be analysing this block
+    AnalysisQueue::cancel(this);
+
 #if ENABLE(DFG_JIT)
     // Remove myself from the set of DFG code blocks. Note that I may not be in this set
     // (because I'm not a DFG code block), in which case this is a no-op anyway.
@@ -1863,50 +1881,52 @@ void CodeBlock::addParameter()
 void CodeBlock::visitStructures(SlotVisitor& visitor, Instruction* vPC)
 {
     Interpreter* interpreter = m_globalData->interpreter;
+    // IFC4BC - Decoded, since the opcode may be an op_ipd_merge trap
+    OpcodeID opcodeID = interpreter->getOpcodeID(vPC[0].u.opcode);
 
-    if (vPC[0].u.opcode == interpreter->getOpcode(op_get_by_id) && vPC[4].u.structure) {
+    if (opcodeID == op_get_by_id && vPC[4].u.structure) {
         visitor.append(&vPC[4].u.structure);
         return;
     }
 
-    if (vPC[0].u.opcode == interpreter->getOpcode(op_get_by_id_self) || vPC[0].u.opcode == interpreter->getOpcode(op_get_by_id_getter_self) || vPC[0].u.opcode == interpreter->getOpcode(op_get_by_id_custom_self)) {
+    if (opcodeID == op_get_by_id_self || opcodeID == op_get_by_id_getter_self || opcodeID == op_get_by_id_custom_self) {
         visitor.append(&vPC[4].u.structure);
         return;
     }
-    if (vPC[0].u.opcode == interpreter->getOpcode(op_get_by_id_proto) || vPC[0].u.opcode == interpreter->getOpcode(op_get_by_id_getter_proto) || vPC[0].u.opcode == interpreter->getOpcode(op_get_by_id_custom_proto)) {
+    if (opcodeID == op_get_by_id_proto || opcodeID == op_get_by_id_getter_proto || opcodeID == op_get_by_id_custom_proto) {
         visitor.append(&vPC[4].u.structure);
         visitor.append(&vPC[5].u.structure);
         return;
     }
-    if (vPC[0].u.opcode == interpreter->getOpcode(op_get_by_id_chain) || vPC[0].u.opcode == interpreter->getOpcode(op_get_by_id_getter_chain) || vPC[0].u.opcode == interpreter->getOpcode(op_get_by_id_custom_chain)) {
+    if (opcodeID == op_get_by_id_chain || opcodeID == op_get_by_id_getter_chain || opcodeID == op_get_by_id_custom_chain) {
         visitor.append(&vPC[4].u.structure);
         if (vPC[5].u.structureChain)
             visitor.append(&vPC[5].u.structureChain);
         return;
     }
-    if (vPC[0].u.opcode == interpreter->getOpcode(op_put_by_id_transition)) {
+    if (opcodeID == op_put_by_id_transition) {
         visitor.append(&vPC[4].u.structure);
         visitor.append(&vPC[5].u.structure);
         if (vPC[6].u.structureChain)
             visitor.append(&vPC[6].u.structureChain);
         return;
     }
-    if (vPC[0].u.opcode == interpreter->getOpcode(op_put_by_id) && vPC[4].u.structure) {
+    if (opcodeID == op_put_by_id && vPC[4].u.structure) {
         visitor.append(&vPC[4].u.structure);
         return;
     }
-    if (vPC[0].u.opcode == interpreter->getOpcode(op_put_by_id_replace)) {
+    if (opcodeID == op_put_by_id_replace) {
         visitor.append(&vPC[4].u.structure);
         return;
     }
-    if (vPC[0].u.opcode == interpreter->getOpcode(op_resolve_global) || vPC[0].u.opcode == interpreter->getOpcode(op_resolve_global_dynamic)) {
+    if (opcodeID == op_resolve_global || opcodeID == op_resolve_global_dynamic) {
         if (vPC[3].u.structure)
             visitor.append(&vPC[3].u.structure);
         return;
     }
 
     // These instructions don't ref their Structures.
-    ASSERT(vPC[0].u.opcode == interpreter->getOpcode(op_get_by_id) || vPC[0].u.opcode == interpreter->getOpcode(op_put_by_id) || vPC[0].u.opcode == interpreter->getOpcode(op_get_by_id_generic) || vPC[0].u.opcode == interpreter->getOpcode(op_put_by_id_generic) || vPC[0].u.opcode == interpreter->getOpcode(op_get_array_length) || vPC[0].u.opcode == interpreter->getOpcode(op_get_string_length));
+    ASSERT(opcodeID == op_get_by_id || opcodeID == op_put_by_id || opcodeID == op_get_by_id_generic || opcodeID == op_put_by_id_generic || opcodeID == op_get_array_length || opcodeID == op_get_string_length);
 }
 
 void EvalCodeCache::visitAggregate(SlotVisitor& visitor)
@@ -2499,6 +2519,7 @@ void CodeBlock::shrinkToFit(ShrinkMode shrinkMode)
     } // else don't shrink these, because we would have already pointed pointers into these tables.
 
     m_lineInfo.shrinkToFit();
+    m_mergeRegions.shrinkToFit();
     if (m_rareData) {
         m_rareData->m_exceptionHandlers.shrinkToFit();
         m_rareData->m_regexps.shrinkToFit();
@@ -49,6 +49,7 @@
 #include "ExpressionRangeInfo.h"
 #include "GlobalResolveInfo.h"
 #include "HandlerInfo.h"
+#include "IFCStats.h"
 #include "MethodCallLinkInfo.h"
 #include "Options.h"
 #include "Instruction.h"
@@ -59,6 +60,7 @@
 #include "LLIntCallLinkInfo.h"
 #include "LazyOperandValueProfile.h"
 #include "LineInfo.h"
+#include "MergeRegion.h"
 #include "Nodes.h"
 #include "RegExpObject.h"
 #include "StructureStubInfo.h"
@@ -66,6 +68,7 @@
 #include "UnconditionalFinalizer.h"
 #include "ValueProfile.h"
 #include "Watchpoint.h"
+#include <wtf/BitVector.h>
 #include <wtf/RefCountedArray.h>
 #include <wtf/FastAllocBase.h>
 #include <wtf/PassOwnPtr.h>
@@ -130,11 +133,24 @@ namespace JSC {
 
     public:
         // ----Vineet Instrumentation ----
-        StaticAnalyzer analyzer;
-        StaticAnalyzer analyzerNOR;
-		bool has_analysis;
-        StaticAnalyzer analyzerSEN;
-		bool has_SENanalysis;
+        // Analysis results without and with the SEN, each computed at
+        // most once; context is the one the latest entry asked for, or 0
+        // until it is computed (see Interpreter::prepareAnalysis)
+        RefPtr<ContextTable> contextNOR;
+        RefPtr<ContextTable> contextSEN;
+        ContextTable* context;
+        bool analysisWithSEN;
+        unsigned backgroundAnalysis; // AnalysisQueue::JobState for contextNOR
+        bool labeledInstructions; // see Interpreter::quickenLabeled
+        WTF::BitVector ipdMergeTraps; // see Interpreter::armIPDMerge
+        void selectAnalysis(bool withSEN)
+        {
+            analysisWithSEN = withSEN;
+            context = withSEN ? contextSEN.get() : contextNOR.get();
+        }
+#if ENABLE(IFC_STATS)
+        IFCStats::Entry* ifcStats; // owned by IFCStats, set on the first counted event
+#endif
         // JSLabel contextLabel;
         // -------------------------
         
@@ -784,6 +800,16 @@ namespace JSC {
             }
         }
 
+        // IFC4BC - regions are added in the order their constructs begin
+        size_t addMergeRegion(unsigned start, bool merges)
+        {
+            MergeRegion region = { start, start, merges };
+            m_mergeRegions.append(region);
+            return m_mergeRegions.size() - 1;
+        }
+        void setMergeRegionEnd(size_t index, unsigned end) { m_mergeRegions[index].end = end; }
+        const Vector<MergeRegion>& mergeRegions() const { return m_mergeRegions; }
+
         bool hasExpressionInfo() { return m_rareData && m_rareData->m_expressionInfo.size(); }
 
 #if ENABLE(JIT)
@@ -1356,6 +1382,7 @@ namespace JSC {
         uint16_t m_reoptimizationRetryCounter;
 
         Vector<LineInfo> m_lineInfo;
+        Vector<MergeRegion> m_mergeRegions;
 #if ENABLE(BYTECODE_COMMENTS)
         Vector<Comment>  m_bytecodeComments;
         size_t m_bytecodeCommentIterator;
@@ -1544,6 +1571,14 @@ namespace JSC {
         return this[index];
     }
 
+    inline JSLabel ExecState::regLabel(int index)
+    {
+        CodeBlock* codeBlock = this->codeBlock();
+        if (codeBlock->isConstantRegisterIndex(index))
+            return reinterpret_cast<Register*>(&codeBlock->constantRegister(index))->getRegLabel();
+        return uncheckedRegLabel(index);
+    }
+
 #if ENABLE(DFG_JIT)
     inline bool ExecState::isInlineCallFrame()
     {
@@ -0,0 +1,31 @@
+/*
+ *  MergeRegion.h
+ *  JavaScriptCore
+ *
+ *  Code range of a structured construct (if, ?:, && and ||, a loop,
+ *  for-in, the call/apply fast path) as BytecodeGenerator emitted it.
+ *  Every branch in [start, end) that no inner region claims joins again
+ *  at end, which is the construct's end label. A switch dispatch gets a
+ *  region that does not merge, since its cases can fall into each other.
+ *
+ *  FlowGraph::structuredIPDs() uses these to skip the CFG when nothing
+ *  leaves a region early.
+ *
+ */
+
+#ifndef MergeRegion_h
+#define MergeRegion_h
+
+#include <stdint.h>
+
+namespace JSC {
+
+struct MergeRegion {
+    uint32_t start;
+    uint32_t end;
+    bool merges;
+};
+
+} // namespace JSC
+
+#endif // MergeRegion_h
@@ -427,6 +427,14 @@ void SamplingTool::dump(ExecState* exec)
         if (blockPercent >= 1) {
             //Instruction* code = codeBlock->instructions().begin();
             dataLog("#%d: %s:%d: %d / %lld (%.3f%%)\n", i + 1, record->m_executable->sourceURL().utf8().data(), codeBlock->lineNumberForBytecodeOffset(0), record->m_sampleCount, m_sampleCount, blockPercent);
+#if ENABLE(IFC_STATS)
+            if (IFCStats::Entry* ifcStats = codeBlock->ifcStats) {
+                dataLog("    IFC cost %llu:", static_cast<unsigned long long>(IFCStats::cost(*ifcStats)));
+                for (unsigned counter = 0; counter < IFCStats::NumberOfCounters; ++counter)
+                    dataLog(" %s %llu", IFCStats::counterName(static_cast<IFCStats::Counter>(counter)), static_cast<unsigned long long>(ifcStats->counts[counter]));
+                dataLog("\n");
+            }
+#endif
             if (i < 10) {
                 HashMap<unsigned,unsigned> lineCounts;
                 codeBlock->dump(exec);
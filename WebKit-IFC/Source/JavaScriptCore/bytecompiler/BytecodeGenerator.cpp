@@ -31,6 +31,7 @@
 #include "config.h"
 #include "BytecodeGenerator.h"
 
+#include "AnalysisQueue.h"
 #include "BatchedTransitionOptimizer.h"
 #include "Comment.h"
 #include "JSActivation.h"
@@ -203,6 +204,10 @@ JSObject* BytecodeGenerator::generate()
 
     if (m_expressionTooDeep)
         return createOutOfMemoryError(m_scopeChain->globalObject.get());
+
+    // IFC4BC - start on the IPDs before the code first runs
+    if (AnalysisQueue::isEnabled())
+        AnalysisQueue::enqueue(m_codeBlock);
     return 0;
 }
 
@@ -309,7 +314,7 @@ BytecodeGenerator::BytecodeGenerator(ProgramNode* programNode, ScopeChainNode* s
         
         JSValue value = JSFunction::create(exec, makeFunction(exec, function), scopeChain);
         // IFC4BC - Join the label of the value with current PC
-        value.setValueLabel(value.joinValueLabel(JSC::JSLabel::pcGlobalLabel));
+        value.setValueLabel(value.joinValueLabel(m_globalData->ifcContext->pcGlobalLabel));
         int index = addGlobalVar(
             function->ident(), IsVariable,
             !propertyDidExist ? IsFunctionToSpecialize : NotFunctionOrNotSpecializable);
@@ -534,6 +534,11 @@ namespace JSC {
         LabelScope* breakTarget(const Identifier&);
         LabelScope* continueTarget(const Identifier&);
 
+        // IFC4BC - structured constructs for the static analysis (see
+        // MergeRegion.h); a region ends right after its end label
+        size_t beginMergeRegion(bool merges = true) { return m_codeBlock->addMergeRegion(instructions().size(), merges); }
+        void endMergeRegion(size_t region) { m_codeBlock->setMergeRegionEnd(region, instructions().size()); }
+
         void beginSwitch(RegisterID*, SwitchInfo::SwitchType);
         void endSwitch(uint32_t clauseCount, RefPtr<Label>*, ExpressionNode**, Label* defaultLabel, int32_t min, int32_t range);
 
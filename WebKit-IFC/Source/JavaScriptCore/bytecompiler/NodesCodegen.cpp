@@ -474,6 +474,7 @@ RegisterID* CallFunctionCallDotNode::emitBytecode(BytecodeGenerator& generator,
 {
     RefPtr<Label> realCall = generator.newLabel();
     RefPtr<Label> end = generator.newLabel();
+    size_t region = generator.beginMergeRegion();
     RefPtr<RegisterID> base = generator.emitNode(m_base);
     generator.emitExpressionInfo(divot() - m_subexpressionDivotOffset, startOffset() - m_subexpressionDivotOffset, m_subexpressionEndOffset);
     RefPtr<RegisterID> function = generator.emitGetById(generator.tempDestination(dst), base.get(), m_ident);
@@ -506,6 +507,7 @@ RegisterID* CallFunctionCallDotNode::emitBytecode(BytecodeGenerator& generator,
         generator.emitCall(finalDestinationOrIgnored.get(), function.get(), callArguments, divot(), startOffset(), endOffset());
     }
     generator.emitLabel(end.get());
+    generator.endMergeRegion(region);
     return finalDestinationOrIgnored.get();
 }
 
@@ -524,6 +526,7 @@ RegisterID* ApplyFunctionCallDotNode::emitBytecode(BytecodeGenerator& generator,
 
     RefPtr<Label> realCall = generator.newLabel();
     RefPtr<Label> end = generator.newLabel();
+    size_t region = generator.beginMergeRegion();
     RefPtr<RegisterID> base = generator.emitNode(m_base);
     generator.emitExpressionInfo(divot() - m_subexpressionDivotOffset, startOffset() - m_subexpressionDivotOffset, m_subexpressionEndOffset);
     RefPtr<RegisterID> function = generator.emitGetById(generator.tempDestination(dst), base.get(), m_ident);
@@ -585,6 +588,7 @@ RegisterID* ApplyFunctionCallDotNode::emitBytecode(BytecodeGenerator& generator,
         generator.emitCall(finalDestinationOrIgnored.get(), function.get(), callArguments, divot(), startOffset(), endOffset());
     }
     generator.emitLabel(end.get());
+    generator.endMergeRegion(region);
     return finalDestinationOrIgnored.get();
 }
 
@@ -1080,6 +1084,7 @@ RegisterID* LogicalOpNode::emitBytecode(BytecodeGenerator& generator, RegisterID
 {
     RefPtr<RegisterID> temp = generator.tempDestination(dst);
     RefPtr<Label> target = generator.newLabel();
+    size_t region = generator.beginMergeRegion();
     
     generator.emitNode(temp.get(), m_expr1);
     if (m_operator == OpLogicalAnd)
@@ -1088,6 +1093,7 @@ RegisterID* LogicalOpNode::emitBytecode(BytecodeGenerator& generator, RegisterID
         generator.emitJumpIfTrue(temp.get(), target.get());
     generator.emitNode(temp.get(), m_expr2);
     generator.emitLabel(target.get());
+    generator.endMergeRegion(region);
 
     return generator.moveToDestinationIfNeeded(dst, temp.get());
 }
@@ -1127,6 +1133,7 @@ RegisterID* ConditionalNode::emitBytecode(BytecodeGenerator& generator, Register
     RefPtr<RegisterID> newDst = generator.finalDestination(dst);
     RefPtr<Label> beforeElse = generator.newLabel();
     RefPtr<Label> afterElse = generator.newLabel();
+    size_t region = generator.beginMergeRegion();
 
     if (m_logical->hasConditionContextCodegen()) {
         RefPtr<Label> beforeThen = generator.newLabel();
@@ -1144,6 +1151,7 @@ RegisterID* ConditionalNode::emitBytecode(BytecodeGenerator& generator, Register
     generator.emitNode(newDst.get(), m_expr2);
 
     generator.emitLabel(afterElse.get());
+    generator.endMergeRegion(region);
 
     return newDst.get();
 }
@@ -1465,6 +1473,7 @@ RegisterID* IfNode::emitBytecode(BytecodeGenerator& generator, RegisterID* dst)
     generator.emitDebugHook(WillExecuteStatement, firstLine(), lastLine());
     
     RefPtr<Label> afterThen = generator.newLabel();
+    size_t region = generator.beginMergeRegion();
 
     if (m_condition->hasConditionContextCodegen()) {
         RefPtr<Label> beforeThen = generator.newLabel();
@@ -1477,6 +1486,7 @@ RegisterID* IfNode::emitBytecode(BytecodeGenerator& generator, RegisterID* dst)
 
     generator.emitNode(dst, m_ifBlock);
     generator.emitLabel(afterThen.get());
+    generator.endMergeRegion(region);
 
     // FIXME: This should return the last statement executed so that it can be returned as a Completion.
     return 0;
@@ -1490,6 +1500,7 @@ RegisterID* IfElseNode::emitBytecode(BytecodeGenerator& generator, RegisterID* d
     
     RefPtr<Label> beforeElse = generator.newLabel();
     RefPtr<Label> afterElse = generator.newLabel();
+    size_t region = generator.beginMergeRegion();
 
     if (m_condition->hasConditionContextCodegen()) {
         RefPtr<Label> beforeThen = generator.newLabel();
@@ -1508,6 +1519,7 @@ RegisterID* IfElseNode::emitBytecode(BytecodeGenerator& generator, RegisterID* d
     generator.emitNode(dst, m_elseBlock);
 
     generator.emitLabel(afterElse.get());
+    generator.endMergeRegion(region);
 
     // FIXME: This should return the last statement executed so that it can be returned as a Completion.
     return 0;
@@ -1518,6 +1530,7 @@ RegisterID* IfElseNode::emitBytecode(BytecodeGenerator& generator, RegisterID* d
 RegisterID* DoWhileNode::emitBytecode(BytecodeGenerator& generator, RegisterID* dst)
 {
     RefPtr<LabelScope> scope = generator.newLabelScope(LabelScope::Loop);
+    size_t region = generator.beginMergeRegion();
 
     RefPtr<Label> topOfLoop = generator.newLabel();
     generator.emitLabel(topOfLoop.get());
@@ -1536,6 +1549,7 @@ RegisterID* DoWhileNode::emitBytecode(BytecodeGenerator& generator, RegisterID*
     }
 
     generator.emitLabel(scope->breakTarget());
+    generator.endMergeRegion(region);
     return result.get();
 }
 
@@ -1545,6 +1559,7 @@ RegisterID* WhileNode::emitBytecode(BytecodeGenerator& generator, RegisterID* ds
 {
     RefPtr<LabelScope> scope = generator.newLabelScope(LabelScope::Loop);
     RefPtr<Label> topOfLoop = generator.newLabel();
+    size_t region = generator.beginMergeRegion();
 
     generator.emitDebugHook(WillExecuteStatement, m_expr->lineNo(), m_expr->lineNo());
     if (m_expr->hasConditionContextCodegen())
@@ -1570,6 +1585,7 @@ RegisterID* WhileNode::emitBytecode(BytecodeGenerator& generator, RegisterID* ds
     }
 
     generator.emitLabel(scope->breakTarget());
+    generator.endMergeRegion(region);
     
     // FIXME: This should return the last statement executed so that it can be returned as a Completion
     return 0;
@@ -1587,6 +1603,7 @@ RegisterID* ForNode::emitBytecode(BytecodeGenerator& generator, RegisterID* dst)
         generator.emitNode(generator.ignoredResult(), m_expr1);
     
     RefPtr<Label> topOfLoop = generator.newLabel();
+    size_t region = generator.beginMergeRegion();
     if (m_expr2) {
         if (m_expr2->hasConditionContextCodegen())
             generator.emitNodeInConditionContext(m_expr2, topOfLoop.get(), scope->breakTarget(), true);
@@ -1617,6 +1634,7 @@ RegisterID* ForNode::emitBytecode(BytecodeGenerator& generator, RegisterID* dst)
         generator.emitJump(topOfLoop.get());
 
     generator.emitLabel(scope->breakTarget());
+    generator.endMergeRegion(region);
     return result.get();
 }
 
@@ -1636,6 +1654,7 @@ RegisterID* ForInNode::emitBytecode(BytecodeGenerator& generator, RegisterID* ds
 
     RefPtr<RegisterID> base = generator.newTemporary();
     generator.emitNode(base.get(), m_expr);
+    size_t region = generator.beginMergeRegion();
     RefPtr<RegisterID> i = generator.newTemporary();
     RefPtr<RegisterID> size = generator.newTemporary();
     RefPtr<RegisterID> expectedSubscript;
@@ -1694,6 +1713,7 @@ RegisterID* ForInNode::emitBytecode(BytecodeGenerator& generator, RegisterID* ds
     generator.emitNextPropertyName(propertyName, base.get(), i.get(), size.get(), iter.get(), loopStart.get());
     generator.emitDebugHook(WillExecuteStatement, firstLine(), lastLine());
     generator.emitLabel(scope->breakTarget());
+    generator.endMergeRegion(region);
     return dst;
 }
 
@@ -1923,9 +1943,11 @@ RegisterID* SwitchNode::emitBytecode(BytecodeGenerator& generator, RegisterID* d
     RefPtr<LabelScope> scope = generator.newLabelScope(LabelScope::Switch);
 
     RefPtr<RegisterID> r0 = generator.emitNode(m_expr);
+    size_t region = generator.beginMergeRegion(false);
     RegisterID* r1 = m_block->emitBytecodeForBlock(generator, r0.get(), dst);
 
     generator.emitLabel(scope->breakTarget());
+    generator.endMergeRegion(region);
     return r1;
 }
 
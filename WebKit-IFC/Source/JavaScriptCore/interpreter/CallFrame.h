@@ -24,6 +24,7 @@
 #define CallFrame_h
 
 #include "AbstractPC.h"
+#include "IFCContext.h"
 #include "JSGlobalData.h"
 #include "MacroAssemblerCodeRef.h"
 #include "RegisterFile.h"
@@ -74,6 +75,8 @@ namespace JSC  {
         const MarkedArgumentBuffer& emptyList() const { return *globalData().emptyList; }
         Interpreter* interpreter() { return globalData().interpreter; }
         Heap* heap() { return &globalData().heap; }
+        // IFC4BC - The label state of this VM; see IFCContext
+        IFCContext& ifcContext() { return *globalData().ifcContext; }
 #ifndef NDEBUG
         void dumpCaller();
 #endif
@@ -180,6 +183,33 @@ namespace JSC  {
             setReturnPC(vPC); // This is either an Instruction* or a pointer into JIT generated code stored as an Instruction*.
             setArgumentCountIncludingThis(argc); // original argument count (for the sake of the "arguments" object)
             setCallee(callee);
+            // IFC4BC - The arguments are the caller's registers; read them in its epoch
+            CallFrame* labelFrame = callerFrame->removeHostCallFrameFlag();
+            if (labelFrame)
+                setFrameLabel(labelFrame->frameLabel(), labelFrame->frameLabelEpoch());
+            else
+                setFrameLabel(JSLabel(), 0);
+        }
+
+        // IFC4BC - Register labels. Relabeling a frame (see
+        // Interpreter::labelRegisters) only gives it a new default label and
+        // epoch, kept in the label and epoch of its CodeBlock slot; a register
+        // written in an older epoch than the frame's carries the default.
+        JSLabel frameLabel() const { return this[RegisterFile::CodeBlock].getRegLabel(); }
+        uint32_t frameLabelEpoch() const { return this[RegisterFile::CodeBlock].getRegLabelEpoch(); }
+        void setFrameLabel(JSLabel label, uint32_t epoch) { registers()[RegisterFile::CodeBlock].setRegLabel(label, epoch); }
+
+        // The label of a register (or constant from the CodeBlock)
+        inline JSLabel regLabel(int);
+        // The label of a non-constant register
+        JSLabel uncheckedRegLabel(int index) const
+        {
+            const Register& reg = this[index];
+            return reg.getRegLabelEpoch() >= frameLabelEpoch() ? reg.getRegLabel() : frameLabel();
+        }
+        void setRegLabel(int index, JSLabel label)
+        {
+            registers()[index].setRegLabel(label, frameLabelEpoch());
         }
 
         // Read a register from the codeframe (or constant from the CodeBlock).
@@ -209,11 +239,39 @@ namespace JSC  {
         JSValue thisValue() { return this[thisArgumentOffset()].jsValue(); }
         void setThisValue(JSValue value) { this[thisArgumentOffset()] = value; }
 
+        // IFC4BC - The labels a host call was made with, read from its
+        // registers and joined with the pc at the call, not the live pc,
+        // which JS the host function runs first may have moved. Bottom
+        // unless this is the context's labeledHostCall.
+        JSLabel thisLabel()
+        {
+            IFCContext& context = ifcContext();
+            if (context.labeledHostCall != this)
+                return JSLabel();
+            JSLabel label = uncheckedRegLabel(thisArgumentOffset()).Join(context.hostCallPCLabel);
+            label.setStar(false);
+            return label;
+        }
+        JSLabel argumentLabel(size_t argument)
+        {
+            IFCContext& context = ifcContext();
+            if (context.labeledHostCall != this || argument >= argumentCount())
+                return JSLabel();
+            JSLabel label = uncheckedRegLabel(argumentOffset(argument)).Join(context.hostCallPCLabel);
+            label.setStar(false);
+            return label;
+        }
+
         static int offsetFor(size_t argumentCountIncludingThis) { return argumentCountIncludingThis + RegisterFile::CallFrameHeaderSize; }
 
         // FIXME: Remove these.
         int hostThisRegister() { return thisArgumentOffset(); }
-        JSValue hostThisValue() { return this[thisArgumentOffset()].jsNewValue(); }
+        JSValue hostThisValue()
+        {
+            JSValue value = this[thisArgumentOffset()].jsValue();
+            value.setValueLabel(uncheckedRegLabel(thisArgumentOffset()));
+            return value;
+        }
 
         static CallFrame* noCaller() { return reinterpret_cast<CallFrame*>(HostCallFrameFlag); }
 
@@ -30,6 +30,7 @@
 #include "config.h"
 #include "Interpreter.h"
 
+#include "AnalysisQueue.h"
 #include "Arguments.h"
 #include "BatchedTransitionOptimizer.h"
 #include "CallFrame.h"
@@ -42,6 +43,8 @@
 #include "EvalCodeCache.h"
 #include "ExceptionHelpers.h"
 #include "GetterSetter.h"
+#include "IFCStats.h"
+#include "IFCTrace.h"
 #include "JSActivation.h"
 #include "JSArray.h"
 #include "JSBoundFunction.h"
@@ -63,6 +66,7 @@
 #include "StrongInlines.h"
 #include "UStringConcatenate.h"
 #include <limits.h>
+#include <limits>
 #include <stdio.h>
 #include <wtf/Threading.h>
 #include <wtf/text/StringBuilder.h>
@@ -135,25 +139,25 @@ NEVER_INLINE bool Interpreter::resolve(CallFrame* callFrame, Instruction* vPC, J
             if (increasingContextLabel != pcstack.Head() && labelReq && (*labelReq == false))
             {
                 *labelReq = true;
-                callFrame->uncheckedR(dst).setRegLabel(pcstack.Head());
+                callFrame->setRegLabel(dst, pcstack.Head());
             }
             exceptionValue.setValueLabel(increasingContextLabel);
             if (exceptionValue)
                 return false;
-            if (JSLabel::ABORT_FLAG) {
-                JSLabel::ABORT_FLAG = false;
-                printf("Aborting in resolve %d in %p!\n", (int) (vPC - codeBlock->instructions().begin()), codeBlock);
+            if (callFrame->ifcContext().abortFlag) {
+                callFrame->ifcContext().abortFlag = false;
+                IFC_TRACE(ResolveAbort, codeBlock, vPC - codeBlock->instructions().begin(), 0, pcstack.Head().Val());
                 // return jsUndefined();
             }
             if (*labelReq) {
                 JSLabel dstLabel = JSLabel();
-                if(!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+                if(!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
                 {
                     // printf("Sensitive Upgrade at %ld in %p\n", vPC - codeBlock->instructions().begin(), codeBlock);
                     dstLabel.setStar(true);
                 }
                 callFrame->uncheckedR(dst) = JSValue(result);
-                callFrame->uncheckedR(dst).setRegLabel(dstLabel.Join(result.getValueLabel()));
+                callFrame->setRegLabel(dst, dstLabel.Join(result.getValueLabel()));
             }
             else {
                 callFrame->uncheckedR(dst) = JSValue(result);
@@ -168,7 +172,7 @@ NEVER_INLINE bool Interpreter::resolve(CallFrame* callFrame, Instruction* vPC, J
     if (increasingContextLabel != pcstack.Head() && labelReq && (*labelReq == false))
     {
         *labelReq = true;
-        callFrame->uncheckedR(dst).setRegLabel(pcstack.Head());
+        callFrame->setRegLabel(dst, pcstack.Head());
     }
     exceptionValue = createUndefinedVariableError(callFrame, ident);
     // IFC4BC - Set the exception value label
@@ -238,26 +242,26 @@ NEVER_INLINE bool Interpreter::resolveSkip(CallFrame* callFrame, Instruction* vP
             if (increasingContextLabel != pcstack.Head() && labelReq && (*labelReq == false))
             {
                 *labelReq = true;
-                callFrame->uncheckedR(dst).setRegLabel(pcstack.Head());
+                callFrame->setRegLabel(dst, pcstack.Head());
             }
             exceptionValue.setValueLabel(increasingContextLabel);
             if (exceptionValue)
                 return false;
             ASSERT(result);
-            if (JSLabel::ABORT_FLAG) {
-                JSLabel::ABORT_FLAG = false;
-                printf("Aborting in resolve skip %d in %p!\n", (int) (vPC - codeBlock->instructions().begin()), codeBlock);
+            if (callFrame->ifcContext().abortFlag) {
+                callFrame->ifcContext().abortFlag = false;
+                IFC_TRACE(ResolveAbort, codeBlock, vPC - codeBlock->instructions().begin(), 0, pcstack.Head().Val());
                 // return jsUndefined();
             }
             if (*labelReq) {
                 JSLabel dstLabel = JSLabel();
-                if(!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+                if(!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
                 {
                     // printf("Sensitive Upgrade at %ld in %p\n", vPC - codeBlock->instructions().begin(), codeBlock);
                     dstLabel.setStar(true);
                 }
                 callFrame->uncheckedR(dst) = JSValue(result);
-                callFrame->uncheckedR(dst).setRegLabel(dstLabel.Join(result.getValueLabel()));
+                callFrame->setRegLabel(dst, dstLabel.Join(result.getValueLabel()));
             }
             else {
                 callFrame->uncheckedR(dst) = JSValue(result);
@@ -271,7 +275,7 @@ NEVER_INLINE bool Interpreter::resolveSkip(CallFrame* callFrame, Instruction* vP
     if (increasingContextLabel != pcstack.Head() && labelReq && (*labelReq == false))
     {
         *labelReq = true;
-        callFrame->uncheckedR(dst).setRegLabel(pcstack.Head());
+        callFrame->setRegLabel(dst, pcstack.Head());
     }
     exceptionValue = createUndefinedVariableError(callFrame, ident);
     if (increasingContextLabel != pcstack.Head() && labelReq)
@@ -307,21 +311,21 @@ NEVER_INLINE bool Interpreter::resolveGlobal(CallFrame* callFrame, Instruction*
         // else // Pre-defined property, so making label 0.
         //    val.setValueLabel(increasingContextLabel);
         
-        if (JSLabel::ABORT_FLAG) {
-            JSLabel::ABORT_FLAG = false;
-            printf("Aborting in resolve global %d in %p!\n", (int) (vPC - codeBlock->instructions().begin()), codeBlock);
+        if (callFrame->ifcContext().abortFlag) {
+            callFrame->ifcContext().abortFlag = false;
+            IFC_TRACE(ResolveAbort, codeBlock, vPC - codeBlock->instructions().begin(), 0, pcstack.Head().Val());
             // return jsUndefined();
         }
         
         if (*labelReq) {
             JSLabel dstLabel = JSLabel(); /* val.getValueLabel() */
-            if(!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+            if(!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
             {
                 // printf("Sensitive Upgrade at %ld in %p\n", vPC - codeBlock->instructions().begin(), codeBlock);
                 dstLabel.setStar(true);
             }
             callFrame->uncheckedR(dst) = val;
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel.Join(val.getValueLabel()));
+            callFrame->setRegLabel(dst, dstLabel.Join(val.getValueLabel()));
         }
         else {
             callFrame->uncheckedR(dst) = val;
@@ -344,15 +348,15 @@ NEVER_INLINE bool Interpreter::resolveGlobal(CallFrame* callFrame, Instruction*
         //     result.setValueLabel(increasingContextLabel);
         if (increasingContextLabel != pcstack.Head() && labelReq)
             *labelReq = true;
-        if (JSLabel::ABORT_FLAG) {
-            JSLabel::ABORT_FLAG = false;
-            printf("Aborting in resolve global %d in %p!\n", (int) (vPC - codeBlock->instructions().begin()), codeBlock);
+        if (callFrame->ifcContext().abortFlag) {
+            callFrame->ifcContext().abortFlag = false;
+            IFC_TRACE(ResolveAbort, codeBlock, vPC - codeBlock->instructions().begin(), 0, pcstack.Head().Val());
             // return jsUndefined();
         }
         if (increasingContextLabel != pcstack.Head() && labelReq && (*labelReq == false))
         {
             *labelReq = true;
-            callFrame->uncheckedR(dst).setRegLabel(pcstack.Head());
+            callFrame->setRegLabel(dst, pcstack.Head());
         }
         
         if (slot.isCacheableValue() && !globalObject->structure()->isUncacheableDictionary() && slot.slotBase() == globalObject) {
@@ -361,13 +365,13 @@ NEVER_INLINE bool Interpreter::resolveGlobal(CallFrame* callFrame, Instruction*
             // IFC4BC - Assigning label for the dst reg
             if (*labelReq) {
                 JSLabel dstLabel = JSLabel(); /* result.getValueLabel() */
-                if(!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+                if(!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
                 {
                     // printf("Sensitive Upgrade at %ld in %p\n", vPC - codeBlock->instructions().begin(), codeBlock);
                     dstLabel.setStar(true);
                 }
                 callFrame->uncheckedR(dst) = result;
-                callFrame->uncheckedR(dst).setRegLabel(dstLabel.Join(result.getValueLabel()));
+                callFrame->setRegLabel(dst, dstLabel.Join(result.getValueLabel()));
             }
             else {
                 callFrame->uncheckedR(dst) = result;
@@ -381,13 +385,13 @@ NEVER_INLINE bool Interpreter::resolveGlobal(CallFrame* callFrame, Instruction*
             return false;
         if (*labelReq) {
             JSLabel dstLabel = JSLabel(); /* result.getValueLabel() */
-            if(!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+            if(!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
             {
                 // printf("Sensitive Upgrade at %ld in %p\n", vPC - codeBlock->instructions().begin(), codeBlock);
                 dstLabel.setStar(true);
             }
             callFrame->uncheckedR(dst) = JSValue(result);
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel.Join(result.getValueLabel()));
+            callFrame->setRegLabel(dst, dstLabel.Join(result.getValueLabel()));
         }
         else {
             callFrame->uncheckedR(dst) = JSValue(result);
@@ -397,7 +401,7 @@ NEVER_INLINE bool Interpreter::resolveGlobal(CallFrame* callFrame, Instruction*
     if (increasingContextLabel != pcstack.Head() && labelReq && (*labelReq == false))
     {
         *labelReq = true;
-        callFrame->uncheckedR(dst).setRegLabel(pcstack.Head());
+        callFrame->setRegLabel(dst, pcstack.Head());
     }
     exceptionValue = createUndefinedVariableError(callFrame, ident);
     // IFC4BC - Set the exception value label
@@ -462,12 +466,12 @@ NEVER_INLINE bool Interpreter::resolveGlobalDynamic(CallFrame* callFrame, Instru
                     if (increasingContextLabel != pcstack.Head() && labelReq && (*labelReq == false))
                     {
                         *labelReq = true;
-                        callFrame->uncheckedR(dst).setRegLabel(pcstack.Head());
+                        callFrame->setRegLabel(dst, pcstack.Head());
                     }
                     
-                    if (JSLabel::ABORT_FLAG) {
-                        JSLabel::ABORT_FLAG = false;
-                        printf("Aborting in resolve global dynamic %d in %p!\n", (int) (vPC - codeBlock->instructions().begin()), codeBlock);
+                    if (callFrame->ifcContext().abortFlag) {
+                        callFrame->ifcContext().abortFlag = false;
+                        IFC_TRACE(ResolveAbort, codeBlock, vPC - codeBlock->instructions().begin(), 0, pcstack.Head().Val());
                         // return jsUndefined();
                     }
                     exceptionValue = callFrame->globalData().exception;
@@ -479,13 +483,13 @@ NEVER_INLINE bool Interpreter::resolveGlobalDynamic(CallFrame* callFrame, Instru
                     // IFC4BC - Setting the label for result in case it comes in here.
                     if (*labelReq) {
                         JSLabel dstLabel = JSLabel(); /* result.getValueLabel() */
-                        if(!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+                        if(!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
                         {
                             // printf("Sensitive Upgrade at %ld in %p\n", vPC - codeBlock->instructions().begin(), codeBlock);
                             dstLabel.setStar(true);
                         }
                         callFrame->uncheckedR(dst) = JSValue(result);
-                        callFrame->uncheckedR(dst).setRegLabel(dstLabel.Join(result.getValueLabel()));
+                        callFrame->setRegLabel(dst, dstLabel.Join(result.getValueLabel()));
                     }
                     else {
                         callFrame->uncheckedR(dst) = JSValue(result);
@@ -500,7 +504,7 @@ NEVER_INLINE bool Interpreter::resolveGlobalDynamic(CallFrame* callFrame, Instru
             if (increasingContextLabel != pcstack.Head() && labelReq && (*labelReq == false))
             {
                 *labelReq = true;
-                callFrame->uncheckedR(dst).setRegLabel(pcstack.Head());
+                callFrame->setRegLabel(dst, pcstack.Head());
             }
             exceptionValue = createUndefinedVariableError(callFrame, ident);
             // IFC4BC - Set the exception value label
@@ -524,22 +528,22 @@ NEVER_INLINE bool Interpreter::resolveGlobalDynamic(CallFrame* callFrame, Instru
         if (increasingContextLabel != pcstack.Head() && labelReq && (*labelReq == false))
         {
             *labelReq = true;
-            callFrame->uncheckedR(dst).setRegLabel(pcstack.Head());
+            callFrame->setRegLabel(dst, pcstack.Head());
         }
-        if (JSLabel::ABORT_FLAG) {
-            JSLabel::ABORT_FLAG = false;
-            printf("Aborting in resolve global dynamic %d in %p!\n", (int) (vPC - codeBlock->instructions().begin()), codeBlock);
+        if (callFrame->ifcContext().abortFlag) {
+            callFrame->ifcContext().abortFlag = false;
+            IFC_TRACE(ResolveAbort, codeBlock, vPC - codeBlock->instructions().begin(), 0, pcstack.Head().Val());
             // return jsUndefined();
         }
         if (*labelReq) {
             JSLabel dstLabel = JSLabel() /*vRet.getValueLabel()*/;
-            if(!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+            if(!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
             {
                 // printf("Sensitive Upgrade at %ld in %p\n", vPC - codeBlock->instructions().begin(), codeBlock);
                 dstLabel.setStar(true);
             }
             callFrame->uncheckedR(dst) = vRet;
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel.Join(vRet.getValueLabel()));
+            callFrame->setRegLabel(dst, dstLabel.Join(vRet.getValueLabel()));
 
         }
         else {
@@ -566,11 +570,11 @@ NEVER_INLINE bool Interpreter::resolveGlobalDynamic(CallFrame* callFrame, Instru
         if (increasingContextLabel != pcstack.Head() && labelReq && (*labelReq == false))
         {
             *labelReq = true;
-            callFrame->uncheckedR(dst).setRegLabel(pcstack.Head());
+            callFrame->setRegLabel(dst, pcstack.Head());
         }
-        if (JSLabel::ABORT_FLAG) {
-            JSLabel::ABORT_FLAG = false;
-            printf("Aborting in resolve global dynamic %d in %p!\n", (int) (vPC - codeBlock->instructions().begin()), codeBlock);
+        if (callFrame->ifcContext().abortFlag) {
+            callFrame->ifcContext().abortFlag = false;
+            IFC_TRACE(ResolveAbort, codeBlock, vPC - codeBlock->instructions().begin(), 0, pcstack.Head().Val());
             // return jsUndefined();
         }
         if (slot.isCacheableValue() && !globalObject->structure()->isUncacheableDictionary() && slot.slotBase() == globalObject) {
@@ -580,13 +584,13 @@ NEVER_INLINE bool Interpreter::resolveGlobalDynamic(CallFrame* callFrame, Instru
             // IFC4BC - Assigning label for the dst reg
             if (*labelReq) {
                 JSLabel dstLabel = JSLabel(); /* result.getValueLabel() */
-                if(!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+                if(!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
                 {
                     // printf("Sensitive Upgrade at %ld in %p\n", vPC - codeBlock->instructions().begin(), codeBlock);
                     dstLabel.setStar(true);
                 }
                 callFrame->uncheckedR(dst) = result;
-                callFrame->uncheckedR(dst).setRegLabel(dstLabel.Join(result.getValueLabel()));
+                callFrame->setRegLabel(dst, dstLabel.Join(result.getValueLabel()));
             }
             else {
                 callFrame->uncheckedR(dst) = result;
@@ -602,13 +606,13 @@ NEVER_INLINE bool Interpreter::resolveGlobalDynamic(CallFrame* callFrame, Instru
         // IFC4BC - Assigning label for the dst reg
         if (*labelReq) {
             JSLabel dstLabel = JSLabel(); /* result.getValueLabel() */
-            if(!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+            if(!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
             {
                 // printf("Sensitive Upgrade at %ld in %p\n", vPC - codeBlock->instructions().begin(), codeBlock);
                 dstLabel.setStar(true);
             }
             callFrame->uncheckedR(dst) = JSValue(result);
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel.Join(result.getValueLabel()));
+            callFrame->setRegLabel(dst, dstLabel.Join(result.getValueLabel()));
         }
         else {
             callFrame->uncheckedR(dst) = JSValue(result);
@@ -619,7 +623,7 @@ NEVER_INLINE bool Interpreter::resolveGlobalDynamic(CallFrame* callFrame, Instru
     if (increasingContextLabel != pcstack.Head() && labelReq && (*labelReq == false))
     {
         *labelReq = true;
-        callFrame->uncheckedR(dst).setRegLabel(pcstack.Head());
+        callFrame->setRegLabel(dst, pcstack.Head());
     }
     exceptionValue = createUndefinedVariableError(callFrame, ident);
     // IFC4BC - Set the exception value label
@@ -647,19 +651,19 @@ NEVER_INLINE void Interpreter::resolveBase(CallFrame* callFrame, Instruction* vP
     if (contextLabel != pcstack.Head() && labelReq && (*labelReq == false))
     {
         *labelReq = true;
-        callFrame->uncheckedR(dst).setRegLabel(pcstack.Head());
+        callFrame->setRegLabel(dst, pcstack.Head());
     }
     
     if (result) {
         if (*labelReq) {
             JSLabel dstLabel = JSLabel(); /* result.getValueLabel() */
-            if(!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+            if(!noSensitiveUpgrade(callFrame->codeBlock(), callFrame->regLabel(dst)))
             {
                 // printf("Sensitive Upgrade at %ld\n", vPC - callFrame->codeBlock()->instructions().begin());
                 dstLabel.setStar(true);
             }
             callFrame->uncheckedR(dst) = result;
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel.Join(result.getValueLabel()));
+            callFrame->setRegLabel(dst, dstLabel.Join(result.getValueLabel()));
         }
         else {
             callFrame->uncheckedR(dst) = result;
@@ -710,12 +714,12 @@ NEVER_INLINE bool Interpreter::resolveBaseAndProperty(CallFrame* callFrame, Inst
             if (increasingContextLabel != pcstack.Head() && labelReq && (*labelReq == false))
             {
                 *labelReq = true;
-                callFrame->uncheckedR(propDst).setRegLabel(pcstack.Head());
-                callFrame->uncheckedR(baseDst).setRegLabel(pcstack.Head());
+                callFrame->setRegLabel(propDst, pcstack.Head());
+                callFrame->setRegLabel(baseDst, pcstack.Head());
             }
-            if (JSLabel::ABORT_FLAG) {
-                JSLabel::ABORT_FLAG = false;
-                printf("Aborting in resolve base and property %d in %p!\n", (int) (vPC - codeBlock->instructions().begin()), codeBlock);
+            if (callFrame->ifcContext().abortFlag) {
+                callFrame->ifcContext().abortFlag = false;
+                IFC_TRACE(ResolveAbort, codeBlock, vPC - codeBlock->instructions().begin(), 0, pcstack.Head().Val());
                 // return jsUndefined();
             }
             exceptionValue = callFrame->globalData().exception;
@@ -726,20 +730,20 @@ NEVER_INLINE bool Interpreter::resolveBaseAndProperty(CallFrame* callFrame, Inst
             if (*labelReq) {
                 JSLabel pdstLabel = JSLabel();
                 JSLabel bdstLabel = JSLabel();
-                if(!noSensitiveUpgrade(callFrame->r(propDst).getRegLabel()))
+                if(!noSensitiveUpgrade(codeBlock, callFrame->regLabel(propDst)))
                 {
                     // printf("Sensitive Upgrade at %ld in %p\n", vPC - codeBlock->instructions().begin(), codeBlock);
                     pdstLabel.setStar(true);
                 }
-                if(!noSensitiveUpgrade(callFrame->r(baseDst).getRegLabel()))
+                if(!noSensitiveUpgrade(codeBlock, callFrame->regLabel(baseDst)))
                 {
                     // printf("Sensitive Upgrade at %ld in %p\n", vPC - codeBlock->instructions().begin(), codeBlock);
                     bdstLabel.setStar(true);
                 }
                 callFrame->uncheckedR(propDst) = JSValue(result);
                 callFrame->uncheckedR(baseDst) = JSValue(base);
-                callFrame->uncheckedR(propDst).setRegLabel(pdstLabel.Join(result.joinValueLabel(increasingContextLabel)));
-                callFrame->uncheckedR(baseDst).setRegLabel(bdstLabel.Join(base->joinObjectLabel(increasingContextLabel)));
+                callFrame->setRegLabel(propDst, pdstLabel.Join(result.joinValueLabel(increasingContextLabel)));
+                callFrame->setRegLabel(baseDst, bdstLabel.Join(base->joinObjectLabel(increasingContextLabel)));
             }
             else {
                 callFrame->uncheckedR(propDst) = JSValue(result);
@@ -757,8 +761,8 @@ NEVER_INLINE bool Interpreter::resolveBaseAndProperty(CallFrame* callFrame, Inst
     if (increasingContextLabel != pcstack.Head() && labelReq && (*labelReq == false))
     {
         *labelReq = true;
-        callFrame->uncheckedR(propDst).setRegLabel(pcstack.Head());
-        callFrame->uncheckedR(baseDst).setRegLabel(pcstack.Head());
+        callFrame->setRegLabel(propDst, pcstack.Head());
+        callFrame->setRegLabel(baseDst, pcstack.Head());
     }
     exceptionValue = createUndefinedVariableError(callFrame, ident);
     exceptionValue.setValueLabel(increasingContextLabel);
@@ -806,12 +810,12 @@ NEVER_INLINE bool Interpreter::resolveThisAndProperty(CallFrame* callFrame, Inst
             if (increasingContextLabel != pcstack.Head() && labelReq && (*labelReq == false))
             {
                 *labelReq = true;
-                callFrame->uncheckedR(propDst).setRegLabel(pcstack.Head());
-                callFrame->uncheckedR(thisDst).setRegLabel(pcstack.Head());
+                callFrame->setRegLabel(propDst, pcstack.Head());
+                callFrame->setRegLabel(thisDst, pcstack.Head());
             }
-            if (JSLabel::ABORT_FLAG) {
-                JSLabel::ABORT_FLAG = false;
-                printf("Aborting in resolve this and property %d in %p!\n", (int) (vPC - codeBlock->instructions().begin()), codeBlock);
+            if (callFrame->ifcContext().abortFlag) {
+                callFrame->ifcContext().abortFlag = false;
+                IFC_TRACE(ResolveAbort, codeBlock, vPC - codeBlock->instructions().begin(), 0, pcstack.Head().Val());
                 // return jsUndefined();
             }
             exceptionValue = callFrame->globalData().exception;
@@ -821,13 +825,13 @@ NEVER_INLINE bool Interpreter::resolveThisAndProperty(CallFrame* callFrame, Inst
                 return false;
             if (*labelReq) {
                 JSLabel pdstLabel = JSLabel(); 
-                if(!noSensitiveUpgrade(callFrame->r(propDst).getRegLabel()))
+                if(!noSensitiveUpgrade(codeBlock, callFrame->regLabel(propDst)))
                 {
                     // printf("Sensitive Upgrade at %ld in %p\n", vPC - codeBlock->instructions().begin(), codeBlock);
                     pdstLabel.setStar(true);
                 }
                 callFrame->uncheckedR(propDst) = JSValue(result);
-                callFrame->uncheckedR(propDst).setRegLabel(pdstLabel.Join(result.getValueLabel()));
+                callFrame->setRegLabel(propDst, pdstLabel.Join(result.getValueLabel()));
             }
             else {
                 callFrame->uncheckedR(propDst) = JSValue(result);
@@ -842,7 +846,7 @@ NEVER_INLINE bool Interpreter::resolveThisAndProperty(CallFrame* callFrame, Inst
             ++iter;
             if (*labelReq) {
                 JSLabel dstLabel = JSLabel();
-                if(!noSensitiveUpgrade(callFrame->r(thisDst).getRegLabel()))
+                if(!noSensitiveUpgrade(codeBlock, callFrame->regLabel(thisDst)))
                 {
                     // printf("Sensitive Upgrade at %ld in %p\n", vPC - codeBlock->instructions().begin(), codeBlock);
                     dstLabel.setStar(true);
@@ -851,7 +855,7 @@ NEVER_INLINE bool Interpreter::resolveThisAndProperty(CallFrame* callFrame, Inst
                     callFrame->uncheckedR(thisDst) = jsUndefined();
                 else
                     callFrame->uncheckedR(thisDst) = JSValue(base);
-                callFrame->uncheckedR(thisDst).setRegLabel(dstLabel.Join(increasingContextLabel));
+                callFrame->setRegLabel(thisDst, dstLabel.Join(increasingContextLabel));
             }
             else
             {
@@ -871,8 +875,8 @@ NEVER_INLINE bool Interpreter::resolveThisAndProperty(CallFrame* callFrame, Inst
     if (increasingContextLabel != pcstack.Head() && labelReq && (*labelReq == false))
     {
         *labelReq = true;
-        callFrame->uncheckedR(propDst).setRegLabel(pcstack.Head());
-        callFrame->uncheckedR(thisDst).setRegLabel(pcstack.Head());
+        callFrame->setRegLabel(propDst, pcstack.Head());
+        callFrame->setRegLabel(thisDst, pcstack.Head());
     }
     exceptionValue = createUndefinedVariableError(callFrame, ident);
     exceptionValue.setValueLabel(increasingContextLabel);
@@ -1092,6 +1096,7 @@ CallFrame* loadVarargs(CallFrame* callFrame, RegisterFile* registerFile, JSValue
 Interpreter::Interpreter()
     : m_sampleEntryDepth(0)
     , m_reentryDepth(0)
+    , m_labelEpoch(0)
 #if !ASSERT_DISABLED
     , m_initialized(false)
 #endif
@@ -1132,13 +1137,15 @@ void Interpreter::initialize(LLInt::Data* llintData, bool canUseJIT)
         }
         m_classicEnabled = false;
     } else {
-        JSLabel::pcGlobalLabel.clabel = 0;
-        JSLabel::BRANCH_FLAG = false;
-        // JSLabel::pcGlobalLabel.plabel = 0;
         privateExecute(InitializeAndReturn, 0, 0, 0);
         
         for (int i = 0; i < numOpcodeIDs; ++i)
             m_opcodeIDTable.add(m_opcodeTable[i], static_cast<OpcodeID>(i));
+        // IFC4BC - A labeled handler or an IPD trap decodes as its opcode
+        for (int i = 0; i < numOpcodeIDs; ++i) {
+            m_opcodeIDTable.add(m_labeledOpcodeTable[i], static_cast<OpcodeID>(i));
+            m_opcodeIDTable.add(m_ipdMergeOpcodeTable[i], static_cast<OpcodeID>(i));
+        }
         
         m_classicEnabled = true;
     }
@@ -1670,11 +1677,10 @@ JSValue Interpreter::execute(ProgramExecutable* program, CallFrame* callFrame, S
     }
     
     // IFC4BC - Setting the policy
-    const char* pUrl = program->sourceURL().utf8().data();
-    JSLabel srcLabel = JSLabel(URLMap::urlmap().getLabel(pUrl));
+    JSLabel srcLabel = program->sourceLabel();
     if (srcLabel.Val() == 1) {
-        JSLabel::pcGlobalLabel.clabel = srcLabel.Val();
-        // JSLabel::pcGlobalLabel.plabel = srcLabel.pLabel;
+        callFrame->ifcContext().pcGlobalLabel.clabel = srcLabel.Val();
+        // callFrame->ifcContext().pcGlobalLabel.plabel = srcLabel.pLabel;
     }
     // ---------------------------
     
@@ -1824,7 +1830,7 @@ failedJSONP:
             //printf("gdfgdfg gdfgdf %s dsfds", temp);
             JSLabel srcLabel;
             //if(temp) srcLabel = JSLabel(URLMap::urlmap().getLabel(sURL, 1));
-            // printf("%lld fdsghfghjdsghjf", JSLabel::pcGlobalLabel.clabel);
+            // printf("%lld fdsghfghjdsghjf", callFrame->ifcContext().pcGlobalLabel.clabel);
             //    if(strstr(program->sourceURL().utf8().data(), ".policy")){
             //        if(strcmp(strstr(program->sourceURL().utf8().data(), ".policy"),".policy") == 0)
             //        {
@@ -1839,7 +1845,7 @@ failedJSONP:
             //        URLMap::urlmap().put(program->sourceURL().utf8().data(),false);
             //    }
 
-            srcLabel = JSLabel(URLMap::urlmap().getLabel(pUrl));
+            srcLabel = program->sourceLabel();
             // printf("Src Label is %lld\n", srcLabel.Val());
             if (srcLabel.Val() == 1)
                 pcstack.Push(JSLabel(srcLabel), -1, newCallFrame->registers());
@@ -1870,9 +1876,9 @@ failedJSONP:
             
             // IFC4BC -- Popping the pushed entry to keep pcstack sane
             pcstack.Pop();
-            JSLabel::pcGlobalLabel.clabel = pcstack.Head().Val();
-            JSLabel::BRANCH_FLAG = pcstack.branchFlag();
-            // JSLabel::pcGlobalLabel.plabel = pcstack.Head().pLabel;
+            callFrame->ifcContext().pcGlobalLabel.clabel = pcstack.Head().Val();
+            callFrame->ifcContext().branchFlag = pcstack.branchFlag();
+            // callFrame->ifcContext().pcGlobalLabel.plabel = pcstack.Head().pLabel;
             
             /*
             rc = gettimeofday(&t1,NULL);
@@ -1969,7 +1975,7 @@ JSValue Interpreter::executeCall(CallFrame* callFrame, JSObject* function, CallT
 //        else {
 //            URLMap::urlmap().put(callData.js.functionExecutable->sourceURL().utf8().data(), false);
 //        }
-        //printf("Handler Label========%llu\n", JSLabel::eventNodeLabel);
+        //printf("Handler Label========%llu\n", callFrame->ifcContext().eventNodeLabel);
         //----------------------
 
         if (Profiler* profiler = callFrame->globalData().enabledProfiler())
@@ -1994,8 +2000,7 @@ JSValue Interpreter::executeCall(CallFrame* callFrame, JSObject* function, CallT
                 //if(temp1) srcLabel = JSLabel(URLMap::urlmap().getLabel(sURl, 1));
                 
                 // IFC4BC - There might be internal functions called that are probably (default). Do not check the NSU checks then
-                const char* funcurl = callData.js.functionExecutable->sourceURL().utf8().data();
-                JSLabel funcLabel = JSLabel(URLMap::urlmap().getLabel(funcurl));
+                JSLabel funcLabel = callData.js.functionExecutable->sourceLabel();
                 // newCallFrame->codeBlock()->contextLabel = funcLabel;
                 /*
                 struct timeval t0,t1;
@@ -2013,7 +2018,7 @@ JSValue Interpreter::executeCall(CallFrame* callFrame, JSObject* function, CallT
                 // Should check if handler is from the same function as the element on which it is defined
                 // eventNodeLabel should be equal to srclabel to indicate that the handler is defined in the same function
                 /*
-                if (!srcLabel.NSU(JSLabel(JSLabel::eventNodeLabel)) && JSLabel::eventNodeLabel != 0) {
+                if (!srcLabel.NSU(JSLabel(callFrame->ifcContext().eventNodeLabel)) && callFrame->ifcContext().eventNodeLabel != 0) {
                     printf("Aborting as the handler was called on a node from different source\n");
                     result = jsUndefined();
                 }
@@ -2021,22 +2026,22 @@ JSValue Interpreter::executeCall(CallFrame* callFrame, JSObject* function, CallT
                 // else {
                 // Checking if integrity is 0, give the srcLabel. Need to change this to return the highest integrity label -- all bits set to 1
                 // IFC4BC - 18446744073709551615 is the highest integrity, I suppose
-                // srcLabel = srcLabel.Join(JSLabel(JSLabel::eventNodeLabel.clabel, JSLabel::eventNodeLabel.ilabel));
+                // srcLabel = srcLabel.Join(JSLabel(callFrame->ifcContext().eventNodeLabel.clabel, callFrame->ifcContext().eventNodeLabel.ilabel));
                 // printf("Pushed label %llu on the stack with len %d\n",srcLabel.Val(), pcSLen);
                 // IFC4BC ------------------------------------------------------
                 if (strcmp("", callData.js.functionExecutable->sourceURL().utf8().data()) == 0 &&
-                    JSLabel::eventNodeLabel.clabel == 0) {
+                    callFrame->ifcContext().eventNodeLabel.clabel == 0) {
                     pcstack.Push(JSLabel(), -1, newCallFrame->registers());
-                    JSLabel::pcGlobalLabel.clabel = 0;
-                    JSLabel::BRANCH_FLAG = pcstack.branchFlag();
-                    // JSLabel::pcGlobalLabel.plabel = 0;
+                    callFrame->ifcContext().pcGlobalLabel.clabel = 0;
+                    callFrame->ifcContext().branchFlag = pcstack.branchFlag();
+                    // callFrame->ifcContext().pcGlobalLabel.plabel = 0;
                     result = privateExecute(Normal, &m_registerFile, newCallFrame, 1);
                 }
                 else if (funcLabel.Val() == 1) {
                     pcstack.Push(funcLabel, -1, newCallFrame->registers());
-                    JSLabel::pcGlobalLabel.clabel = pcstack.Head().Val();
-                    JSLabel::BRANCH_FLAG = pcstack.branchFlag();
-                    // JSLabel::pcGlobalLabel.plabel = pcstack.Head().pLabel;
+                    callFrame->ifcContext().pcGlobalLabel.clabel = pcstack.Head().Val();
+                    callFrame->ifcContext().branchFlag = pcstack.branchFlag();
+                    // callFrame->ifcContext().pcGlobalLabel.plabel = pcstack.Head().pLabel;
                     result = privateExecute(Normal, &m_registerFile, newCallFrame, 1);
                 }
                 else {
@@ -2053,21 +2058,21 @@ JSValue Interpreter::executeCall(CallFrame* callFrame, JSObject* function, CallT
                     }
                      */
                     // funcLabel.setVal(0); // Set the function's confidentiality label to 0
-                    if (JSLabel::eventNodeLabel.clabel == 2) {
-                        srcLabel = JSLabel(JSLabel::eventNodeLabel);
+                    if (callFrame->ifcContext().eventNodeLabel.clabel == 2) {
+                        srcLabel = JSLabel(callFrame->ifcContext().eventNodeLabel);
                     }
-                    else if (JSLabel::eventNodeLabel.clabel == 0){
+                    else if (callFrame->ifcContext().eventNodeLabel.clabel == 0){
                         srcLabel = JSLabel();
                     }
                     else { // Join the function label with the context label in which to run
-                        srcLabel = JSLabel(JSLabel::eventNodeLabel);
+                        srcLabel = JSLabel(callFrame->ifcContext().eventNodeLabel);
                         srcLabel = srcLabel.Join(funcLabel);
                     }
-                    // printf("Event node label is %llu and srcLabel is %llu\n", JSLabel::eventNodeLabel.clabel, srcLabel.Val());
+                    // printf("Event node label is %llu and srcLabel is %llu\n", callFrame->ifcContext().eventNodeLabel.clabel, srcLabel.Val());
                     pcstack.Push(srcLabel, -1, newCallFrame->registers());
-                    JSLabel::pcGlobalLabel.clabel = pcstack.Head().Val();
-                    JSLabel::BRANCH_FLAG = pcstack.branchFlag();
-                    // JSLabel::pcGlobalLabel.plabel = pcstack.Head().pLabel;
+                    callFrame->ifcContext().pcGlobalLabel.clabel = pcstack.Head().Val();
+                    callFrame->ifcContext().branchFlag = pcstack.branchFlag();
+                    // callFrame->ifcContext().pcGlobalLabel.plabel = pcstack.Head().pLabel;
                     result = privateExecute(Normal, &m_registerFile, newCallFrame, 0);
                 }
                 
@@ -2089,9 +2094,9 @@ JSValue Interpreter::executeCall(CallFrame* callFrame, JSObject* function, CallT
                 */
                 // IFC4BC -- Popping the pushed entry to keep pcstack sane
                 pcstack.Pop();
-                JSLabel::pcGlobalLabel.clabel = pcstack.Head().Val();
-                JSLabel::BRANCH_FLAG = pcstack.branchFlag();
-                // JSLabel::pcGlobalLabel.plabel = pcstack.Head().pLabel;
+                callFrame->ifcContext().pcGlobalLabel.clabel = pcstack.Head().Val();
+                callFrame->ifcContext().branchFlag = pcstack.branchFlag();
+                // callFrame->ifcContext().pcGlobalLabel.plabel = pcstack.Head().pLabel;
                 // printf("Popped the label %llu from stack with len %d\n",pcstack.Head().Val(), pcSLen);
                 // IFC4BC ------------------------------------------------
                 // }
@@ -2410,51 +2415,50 @@ JSValue Interpreter::execute(EvalExecutable* eval, CallFrame* callFrame, JSValue
         // IFC4BC - handle eval
         JSLabel srcLabel = JSLabel();
         // printf("URL : %s\n", eval->sourceURL().  utf8().data());
-        const char* funcurl = eval->sourceURL().utf8().data();
-        JSLabel funcLabel = JSLabel(URLMap::urlmap().getLabel(funcurl));
+        JSLabel funcLabel = eval->sourceLabel();
         /*
          if (eval->source().provider()->data()->is8Bit())
             printf("URL : %s\n", eval->source().provider()->data()->characters8());
         else
             printf("URL : %s\n", (char*)eval->source().provider()->data()->characters16());
         */
-        if (strcmp("", funcurl) == 0 &&
-            JSLabel::eventNodeLabel.clabel == 0) {
+        if (eval->sourceURL().isEmpty() &&
+            callFrame->ifcContext().eventNodeLabel.clabel == 0) {
             pcstack.Push(JSLabel(), -1, newCallFrame->registers());
-            JSLabel::pcGlobalLabel.clabel = 0;
-            JSLabel::BRANCH_FLAG = pcstack.branchFlag();
-            // JSLabel::pcGlobalLabel.plabel = 0;
+            callFrame->ifcContext().pcGlobalLabel.clabel = 0;
+            callFrame->ifcContext().branchFlag = pcstack.branchFlag();
+            // callFrame->ifcContext().pcGlobalLabel.plabel = 0;
             result = privateExecute(Normal, &m_registerFile, newCallFrame, 1);
         }
         else if (funcLabel.Val() == 1) {
             pcstack.Push(funcLabel, -1, newCallFrame->registers());
-            JSLabel::pcGlobalLabel.clabel = pcstack.Head().Val();
-            JSLabel::BRANCH_FLAG = pcstack.branchFlag();
-            // JSLabel::pcGlobalLabel.plabel = pcstack.Head().pLabel;
+            callFrame->ifcContext().pcGlobalLabel.clabel = pcstack.Head().Val();
+            callFrame->ifcContext().branchFlag = pcstack.branchFlag();
+            // callFrame->ifcContext().pcGlobalLabel.plabel = pcstack.Head().pLabel;
             result = privateExecute(Normal, &m_registerFile, newCallFrame, 1);
         }
         else {
-            if (JSLabel::eventNodeLabel.clabel == 2) {
-                srcLabel = JSLabel(JSLabel::eventNodeLabel);
+            if (callFrame->ifcContext().eventNodeLabel.clabel == 2) {
+                srcLabel = JSLabel(callFrame->ifcContext().eventNodeLabel);
             }
-            else if (JSLabel::eventNodeLabel.clabel == 0){
+            else if (callFrame->ifcContext().eventNodeLabel.clabel == 0){
                 srcLabel = JSLabel();
             }
             else { // Join the function label with the context label in which to run
-                srcLabel = JSLabel(JSLabel::eventNodeLabel);
+                srcLabel = JSLabel(callFrame->ifcContext().eventNodeLabel);
                 srcLabel = srcLabel.Join(funcLabel);
             }
             pcstack.Push(srcLabel, -1, newCallFrame->registers());
-            JSLabel::pcGlobalLabel.clabel = pcstack.Head().Val();
-            JSLabel::BRANCH_FLAG = pcstack.branchFlag();
-            // JSLabel::pcGlobalLabel.plabel = pcstack.Head().pLabel;
+            callFrame->ifcContext().pcGlobalLabel.clabel = pcstack.Head().Val();
+            callFrame->ifcContext().branchFlag = pcstack.branchFlag();
+            // callFrame->ifcContext().pcGlobalLabel.plabel = pcstack.Head().pLabel;
             result = privateExecute(Normal, &m_registerFile, newCallFrame, 0);
         }
         // IFC4BC -- Popping the pushed entry to keep pcstack sane
         pcstack.Pop();
-        JSLabel::pcGlobalLabel.clabel = pcstack.Head().Val();
-        JSLabel::BRANCH_FLAG = pcstack.branchFlag();
-        // JSLabel::pcGlobalLabel.plabel = pcstack.Head().pLabel;
+        callFrame->ifcContext().pcGlobalLabel.clabel = pcstack.Head().Val();
+        callFrame->ifcContext().branchFlag = pcstack.branchFlag();
+        // callFrame->ifcContext().pcGlobalLabel.plabel = pcstack.Head().pLabel;
 
 
         //original
@@ -2514,10 +2518,23 @@ NEVER_INLINE ScopeChainNode* Interpreter::createExceptionScope(CallFrame* callFr
     return callFrame->scopeChain()->push(scope);
 }
 
+// IFC4BC - Specializes an instruction for an inline cache. One at an armed
+// IPD stays trapped (see armIPDMerge).
+ALWAYS_INLINE void Interpreter::setOpcode(Instruction* vPC, OpcodeID opcodeID)
+{
+#if ENABLE(COMPUTED_GOTO_CLASSIC_INTERPRETER)
+    if (UNLIKELY(vPC[0].u.opcode == m_ipdMergeOpcodeTable[getOpcodeID(vPC[0].u.opcode)])) {
+        vPC[0] = m_ipdMergeOpcodeTable[opcodeID];
+        return;
+    }
+#endif
+    vPC[0] = getOpcode(opcodeID);
+}
+
 NEVER_INLINE void Interpreter::tryCachePutByID(CallFrame* callFrame, CodeBlock* codeBlock, Instruction* vPC, JSValue baseValue, const PutPropertySlot& slot)
 {
     // Recursive invocation may already have specialized this instruction.
-    if (vPC[0].u.opcode != getOpcode(op_put_by_id))
+    if (getOpcodeID(vPC[0].u.opcode) != op_put_by_id)
         return;
 
     if (!baseValue.isCell())
@@ -2525,7 +2542,7 @@ NEVER_INLINE void Interpreter::tryCachePutByID(CallFrame* callFrame, CodeBlock*
 
     // Uncacheable: give up.
     if (!slot.isCacheable()) {
-        vPC[0] = getOpcode(op_put_by_id_generic);
+        setOpcode(vPC, op_put_by_id_generic);
         return;
     }
     
@@ -2533,7 +2550,7 @@ NEVER_INLINE void Interpreter::tryCachePutByID(CallFrame* callFrame, CodeBlock*
     Structure* structure = baseCell->structure();
 
     if (structure->isUncacheableDictionary() || structure->typeInfo().prohibitsPropertyCaching()) {
-        vPC[0] = getOpcode(op_put_by_id_generic);
+        setOpcode(vPC, op_put_by_id_generic);
         return;
     }
 
@@ -2547,7 +2564,7 @@ NEVER_INLINE void Interpreter::tryCachePutByID(CallFrame* callFrame, CodeBlock*
         }
 
         // Second miss: give up.
-        vPC[0] = getOpcode(op_put_by_id_generic);
+        setOpcode(vPC, op_put_by_id_generic);
         return;
     }
 
@@ -2555,14 +2572,14 @@ NEVER_INLINE void Interpreter::tryCachePutByID(CallFrame* callFrame, CodeBlock*
 
     // If baseCell != slot.base(), then baseCell must be a proxy for another object.
     if (baseCell != slot.base()) {
-        vPC[0] = getOpcode(op_put_by_id_generic);
+        setOpcode(vPC, op_put_by_id_generic);
         return;
     }
 
     // Structure transition, cache transition info
     if (slot.type() == PutPropertySlot::NewProperty) {
         if (structure->isDictionary()) {
-            vPC[0] = getOpcode(op_put_by_id_generic);
+            setOpcode(vPC, op_put_by_id_generic);
             return;
         }
 
@@ -2574,7 +2591,7 @@ NEVER_INLINE void Interpreter::tryCachePutByID(CallFrame* callFrame, CodeBlock*
         // GC allocation, which we don't want to happen while we're in the middle of 
         // initializing the union.
         StructureChain* prototypeChain = structure->prototypeChain(callFrame);
-        vPC[0] = getOpcode(op_put_by_id_transition);
+        setOpcode(vPC, op_put_by_id_transition);
         vPC[4].u.structure.set(globalData, owner, structure->previousID());
         vPC[5].u.structure.set(globalData, owner, structure);
         vPC[6].u.structureChain.set(callFrame->globalData(), codeBlock->ownerExecutable(), prototypeChain);
@@ -2583,48 +2600,48 @@ NEVER_INLINE void Interpreter::tryCachePutByID(CallFrame* callFrame, CodeBlock*
         return;
     }
 
-    vPC[0] = getOpcode(op_put_by_id_replace);
+    setOpcode(vPC, op_put_by_id_replace);
     vPC[5] = slot.cachedOffset();
 }
 
 NEVER_INLINE void Interpreter::uncachePutByID(CodeBlock*, Instruction* vPC)
 {
-    vPC[0] = getOpcode(op_put_by_id);
+    setOpcode(vPC, op_put_by_id);
     vPC[4] = 0;
 }
 
 NEVER_INLINE void Interpreter::tryCacheGetByID(CallFrame* callFrame, CodeBlock* codeBlock, Instruction* vPC, JSValue baseValue, const Identifier& propertyName, const PropertySlot& slot)
 {
     // Recursive invocation may already have specialized this instruction.
-    if (vPC[0].u.opcode != getOpcode(op_get_by_id))
+    if (getOpcodeID(vPC[0].u.opcode) != op_get_by_id)
         return;
 
     // FIXME: Cache property access for immediates.
     if (!baseValue.isCell()) {
-        vPC[0] = getOpcode(op_get_by_id_generic);
+        setOpcode(vPC, op_get_by_id_generic);
         return;
     }
 
     if (isJSArray(baseValue) && propertyName == callFrame->propertyNames().length) {
-        vPC[0] = getOpcode(op_get_array_length);
+        setOpcode(vPC, op_get_array_length);
         return;
     }
 
     if (isJSString(baseValue) && propertyName == callFrame->propertyNames().length) {
-        vPC[0] = getOpcode(op_get_string_length);
+        setOpcode(vPC, op_get_string_length);
         return;
     }
 
     // Uncacheable: give up.
     if (!slot.isCacheable()) {
-        vPC[0] = getOpcode(op_get_by_id_generic);
+        setOpcode(vPC, op_get_by_id_generic);
         return;
     }
 
     Structure* structure = baseValue.asCell()->structure();
 
     if (structure->isUncacheableDictionary() || structure->typeInfo().prohibitsPropertyCaching()) {
-        vPC[0] = getOpcode(op_get_by_id_generic);
+        setOpcode(vPC, op_get_by_id_generic);
         return;
     }
 
@@ -2638,7 +2655,7 @@ NEVER_INLINE void Interpreter::tryCacheGetByID(CallFrame* callFrame, CodeBlock*
         }
 
         // Second miss: give up.
-        vPC[0] = getOpcode(op_get_by_id_generic);
+        setOpcode(vPC, op_get_by_id_generic);
         return;
     }
 
@@ -2647,15 +2664,15 @@ NEVER_INLINE void Interpreter::tryCacheGetByID(CallFrame* callFrame, CodeBlock*
     if (slot.slotBase() == baseValue) {
         switch (slot.cachedPropertyType()) {
         case PropertySlot::Getter:
-            vPC[0] = getOpcode(op_get_by_id_getter_self);
+            setOpcode(vPC, op_get_by_id_getter_self);
             vPC[5] = slot.cachedOffset();
             break;
         case PropertySlot::Custom:
-            vPC[0] = getOpcode(op_get_by_id_custom_self);
+            setOpcode(vPC, op_get_by_id_custom_self);
             vPC[5] = slot.customGetter();
             break;
         default:
-            vPC[0] = getOpcode(op_get_by_id_self);
+            setOpcode(vPC, op_get_by_id_self);
             vPC[5] = slot.cachedOffset();
             break;
         }
@@ -2663,7 +2680,7 @@ NEVER_INLINE void Interpreter::tryCacheGetByID(CallFrame* callFrame, CodeBlock*
     }
 
     if (structure->isDictionary()) {
-        vPC[0] = getOpcode(op_get_by_id_generic);
+        setOpcode(vPC, op_get_by_id_generic);
         return;
     }
 
@@ -2684,15 +2701,15 @@ NEVER_INLINE void Interpreter::tryCacheGetByID(CallFrame* callFrame, CodeBlock*
         
         switch (slot.cachedPropertyType()) {
         case PropertySlot::Getter:
-            vPC[0] = getOpcode(op_get_by_id_getter_proto);
+            setOpcode(vPC, op_get_by_id_getter_proto);
             vPC[6] = offset;
             break;
         case PropertySlot::Custom:
-            vPC[0] = getOpcode(op_get_by_id_custom_proto);
+            setOpcode(vPC, op_get_by_id_custom_proto);
             vPC[6] = slot.customGetter();
             break;
         default:
-            vPC[0] = getOpcode(op_get_by_id_proto);
+            setOpcode(vPC, op_get_by_id_proto);
             vPC[6] = offset;
             break;
         }
@@ -2703,7 +2720,7 @@ NEVER_INLINE void Interpreter::tryCacheGetByID(CallFrame* callFrame, CodeBlock*
     PropertyOffset offset = slot.cachedOffset();
     size_t count = normalizePrototypeChain(callFrame, baseValue, slot.slotBase(), propertyName, offset);
     if (!count) {
-        vPC[0] = getOpcode(op_get_by_id_generic);
+        setOpcode(vPC, op_get_by_id_generic);
         return;
     }
 
@@ -2711,15 +2728,15 @@ NEVER_INLINE void Interpreter::tryCacheGetByID(CallFrame* callFrame, CodeBlock*
     StructureChain* prototypeChain = structure->prototypeChain(callFrame);
     switch (slot.cachedPropertyType()) {
     case PropertySlot::Getter:
-        vPC[0] = getOpcode(op_get_by_id_getter_chain);
+        setOpcode(vPC, op_get_by_id_getter_chain);
         vPC[7] = offset;
         break;
     case PropertySlot::Custom:
-        vPC[0] = getOpcode(op_get_by_id_custom_chain);
+        setOpcode(vPC, op_get_by_id_custom_chain);
         vPC[7] = slot.customGetter();
         break;
     default:
-        vPC[0] = getOpcode(op_get_by_id_chain);
+        setOpcode(vPC, op_get_by_id_chain);
         vPC[7] = offset;
         break;
     }
@@ -2730,7 +2747,7 @@ NEVER_INLINE void Interpreter::tryCacheGetByID(CallFrame* callFrame, CodeBlock*
 
 NEVER_INLINE void Interpreter::uncacheGetByID(CodeBlock*, Instruction* vPC)
 {
-    vPC[0] = getOpcode(op_get_by_id);
+    setOpcode(vPC, op_get_by_id);
     vPC[4] = 0;
 }
 
@@ -2738,28 +2755,202 @@ NEVER_INLINE void Interpreter::uncacheGetByID(CodeBlock*, Instruction* vPC)
 
 void Interpreter::labelRegisters(CallFrame* callFrame, CodeBlock* codeBlock, JSLabel pcLabel)
 {
-    for (int i = 0; i < codeBlock->m_numCalleeRegisters; i++) {
-        callFrame->uncheckedR(i).setRegLabel(pcLabel);
-    }
-    for(int i = -7, j = 1; j <= codeBlock->numParameters(); j++, i--)
+    // A new epoch makes every register written before it read as pcLabel.
+    // The parameters are the caller's registers too, which it reads in its
+    // own epoch once this frame returns, so they are written as well. So
+    // are the captured locals, and all the arguments where the arguments
+    // are captured: an activation or arguments object reads them through
+    // WriteBarrier<Unknown>, which knows no epochs.
+    int parameters = codeBlock->numParameters();
+    if (codeBlock->codeType() == FunctionCode && codeBlock->argumentsAreCaptured())
+        parameters = std::max<int>(parameters, callFrame->argumentCountIncludingThis());
+    IFC_COUNT(codeBlock, LabelRegisters);
+    IFC_COUNT_N(codeBlock, RegistersLabeled, parameters + codeBlock->m_numCapturedVars);
+    if (UNLIKELY(!++m_labelEpoch)) {
+        resetLabelEpochs(callFrame);
+        m_labelEpoch = 1;
+    }
+    callFrame->setFrameLabel(pcLabel, m_labelEpoch);
+    for(int i = -7, j = 1; j <= parameters; j++, i--)
     {
-        callFrame->uncheckedR(i).setRegLabel(pcLabel);
+        callFrame->setRegLabel(i, pcLabel);
+    }
+    for (int i = 0; i < codeBlock->m_numCapturedVars; i++)
+        callFrame->setRegLabel(i, pcLabel);
+}
+
+// IFC4BC - A register the frame wrote before its latest relabel reads as the
+// frame's default label, but an activation or arguments object created now
+// would read the label it was written with. Writes the registers they reach
+// with the label the frame reads; labelRegisters keeps them written.
+NEVER_INLINE void Interpreter::resolveAliasedRegLabels(CallFrame* callFrame, CodeBlock* codeBlock)
+{
+    int arguments = std::max<int>(callFrame->argumentCountIncludingThis(), codeBlock->numParameters());
+    for (int i = 0; i < arguments; i++) {
+        int index = CallFrame::argumentOffsetIncludingThis(i);
+        callFrame->setRegLabel(index, callFrame->uncheckedRegLabel(index));
     }
+    for (int i = 0; i < codeBlock->m_numCapturedVars; i++)
+        callFrame->setRegLabel(i, callFrame->uncheckedRegLabel(i));
+}
+
+// IFC4BC - When the epoch wraps, registers written late in the old range
+// would otherwise look newer than every new epoch. Each live frame's
+// registers keep the label they read as now, stamped with the largest
+// epoch so frames further out still read them as written; then every
+// epoch in the register file and of each frame starts again from 0.
+NEVER_INLINE void Interpreter::resetLabelEpochs(CallFrame* callFrame)
+{
+    const uint32_t newest = std::numeric_limits<uint32_t>::max();
+    for (CallFrame* frame = callFrame; frame; frame = frame->callerFrame()->removeHostCallFrameFlag()) {
+        CodeBlock* codeBlock = frame->codeBlock();
+        int arguments = std::max<int>(frame->argumentCountIncludingThis(), codeBlock ? codeBlock->numParameters() : 0);
+        for (int i = 0; i < arguments; i++) {
+            int index = CallFrame::argumentOffsetIncludingThis(i);
+            frame->registers()[index].setRegLabel(frame->uncheckedRegLabel(index), newest);
+        }
+        for (int i = 0; codeBlock && i < codeBlock->m_numCalleeRegisters; i++)
+            frame->registers()[i].setRegLabel(frame->uncheckedRegLabel(i), newest);
+    }
+    for (Register* reg = m_registerFile.begin(); reg < m_registerFile.commitEnd(); ++reg)
+        reg->setRegLabel(reg->getRegLabel(), 0);
+    // Frames outside the register file, such as a global object's globalExec
+    for (CallFrame* frame = callFrame; frame; frame = frame->callerFrame()->removeHostCallFrameFlag())
+        frame->setFrameLabel(frame->frameLabel(), 0);
 }
 
+// Parameters are relabeled even when they are dst, as they always were.
 void Interpreter::labelRegistersMinusDst(CallFrame* callFrame, CodeBlock* codeBlock, JSLabel pcLabel, int dst)
 {
-    for (int i = 0; i < codeBlock->m_numCalleeRegisters; i++) {
-        if (i != dst) {
-            callFrame->uncheckedR(i).setRegLabel(pcLabel);
-        }
+    JSLabel dstLabel = callFrame->uncheckedRegLabel(dst);
+    labelRegisters(callFrame, codeBlock, pcLabel);
+    if (dst >= 0)
+        callFrame->setRegLabel(dst, dstLabel);
+}
+
+void Interpreter::labelRegistersMinusDst(CallFrame* callFrame, CodeBlock* codeBlock, JSLabel pcLabel, int dst, int dst2)
+{
+    JSLabel dstLabel = callFrame->uncheckedRegLabel(dst);
+    JSLabel dst2Label = callFrame->uncheckedRegLabel(dst2);
+    labelRegisters(callFrame, codeBlock, pcLabel);
+    if (dst >= 0)
+        callFrame->setRegLabel(dst, dstLabel);
+    if (dst2 >= 0)
+        callFrame->setRegLabel(dst2, dst2Label);
+}
+
+ALWAYS_INLINE bool Interpreter::isLabelFree(CodeBlock* codeBlock, int position, CallFrame* callFrame, JSLabel pcLabel, int written1, int written2, int read1, int read2)
+{
+    if (!codeBlock->context || !codeBlock->context->labelFree(position))
+        return false;
+    int registers[4] = { written1, written2, read1, read2 };
+    for (int i = 0; i < 4; i++) {
+        JSLabel label = callFrame->regLabel(registers[i]);
+        if (label == pcLabel || (i >= 2 && label.id() == JSLabelTable::bottomID))
+            continue;
+        IFC_COUNT(codeBlock, LabelFreeMiss);
+        if (Options::ifcCheckLabelFree())
+            IFC_TRACE(LabelFreeMismatch, codeBlock, position, label.Val(), pcLabel.Val());
+        return false;
     }
-    for(int i = -7, j = 1; j <= codeBlock->numParameters(); j++, i--)
-    {
-        callFrame->uncheckedR(i).setRegLabel(pcLabel);
+    IFC_COUNT(codeBlock, LabelFree);
+    // In the check mode the labelled path runs anyway.
+    return !Options::ifcCheckLabelFree();
+}
+
+// IFC4BC - Points the CodeBlock's instructions for the opcodes in
+// FOR_EACH_LABELED_OPCODE_ID at their labeled handlers, once an execution
+// running it requires labels; every other instruction is left alone. Never
+// undone, since other frames may be running it with labels too; the labeled
+// handlers fall back to the plain ones when labelReq is not set.
+NEVER_INLINE void Interpreter::quickenLabeled(CodeBlock* codeBlock)
+{
+    codeBlock->labeledInstructions = true;
+#if ENABLE(COMPUTED_GOTO_CLASSIC_INTERPRETER)
+    Instruction* vPC = codeBlock->instructions().begin();
+    Instruction* end = codeBlock->instructions().end();
+    while (vPC < end) {
+        OpcodeID opcode = getOpcodeID(vPC->u.opcode);
+        // An armed IPD trap already ends in the labeled handler.
+        if (vPC->u.opcode == m_opcodeTable[opcode])
+            vPC->u.opcode = m_labeledOpcodeTable[opcode];
+        vPC += opcodeLengths[opcode];
+    }
+#endif
+}
+
+// IFC4BC - Points the instruction at ipd to its trap in privateExecute
+// (op_ipd_merge), which pops the context a branch pushed for that IPD before
+// running the instruction, so no other dispatch has to compare vPC with
+// pcIPD. The trap is never disarmed: other frames running the CodeBlock, and
+// later branches in this one, wait for the same IPD, and a trap with nothing
+// to pop costs one compare.
+NEVER_INLINE void Interpreter::armIPDMerge(CodeBlock* codeBlock, int ipd)
+{
+    codeBlock->ipdMergeTraps.set(ipd);
+#if ENABLE(COMPUTED_GOTO_CLASSIC_INTERPRETER)
+    Instruction& instruction = codeBlock->instructions()[ipd];
+    instruction.u.opcode = m_ipdMergeOpcodeTable[getOpcodeID(instruction.u.opcode)];
+#endif
+}
+
+// IFC4BC - Computes the table for the flavor the CodeBlock was last entered
+// with. Each flavor is computed at most once per CodeBlock.
+NEVER_INLINE void Interpreter::prepareAnalysis(CodeBlock* codeBlock)
+{
+    if (codeBlock->analysisWithSEN) {
+        // SEN exists
+        if (!codeBlock->contextSEN)
+            codeBlock->contextSEN = StaticAnalyzer().genContextTable(codeBlock, this, true);
+        codeBlock->context = codeBlock->contextSEN.get();
+    }
+    else {
+        // No exception handler
+        if (!codeBlock->contextNOR) {
+            // Usually already done by an AnalysisQueue worker
+            codeBlock->contextNOR = AnalysisQueue::waitFor(codeBlock);
+            if (!codeBlock->contextNOR)
+                codeBlock->contextNOR = StaticAnalyzer().genContextTable(codeBlock, this, false);
+        }
+        codeBlock->context = codeBlock->contextNOR.get();
     }
 }
 
+ALWAYS_INLINE int Interpreter::immediatePostDominator(CodeBlock* codeBlock, int position)
+{
+    if (UNLIKELY(!codeBlock->context))
+        prepareAnalysis(codeBlock);
+    int ipd;
+    if (LIKELY(codeBlock->context->ipd(position, ipd)))
+        return ipd;
+    return position + opcodeLengths[getOpcodeID(codeBlock->instructions()[position].u.opcode)];
+}
+
+// IFC4BC - Opcodes with a separate labeled handler, DEFINE_LABELED_OPCODE.
+// Only these are quickened. Every other opcode still has a single handler
+// that tests labelReq && !isPolicy, labeled or not: the equality, bitwise,
+// division and unary operators, the type tests, the fused compare-and-jump
+// and switch opcodes, and the property, resolve, call, scope and allocation
+// opcodes, whose labeled and plain paths interleave with shared work.
+// Splitting them is left for later.
+#define FOR_EACH_LABELED_OPCODE_ID(macro) \
+    macro(op_mov) \
+    macro(op_less) \
+    macro(op_lesseq) \
+    macro(op_greater) \
+    macro(op_greatereq) \
+    macro(op_pre_inc) \
+    macro(op_pre_dec) \
+    macro(op_post_inc) \
+    macro(op_post_dec) \
+    macro(op_add) \
+    macro(op_mul) \
+    macro(op_sub) \
+    macro(op_loop_if_true) \
+    macro(op_loop_if_false) \
+    macro(op_jtrue) \
+    macro(op_jfalse)
+
 JSValue Interpreter::privateExecute(ExecutionFlag flag, RegisterFile* registerFile, CallFrame* callFrame, bool isPolicy)
 {
     // One-time initialization of our address tables. We have to put this code
@@ -2771,6 +2962,18 @@ JSValue Interpreter::privateExecute(ExecutionFlag flag, RegisterFile* registerFi
                 for (size_t i = 0; i < WTF_ARRAY_LENGTH(labels); ++i)
                     m_opcodeTable[i] = labels[i];
             #undef LIST_OPCODE_LABEL
+            // IFC4BC - Opcodes without a labeled handler keep their own
+                for (size_t i = 0; i < WTF_ARRAY_LENGTH(labels); ++i)
+                    m_labeledOpcodeTable[i] = labels[i];
+            #define SET_LABELED_OPCODE_LABEL(id) m_labeledOpcodeTable[id] = &&id##_labeled;
+                FOR_EACH_LABELED_OPCODE_ID(SET_LABELED_OPCODE_LABEL)
+            #undef SET_LABELED_OPCODE_LABEL
+            // IFC4BC - Each opcode's trap at an armed IPD
+            #define LIST_IPD_MERGE_LABEL(id, length) &&id##_ipd_merge,
+                static Opcode ipdMergeLabels[] = { FOR_EACH_OPCODE_ID(LIST_IPD_MERGE_LABEL) };
+                for (size_t i = 0; i < WTF_ARRAY_LENGTH(ipdMergeLabels); ++i)
+                    m_ipdMergeOpcodeTable[i] = ipdMergeLabels[i];
+            #undef LIST_IPD_MERGE_LABEL
         #endif // ENABLE(COMPUTED_GOTO_CLASSIC_INTERPRETER)
         return JSValue();
     }
@@ -2795,6 +2998,8 @@ JSValue Interpreter::privateExecute(ExecutionFlag flag, RegisterFile* registerFi
     ASSERT(callFrame->globalData().topCallFrame == callFrame);
 
     JSGlobalData* globalData = &callFrame->globalData();
+    // IFC4BC - Where the runtime and WebCore find the pc and argument labels
+    IFCContext& ifcContext = *globalData->ifcContext;
     JSValue exceptionValue;
     HandlerInfo* handler = 0;
     CallFrame** topCallFrameSlot = &globalData->topCallFrame;
@@ -2805,39 +3010,43 @@ JSValue Interpreter::privateExecute(ExecutionFlag flag, RegisterFile* registerFi
     unsigned tickCount = globalData->timeoutChecker.ticksUntilNextCheck();
     JSValue functionReturnValue;
 
-    // IFC4BC - Perform static analysis
-    // Create CFG and calculate IPD
-    if (pcstack.excHandler()) {
-        // SEN exists
-        if (!codeBlock->has_SENanalysis) {
-            codeBlock->analyzerSEN.genContextTable(codeBlock, this, pcstack.excHandler());
-            codeBlock->has_SENanalysis = true;
-        }
-        codeBlock->analyzer = codeBlock->analyzerSEN;
-    }
-    else {
-        // No exception handler
-        if (!codeBlock->has_analysis) {
-            codeBlock->analyzerNOR.genContextTable(codeBlock, this, pcstack.excHandler());
-            codeBlock->has_analysis = true;
-        }
-        codeBlock->analyzer = codeBlock->analyzerNOR;
-    }
+    // IFC4BC - Static analysis is deferred to the first branch that needs
+    // an IPD; only remember whether it must account for the SEN
+    codeBlock->selectAnalysis(pcstack.excHandler());
     // IFC4BC - Local variables for pc
     JSLabel pcLabel = pcstack.Head();
     int pcIPD = pcstack.Loc();
     int pcSLen = pcstack.Len();
     Register* pcReg = pcstack.Reg();
+#if ENABLE(COMPUTED_GOTO_CLASSIC_INTERPRETER)
+    // Opcode of the instruction whose IPD trap was taken
+    OpcodeID ipdMergeOpcode = op_end;
+#endif
 //    if(!isPolicy)
 //        pcLabel = pcstack.Head();
 //    else
 //        pcLabel = JSLabel(1,1);
     pcLabel.setStar(false);
-    JSLabel::pcGlobalLabel = pcLabel.getPair();
-    JSLabel::BRANCH_FLAG = pcstack.branchFlag();
+    ifcContext.pcGlobalLabel = pcLabel.getPair();
+    ifcContext.branchFlag = pcstack.branchFlag();
     // For sparse labelling
     bool labelReq = false;
     
+    // Labels are required from here on; the running CodeBlock must use the
+    // labeled handlers, as must any CodeBlock this execution switches to.
+#define REQUIRE_LABELS() do { \
+    labelReq = true; \
+    CHECK_LABELED_INSTRUCTIONS(); \
+} while (0)
+#if ENABLE(COMPUTED_GOTO_CLASSIC_INTERPRETER)
+#define CHECK_LABELED_INSTRUCTIONS() do { \
+    if (labelReq && UNLIKELY(!codeBlock->labeledInstructions)) \
+        quickenLabeled(codeBlock); \
+} while (0)
+#else
+#define CHECK_LABELED_INSTRUCTIONS() do { } while (0)
+#endif
+    
     // For setting label of global variable in policy
     bool isGlobalVar = false;
     bool isSetLabel = false;
@@ -2878,19 +3087,18 @@ unwindCallFrame(callFrame, exceptionValue, bytecodeOffset, codeBlock); \
 if (end && (pcSLen > 0)) { \
 /*printf("abort end\n");*/\
 /*printf("Program Counter Head: %llx\n", pcLabel.Val());*/\
-while (pcSLen > 0) {\
-pcstack.Pop();\
+pcstack.Clear();\
 pcSLen = pcstack.Len();\
-}\
 pcLabel = pcstack.Head();\
 pcIPD = pcstack.Loc();\
 pcReg = pcstack.Reg();\
-JSLabel::pcGlobalLabel = pcLabel.getPair();\
-JSLabel::BRANCH_FLAG = pcstack.branchFlag();\
+ifcContext.pcGlobalLabel = pcLabel.getPair();\
+ifcContext.branchFlag = pcstack.branchFlag();\
 /*printf("Failed at line number:%d\n", POSITION);*/\
 return jsUndefined(); \
 } else { \
 codeBlock = callFrame->codeBlock(); \
+CHECK_LABELED_INSTRUCTIONS(); \
 iBegin = codeBlock->instructions().begin();\
 functionReturnValue = jsUndefined(); \
 /*printf("abort else\n");*/\
@@ -2898,9 +3106,11 @@ NEXT_INSTRUCTION();\
 } } while (0)
 
 #define ABORT_TRANSACTION() do {\
+if (IFCTrace::isEnabled(IFCTrace::Violation)) {\
 int bytecodeOffset = (int) (vPC - iBegin);\
 int lineNumber = codeBlock->lineNumberForBytecodeOffset(bytecodeOffset);\
-printf("Line %d: IFC Violation at %d in %p!\n", lineNumber, bytecodeOffset, codeBlock);\
+IFCTrace::record(IFCTrace::Violation, codeBlock, bytecodeOffset, 0, pcLabel.Val(), lineNumber);\
+}\
 }while(0)
 
 // #define ABORT_TRANSACTION() do {\
@@ -2925,22 +3135,36 @@ goto vm_throw; \
 } while (0)
 
 
+    // A pushed context is popped by the trap at its IPD (see armIPDMerge);
+    // an IPD at the end of the code is only reached by returning.
+#if ENABLE(COMPUTED_GOTO_CLASSIC_INTERPRETER)
+#define ARM_IPD_MERGE(ipd, sen) do { \
+    if ((ipd) < (sen) && UNLIKELY(!codeBlock->ipdMergeTraps.get(ipd))) \
+        armIPDMerge(codeBlock, ipd); \
+} while (0)
+#else
+#define ARM_IPD_MERGE(ipd, sen) do { } while (0)
+#endif
+
 #if LDEBUG
     
 #define OP_BRANCH(op_label) \
 int POSITION = (int) (vPC - iBegin); \
 int SEN = (int) (codeBlock->instructions().end() - iBegin); \
-int IPD = codeBlock->analyzer.IDom(POSITION); \
+int IPD = immediatePostDominator(codeBlock, POSITION); \
 bool flag = true /*((pcLabel == op_label) ? pcstack.branchFlag() : true)*/;\
 if ((pcSLen > 0) && ((IPD == SEN) || ((pcIPD == IPD) && (pcReg == callFrame->registers())))) { \
 pcstack.Join(op_label, flag); \
+IFC_COUNT(codeBlock, PCJoin); \
 printf("Joining label 0x%" PRIx64 " to PC at location %d with IPD %d\n", op_label.Val(), POSITION, IPD); \
 pcLabel = pcstack.Head();\
 pcLabel.setStar(false);\
-JSLabel::pcGlobalLabel = pcLabel.getPair();\
-JSLabel::BRANCH_FLAG = pcstack.branchFlag();\
+ifcContext.pcGlobalLabel = pcLabel.getPair();\
+ifcContext.branchFlag = pcstack.branchFlag();\
 } else { \
 pcstack.Push(op_label, IPD, callFrame->registers(), pcstack.excHandler(), flag); \
+ARM_IPD_MERGE(IPD, SEN); \
+IFC_COUNT(codeBlock, PCPush); \
 printf("Pushing label 0x%" PRIx64 " to PC at location %d with IPD %d and exchandler %d\n", op_label.Val(), POSITION, IPD, pcstack.excHandler()); \
 printf("Pushed on the stack with len %d\n",pcSLen);\
 pcLabel = pcstack.Head();\
@@ -2948,13 +3172,14 @@ pcIPD = pcstack.Loc();\
 pcSLen = pcstack.Len();\
 pcReg = pcstack.Reg();\
 pcLabel.setStar(false);\
-JSLabel::pcGlobalLabel = pcLabel.getPair();\
-JSLabel::BRANCH_FLAG = pcstack.branchFlag();\
+ifcContext.pcGlobalLabel = pcLabel.getPair();\
+ifcContext.branchFlag = pcstack.branchFlag();\
 }
     
 #define OP_MERGE() \
 if ((pcIPD == (int) (vPC - iBegin)) && (pcReg==callFrame->registers())) { \
 pcstack.Pop(); \
+IFC_COUNT(codeBlock, PCPop); \
 printf("Popping label from PC at location %d\n", (int) (vPC - iBegin)); \
 printf("Popped from the stack with len %d\n",pcLen);\
 pcLabel = pcstack.Head();\
@@ -2962,24 +3187,27 @@ pcIPD = pcstack.Loc();\
 pcSLen = pcstack.Len();\
 pcReg = pcstack.Reg();\
 pcLabel.setStar(false);\
-JSLabel::pcGlobalLabel = pcLabel.getPair();\
-JSLabel::BRANCH_FLAG = pcstack.branchFlag();\
+ifcContext.pcGlobalLabel = pcLabel.getPair();\
+ifcContext.branchFlag = pcstack.branchFlag();\
 }
     
     // Added OP_CALLBRANCH for function calls assisting in exception handling.
 #define OP_CALLBRANCH(op_label, excHandler, funHandler) \
 int POSITION = (int) (vPC - iBegin); \
 int SEN = (int) (codeBlock->instructions().end() - iBegin); \
-int IPD = codeBlock->analyzer.IDom(POSITION); \
+int IPD = immediatePostDominator(codeBlock, POSITION); \
 if ((pcSLen > 0) && ((IPD==SEN) || ((pcIPD==IPD) && (pcReg==callFrame->registers())))) { \
 pcstack.Join(op_label, excHandler, funHandler); \
+IFC_COUNT(codeBlock, PCJoin); \
 printf("Joining label 0x%" PRIx64 " to PC at location %d with IPD %d\n", op_label.Val(), POSITION, IPD); \
 pcLabel = pcstack.Head();\
 pcLabel.setStar(false);\
-JSLabel::pcGlobalLabel = pcLabel.getPair();\
-JSLabel::BRANCH_FLAG = pcstack.branchFlag();\
+ifcContext.pcGlobalLabel = pcLabel.getPair();\
+ifcContext.branchFlag = pcstack.branchFlag();\
 } else { \
 pcstack.Push(op_label, IPD, callFrame->registers(), excHandler, funHandler, pcstack.branchFlag()); \
+ARM_IPD_MERGE(IPD, SEN); \
+IFC_COUNT(codeBlock, PCPush); \
 printf("Pushing label 0x%" PRIx64 " to PC at location %d with IPD %d and funhandler %d\n", op_label.Val(), POSITION, IPD, funHandler); \
 printf("Pushed on the stack with len %d\n",pcSLen);\
 pcLabel = pcstack.Head();\
@@ -2987,8 +3215,8 @@ pcIPD = pcstack.Loc();\
 pcSLen = pcstack.Len();\
 pcReg = pcstack.Reg();\
 pcLabel.setStar(false);\
-JSLabel::pcGlobalLabel = pcLabel.getPair();\
-JSLabel::BRANCH_FLAG = pcstack.branchFlag();\
+ifcContext.pcGlobalLabel = pcLabel.getPair();\
+ifcContext.branchFlag = pcstack.branchFlag();\
 }
     
 #else // if !LDEBUG
@@ -2996,57 +3224,64 @@ JSLabel::BRANCH_FLAG = pcstack.branchFlag();\
 #define OP_BRANCH(op_label) \
 int POSITION = (int) (vPC - iBegin); \
 int SEN = (int) (codeBlock->instructions().end() - iBegin); \
-int IPD = codeBlock->analyzer.IDom(POSITION); \
+int IPD = immediatePostDominator(codeBlock, POSITION); \
 bool flag = true/*((pcstack.Head() == op_label) ? pcstack.branchFlag() : true)*/;\
 if ((pcSLen > 0) && ((IPD==SEN) || ((pcIPD==IPD) && (pcReg==callFrame->registers())))) { \
 pcstack.Join(op_label, flag); \
+IFC_COUNT(codeBlock, PCJoin); \
 pcLabel = pcstack.Head();\
 pcLabel.setStar(false);\
-JSLabel::pcGlobalLabel = pcLabel.getPair();\
-JSLabel::BRANCH_FLAG = pcstack.branchFlag();\
+ifcContext.pcGlobalLabel = pcLabel.getPair();\
+ifcContext.branchFlag = pcstack.branchFlag();\
 } else { \
 pcstack.Push(op_label, IPD, callFrame->registers(), pcstack.excHandler(), flag); \
+ARM_IPD_MERGE(IPD, SEN); \
+IFC_COUNT(codeBlock, PCPush); \
 pcLabel = pcstack.Head();\
 pcIPD = pcstack.Loc();\
 pcSLen = pcstack.Len();\
 pcReg = pcstack.Reg();\
 pcLabel.setStar(false);\
-JSLabel::pcGlobalLabel = pcLabel.getPair();\
-JSLabel::BRANCH_FLAG = pcstack.branchFlag();\
+ifcContext.pcGlobalLabel = pcLabel.getPair();\
+ifcContext.branchFlag = pcstack.branchFlag();\
 }
     
 #define OP_MERGE() \
 if ((pcIPD == (int) (vPC - iBegin)) && (pcstack.Reg()==callFrame->registers())) { \
 pcstack.Pop(); \
+IFC_COUNT(codeBlock, PCPop); \
 pcLabel = pcstack.Head();\
 pcIPD = pcstack.Loc();\
 pcSLen = pcstack.Len();\
 pcReg = pcstack.Reg();\
 pcLabel.setStar(false);\
-JSLabel::pcGlobalLabel = pcLabel.getPair();\
-JSLabel::BRANCH_FLAG = pcstack.branchFlag();\
+ifcContext.pcGlobalLabel = pcLabel.getPair();\
+ifcContext.branchFlag = pcstack.branchFlag();\
 }
     
     //  Added OP_CALLBRANCH for function calls assisting in exception handling.
 #define OP_CALLBRANCH(op_label, excHandler, funHandler) \
 int POSITION = (int) (vPC - iBegin); \
 int SEN = (int) (codeBlock->instructions().end() - iBegin); \
-int IPD = codeBlock->analyzer.IDom(POSITION); \
+int IPD = immediatePostDominator(codeBlock, POSITION); \
 if ((pcSLen > 0) && ((IPD==SEN) || ((pcIPD==IPD) && (pcstack.Reg()==callFrame->registers())))) { \
 pcstack.Join(op_label, excHandler, funHandler); \
+IFC_COUNT(codeBlock, PCJoin); \
 pcLabel = pcstack.Head();\
 pcLabel.setStar(false);\
-JSLabel::pcGlobalLabel = pcLabel.getPair();\
-JSLabel::BRANCH_FLAG = pcstack.branchFlag();\
+ifcContext.pcGlobalLabel = pcLabel.getPair();\
+ifcContext.branchFlag = pcstack.branchFlag();\
 } else { \
 pcstack.Push(op_label, IPD, callFrame->registers(), excHandler, funHandler, pcstack.branchFlag()); \
+ARM_IPD_MERGE(IPD, SEN); \
+IFC_COUNT(codeBlock, PCPush); \
 pcLabel = pcstack.Head();\
 pcIPD = pcstack.Loc();\
 pcSLen = pcstack.Len();\
 pcReg = pcstack.Reg();\
 pcLabel.setStar(false);\
-JSLabel::pcGlobalLabel = pcLabel.getPair();\
-JSLabel::BRANCH_FLAG = pcstack.branchFlag();\
+ifcContext.pcGlobalLabel = pcLabel.getPair();\
+ifcContext.branchFlag = pcstack.branchFlag();\
 }
     
 #endif // END if LEDBUG
@@ -3074,10 +3309,8 @@ JSLabel::BRANCH_FLAG = pcstack.branchFlag();\
     } while (0)
 
 #if ENABLE(COMPUTED_GOTO_CLASSIC_INTERPRETER)
-    // IFC4BC - Adding instruction to pop, if IPD is encountered
-    #define NEXT_INSTRUCTION() SAMPLE(codeBlock, vPC); OP_MERGE(); goto *vPC->u.opcode
-    // Original
-    // #define NEXT_INSTRUCTION() SAMPLE(codeBlock, vPC); goto *vPC->u.opcode
+    // IFC4BC - The pop at an IPD is left to its trap, op_ipd_merge
+    #define NEXT_INSTRUCTION() SAMPLE(codeBlock, vPC); goto *vPC->u.opcode
 #if ENABLE(OPCODE_STATS)
     #define DEFINE_OPCODE(opcode) \
         opcode:\
@@ -3086,9 +3319,15 @@ JSLabel::BRANCH_FLAG = pcstack.branchFlag();\
 #else
     #define DEFINE_OPCODE(opcode) opcode: UPDATE_BYTECODE_OFFSET();
 #endif
+    // IFC4BC - A quickened CodeBlock (see quickenLabeled) dispatches the
+    // opcodes in FOR_EACH_LABELED_OPCODE_ID to their labeled handler, which
+    // falls back to the plain one when it has no labels to track. The plain
+    // handler never sees labels.
+    #define UNLABELED_ENTRY(opcode) opcode##_unlabeled:
     NEXT_INSTRUCTION();
 #else
-    // IFC4BC - Adding instruction to pop, if IPD is encountered
+    // IFC4BC - Adding instruction to pop, if IPD is encountered; there are
+    // no handler addresses to trap with
 #define NEXT_INSTRUCTION() SAMPLE(codeBlock, vPC); OP_MERGE(); goto interpreterLoopStart
     // Original
     // #define NEXT_INSTRUCTION() SAMPLE(codeBlock, vPC); goto interpreterLoopStart
@@ -3100,6 +3339,21 @@ JSLabel::BRANCH_FLAG = pcstack.branchFlag();\
 #else
     #define DEFINE_OPCODE(opcode) case opcode: UPDATE_BYTECODE_OFFSET();
 #endif
+    // IFC4BC - Nothing is quickened; the plain handler picks the labeled one.
+    #define UNLABELED_ENTRY(opcode) \
+        if (labelReq && !isPolicy) \
+            goto opcode##_labeled; \
+        opcode##_unlabeled:
+#endif
+#if ENABLE(OPCODE_STATS)
+    #define DEFINE_LABELED_OPCODE(opcode) \
+        opcode##_labeled:\
+            OpcodeStats::recordInstruction(opcode);\
+            UPDATE_BYTECODE_OFFSET();
+#else
+    #define DEFINE_LABELED_OPCODE(opcode) opcode##_labeled: UPDATE_BYTECODE_OFFSET();
+#endif
+#if !ENABLE(COMPUTED_GOTO_CLASSIC_INTERPRETER)
 while (1) { // iterator loop begins
 interpreterLoopStart:;
 switch (vPC->u.opcode)
@@ -3120,13 +3374,13 @@ switch (vPC->u.opcode)
             newlyCreatedObject->structure()->setProtoLabel(pcLabel/*.Join(codeBlock->contextLabel)*/);
             JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/;
             // DNSU
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
             {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             callFrame->uncheckedR(dst) = JSValue(newlyCreatedObject);
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             JSObject* newlyCreatedObject = constructEmptyObject(callFrame);
@@ -3164,13 +3418,13 @@ switch (vPC->u.opcode)
             vA.asCell()->structure()->setProtoLabel(pcLabel/*.Join(codeBlock->contextLabel)*/);
             JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/;
             // DNSU
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
             {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             callFrame->uncheckedR(dst) = vA;
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             JSValue vA = JSValue(constructArray(callFrame, reinterpret_cast<JSValue*>(&callFrame->registers()[firstArg]), argCount));
@@ -3204,14 +3458,14 @@ switch (vPC->u.opcode)
             vA.asCell()->structure()->setProtoLabel(pcLabel/*.Join(codeBlock->contextLabel)*/);
             JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/;
             // DNSU
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
             {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
             callFrame->uncheckedR(dst) = vA;
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             JSValue vA = JSValue(constructArray(callFrame, codeBlock->constantBuffer(firstArg), argCount));
@@ -3249,13 +3503,13 @@ switch (vPC->u.opcode)
             rv.asCell()->structure()->setProtoLabel(pcLabel/*.Join(codeBlock->contextLabel)*/);
             JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/;
             // DNSU
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
             {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             callFrame->uncheckedR(dst) = rv;
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             JSValue rv = JSValue(RegExpObject::create(*globalData, callFrame->lexicalGlobalObject(), callFrame->scopeChain()->globalObject->regExpStructure(), regExp));
@@ -3275,22 +3529,31 @@ switch (vPC->u.opcode)
          
          Copies register src to register dst.
          */
+        UNLABELED_ENTRY(op_mov);
         int dst = vPC[1].u.operand;
         int src = vPC[2].u.operand;
         
-        if (labelReq  && !isPolicy) {
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/;
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
-            {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
-                dstLabel.setStar(true);
-            }
-            callFrame->uncheckedR(dst) = callFrame->r(src);
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel.Join(callFrame->r(src).getRegLabel()));
-        }
-        else {
-            callFrame->uncheckedR(dst) = callFrame->r(src);
+        callFrame->uncheckedR(dst) = callFrame->r(src);
+        
+        vPC += OPCODE_LENGTH(op_mov);
+         NEXT_INSTRUCTION();
+    }
+    DEFINE_LABELED_OPCODE(op_mov) {
+        int dst = vPC[1].u.operand;
+        int src = vPC[2].u.operand;
+        
+        // The plain mov copies src's label too, so src must carry the pc
+        // label like dst; bottom is not enough.
+        if (isPolicy || !labelReq || isLabelFree(codeBlock, vPC - iBegin, callFrame, pcLabel, dst, src, dst, dst))
+            goto op_mov_unlabeled;
+        JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/;
+        if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
+        {
+            IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
+            dstLabel.setStar(true);
         }
+        callFrame->uncheckedR(dst) = callFrame->r(src);
+        callFrame->setRegLabel(dst, dstLabel.Join(callFrame->regLabel(src)));
         
         vPC += OPCODE_LENGTH(op_mov);
          NEXT_INSTRUCTION();
@@ -3309,13 +3572,13 @@ switch (vPC->u.opcode)
         
         if (labelReq && !isPolicy) {
             JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/;
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
             {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         vPC += OPCODE_LENGTH(op_mov_empty);
          NEXT_INSTRUCTION();
@@ -3335,15 +3598,15 @@ switch (vPC->u.opcode)
         // IFC4BC  instrumentation
         if (labelReq && !isPolicy) {
             JSLabel dstLabel = pcLabel;
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
             {
-                dstLabel = dstLabel.Join(callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+                dstLabel = dstLabel.Join(callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             else {
                 // dstLabel.setStar(false);
-                JSLabel tdstLabel = (callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
+                JSLabel tdstLabel = (callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
                 uint64_t dstL = tdstLabel.Val();
                 /*
                 if (pcLabel <= tdstLabel) {
@@ -3387,7 +3650,7 @@ switch (vPC->u.opcode)
                 CHECK_FOR_EXCEPTION(dstLabel);
                 callFrame->uncheckedR(dst) = result;
             }
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             if (src1.isInt32() && src2.isInt32())
@@ -3412,9 +3675,9 @@ switch (vPC->u.opcode)
         
         // IFC4BC  instrumentation
         if (labelReq && !isPolicy) {
-//            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(vPC[2].u.operand).getRegLabel());
+//            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(vPC[2].u.operand));
 //            
-//            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+//            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
 //            {
 //                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
 //                dstLabel.setStar(true);
@@ -3423,15 +3686,15 @@ switch (vPC->u.opcode)
 //                // dstLabel.setStar(false);
 //            }
             JSLabel dstLabel = JSLabel();
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
             {
-                dstLabel = pcLabel.Join(callFrame->r(vPC[2].u.operand).getRegLabel());
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+                dstLabel = pcLabel.Join(callFrame->regLabel(vPC[2].u.operand));
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             else {
                 // dstLabel.setStar(false);
-                JSLabel tdstLabel = callFrame->r(vPC[2].u.operand).getRegLabel();
+                JSLabel tdstLabel = callFrame->regLabel(vPC[2].u.operand);
                 uint64_t dstL = tdstLabel.Val();
                 /*
                 if (pcLabel <= tdstLabel) {
@@ -3472,7 +3735,7 @@ switch (vPC->u.opcode)
                 callFrame->uncheckedR(dst) = jsBoolean(true);
             else
                 callFrame->uncheckedR(dst) = jsBoolean(src.isCell() && src.asCell()->structure()->typeInfo().masqueradesAsUndefined());
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             if (src.isUndefinedOrNull())
@@ -3495,9 +3758,9 @@ switch (vPC->u.opcode)
         JSValue src2 = callFrame->r(vPC[3].u.operand).jsValue();
         
         if (labelReq && !isPolicy) {
-//            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
+//            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
 //            
-//            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+//            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
 //            {
 //                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
 //                dstLabel.setStar(true);
@@ -3506,15 +3769,15 @@ switch (vPC->u.opcode)
 //                // dstLabel.setStar(false);
 //            }
             JSLabel dstLabel = JSLabel();
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
             {
-                dstLabel = pcLabel.Join(callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+                dstLabel = pcLabel.Join(callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             else {
                 // dstLabel.setStar(false);
-                JSLabel tdstLabel = (callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
+                JSLabel tdstLabel = (callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
                 uint64_t dstL = tdstLabel.Val();
                 /*
                 if (pcLabel <= tdstLabel) {
@@ -3558,7 +3821,7 @@ switch (vPC->u.opcode)
                 CHECK_FOR_EXCEPTION(dstLabel);
                 callFrame->uncheckedR(dst) = result;
             }
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             if (src1.isInt32() && src2.isInt32())
@@ -3582,9 +3845,9 @@ switch (vPC->u.opcode)
         JSValue src = callFrame->r(vPC[2].u.operand).jsValue();
         
         if (labelReq && !isPolicy) {
-//            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(vPC[2].u.operand).getRegLabel());
+//            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(vPC[2].u.operand));
 //            
-//            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+//            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
 //            {
 //                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
 //                dstLabel.setStar(true);
@@ -3593,15 +3856,15 @@ switch (vPC->u.opcode)
 //                // dstLabel.setStar(false);
 //            }
             JSLabel dstLabel = JSLabel();
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
             {
-                dstLabel = pcLabel.Join(callFrame->r(vPC[2].u.operand).getRegLabel());
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+                dstLabel = pcLabel.Join(callFrame->regLabel(vPC[2].u.operand));
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             else {
                 // dstLabel.setStar(false);
-                JSLabel tdstLabel = (callFrame->r(vPC[2].u.operand).getRegLabel());
+                JSLabel tdstLabel = (callFrame->regLabel(vPC[2].u.operand));
                 uint64_t dstL = tdstLabel.Val();
                 /*
                 if (pcLabel <= tdstLabel) {
@@ -3642,7 +3905,7 @@ switch (vPC->u.opcode)
                 callFrame->uncheckedR(dst) = jsBoolean(false);
             else
                 callFrame->uncheckedR(dst) = jsBoolean(!src.isCell() || !src.asCell()->structure()->typeInfo().masqueradesAsUndefined());
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             if (src.isUndefinedOrNull())
@@ -3665,11 +3928,11 @@ switch (vPC->u.opcode)
         JSValue src2 = callFrame->r(vPC[3].u.operand).jsValue();
         
         if (labelReq && !isPolicy) {
-            // JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
+            // JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
             
             bool result = JSValue::strictEqual(callFrame, src1, src2);
             
-//            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+//            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
 //            {
 //                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
 //                dstLabel.setStar(true);
@@ -3679,14 +3942,14 @@ switch (vPC->u.opcode)
 //            }
             JSLabel dstLabel = pcLabel;
             CHECK_FOR_EXCEPTION(dstLabel);
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
             {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             else {
                 // dstLabel.setStar(false);
-                JSLabel tdstLabel = (callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
+                JSLabel tdstLabel = (callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
                 uint64_t dstL = tdstLabel.Val();
                 /*
                 if (pcLabel <= tdstLabel) {
@@ -3724,7 +3987,7 @@ switch (vPC->u.opcode)
                 dstLabel = dstLabel/*.Join(codeBlock->contextLabel)*/.Join(JSLabel(dstL));
             }
             callFrame->uncheckedR(dst) = jsBoolean(result);
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel.Join(callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel())));
+            callFrame->setRegLabel(dst, dstLabel.Join(callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand))));
         }
         else {
             bool result = JSValue::strictEqual(callFrame, src1, src2);
@@ -3746,10 +4009,10 @@ switch (vPC->u.opcode)
         JSValue src2 = callFrame->r(vPC[3].u.operand).jsValue();
         
         if (labelReq && !isPolicy) {
-            // JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
+            // JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
             
             bool result = !JSValue::strictEqual(callFrame, src1, src2);
-//            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+//            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
 //            {
 //                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
 //                dstLabel.setStar(true);
@@ -3759,14 +4022,14 @@ switch (vPC->u.opcode)
 //            }
             JSLabel dstLabel = pcLabel;
             CHECK_FOR_EXCEPTION(dstLabel);
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
             {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             else {
                 // dstLabel.setStar(false);
-                JSLabel tdstLabel = (callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
+                JSLabel tdstLabel = (callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
                 uint64_t dstL = tdstLabel.Val();
                 /*
                 if (pcLabel <= tdstLabel) {
@@ -3805,7 +4068,7 @@ switch (vPC->u.opcode)
             }
 
             callFrame->uncheckedR(dst) = jsBoolean(result);
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel.Join(callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel())));
+            callFrame->setRegLabel(dst, dstLabel.Join(callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand))));
         }
         else {
             bool result = !JSValue::strictEqual(callFrame, src1, src2);
@@ -3822,15 +4085,28 @@ switch (vPC->u.opcode)
          with the ECMAScript '<' operator, and puts the result as
          a boolean in register dst.
          */
+        UNLABELED_ENTRY(op_less);
         int dst = vPC[1].u.operand;
         JSValue src1 = callFrame->r(vPC[2].u.operand).jsValue();
         JSValue src2 = callFrame->r(vPC[3].u.operand).jsValue();
         
-        if (labelReq && !isPolicy) {
-            // JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
-            
-            JSValue result = jsBoolean(jsLess<true>(callFrame, src1, src2));
-//            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+        JSValue result = jsBoolean(jsLess<true>(callFrame, src1, src2));
+        CHECK_FOR_EXCEPTION(pcLabel/*.Join(codeBlock->contextLabel)*/);
+        callFrame->uncheckedR(dst) = result;
+        vPC += OPCODE_LENGTH(op_less);
+         NEXT_INSTRUCTION();
+    }
+    DEFINE_LABELED_OPCODE(op_less) {
+        int dst = vPC[1].u.operand;
+        JSValue src1 = callFrame->r(vPC[2].u.operand).jsValue();
+        JSValue src2 = callFrame->r(vPC[3].u.operand).jsValue();
+        
+        if (isPolicy || !labelReq || isLabelFree(codeBlock, vPC - iBegin, callFrame, pcLabel, dst, dst, vPC[2].u.operand, vPC[3].u.operand))
+            goto op_less_unlabeled;
+        // JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
+        
+        JSValue result = jsBoolean(jsLess<true>(callFrame, src1, src2));
+//            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
 //            {
 //                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
 //                dstLabel.setStar(true);
@@ -3839,61 +4115,55 @@ switch (vPC->u.opcode)
 //            {
 //                // dstLabel.setStar(false);
 //            }
-            JSLabel dstLabel = pcLabel;
-            CHECK_FOR_EXCEPTION(dstLabel);
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
-            {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
-                dstLabel.setStar(true);
-            }
-            else {
-                // dstLabel.setStar(false);
-                JSLabel tdstLabel = (callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
-                uint64_t dstL = tdstLabel.Val();
-                /*
-                if (pcLabel <= tdstLabel) {
-                    uint64_t i = 1;
-                    uint64_t pLabel = tdstLabel.pLabel;
-                    tdstLabel.pLabel = 0;
-                    for (int j = 1; j <= 64; j++) {
-                        if (pLabel & i) {
-                            uint64_t bits = BitMap::Bitmap().getBits(i);
-                            uint64_t dLabel = BitMap::Bitmap().getRelLabel(i);
-                            uint64_t aLabel = BitMap::Bitmap().getVarLabel(i);
-                            if (!bits || !(JSLabel(dLabel, 0) <= tdstLabel) || !(tdstLabel <= JSLabel(dLabel, 0))) {
-                                dstL = dstL | aLabel;
-                            }
-                            else {
-                                BitMap::Bitmap().setBits(i, bits - 1);
-                                dstL = dstL | dLabel;
-                            }
+        JSLabel dstLabel = pcLabel;
+        CHECK_FOR_EXCEPTION(dstLabel);
+        if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
+        {
+            IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
+            dstLabel.setStar(true);
+        }
+        else {
+            // dstLabel.setStar(false);
+            JSLabel tdstLabel = (callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
+            uint64_t dstL = tdstLabel.Val();
+            /*
+            if (pcLabel <= tdstLabel) {
+                uint64_t i = 1;
+                uint64_t pLabel = tdstLabel.pLabel;
+                tdstLabel.pLabel = 0;
+                for (int j = 1; j <= 64; j++) {
+                    if (pLabel & i) {
+                        uint64_t bits = BitMap::Bitmap().getBits(i);
+                        uint64_t dLabel = BitMap::Bitmap().getRelLabel(i);
+                        uint64_t aLabel = BitMap::Bitmap().getVarLabel(i);
+                        if (!bits || !(JSLabel(dLabel, 0) <= tdstLabel) || !(tdstLabel <= JSLabel(dLabel, 0))) {
+                            dstL = dstL | aLabel;
                         }
-                        i = i << 1;
-                    }
-                }
-                else {
-                    uint64_t i = 1;
-                    uint64_t pLabel = tdstLabel.pLabel;
-                    tdstLabel.pLabel = 0;
-                    for (int j = 1; j <= 64; j++) {
-                        if (pLabel & i) {
-                            uint64_t dLabel = BitMap::Bitmap().getVarLabel(i);
+                        else {
+                            BitMap::Bitmap().setBits(i, bits - 1);
                             dstL = dstL | dLabel;
                         }
-                        i = i << 1;
                     }
-                }*/
-                dstLabel = dstLabel/*.Join(codeBlock->contextLabel)*/.Join(JSLabel(dstL));
+                    i = i << 1;
+                }
             }
-
-            callFrame->uncheckedR(dst) = result;
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel.Join(callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel())));
-        }
-        else {
-            JSValue result = jsBoolean(jsLess<true>(callFrame, src1, src2));
-            CHECK_FOR_EXCEPTION(pcLabel/*.Join(codeBlock->contextLabel)*/);
-            callFrame->uncheckedR(dst) = result;
+            else {
+                uint64_t i = 1;
+                uint64_t pLabel = tdstLabel.pLabel;
+                tdstLabel.pLabel = 0;
+                for (int j = 1; j <= 64; j++) {
+                    if (pLabel & i) {
+                        uint64_t dLabel = BitMap::Bitmap().getVarLabel(i);
+                        dstL = dstL | dLabel;
+                    }
+                    i = i << 1;
+                }
+            }*/
+            dstLabel = dstLabel/*.Join(codeBlock->contextLabel)*/.Join(JSLabel(dstL));
         }
+
+        callFrame->uncheckedR(dst) = result;
+        callFrame->setRegLabel(dst, dstLabel.Join(callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand))));
         vPC += OPCODE_LENGTH(op_less);
          NEXT_INSTRUCTION();
     }
@@ -3904,16 +4174,29 @@ switch (vPC->u.opcode)
          register src2, as with the ECMAScript '<=' operator, and
          puts the result as a boolean in register dst.
          */
+        UNLABELED_ENTRY(op_lesseq);
         int dst = vPC[1].u.operand;
         JSValue src1 = callFrame->r(vPC[2].u.operand).jsValue();
         JSValue src2 = callFrame->r(vPC[3].u.operand).jsValue();
         
-        if (labelReq && !isPolicy) {
-            //JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
-            
-            JSValue result = jsBoolean(jsLessEq<true>(callFrame, src1, src2));
+        JSValue result = jsBoolean(jsLessEq<true>(callFrame, src1, src2));
+        CHECK_FOR_EXCEPTION(pcLabel/*.Join(codeBlock->contextLabel)*/);
+        callFrame->uncheckedR(dst) = result;
+        vPC += OPCODE_LENGTH(op_lesseq);
+         NEXT_INSTRUCTION();
+    }
+    DEFINE_LABELED_OPCODE(op_lesseq) {
+        int dst = vPC[1].u.operand;
+        JSValue src1 = callFrame->r(vPC[2].u.operand).jsValue();
+        JSValue src2 = callFrame->r(vPC[3].u.operand).jsValue();
+        
+        if (isPolicy || !labelReq || isLabelFree(codeBlock, vPC - iBegin, callFrame, pcLabel, dst, dst, vPC[2].u.operand, vPC[3].u.operand))
+            goto op_lesseq_unlabeled;
+        //JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
+        
+        JSValue result = jsBoolean(jsLessEq<true>(callFrame, src1, src2));
 //            CHECK_FOR_EXCEPTION(dstLabel);
-//            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+//            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
 //            {
 //                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
 //                dstLabel.setStar(true);
@@ -3921,61 +4204,55 @@ switch (vPC->u.opcode)
 //            else {
 //                // dstLabel.setStar(false);
 //            }
-            JSLabel dstLabel = pcLabel;
-            CHECK_FOR_EXCEPTION(dstLabel);
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
-            {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
-                dstLabel.setStar(true);
-            }
-            else {
-                // dstLabel.setStar(false);
-                JSLabel tdstLabel = (callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
-                uint64_t dstL = tdstLabel.Val();
-                /*
-                if (pcLabel <= tdstLabel) {
-                    uint64_t i = 1;
-                    uint64_t pLabel = tdstLabel.pLabel;
-                    tdstLabel.pLabel = 0;
-                    for (int j = 1; j <= 64; j++) {
-                        if (pLabel & i) {
-                            uint64_t bits = BitMap::Bitmap().getBits(i);
-                            uint64_t dLabel = BitMap::Bitmap().getRelLabel(i);
-                            uint64_t aLabel = BitMap::Bitmap().getVarLabel(i);
-                            if (!bits || !(JSLabel(dLabel, 0) <= tdstLabel) || !(tdstLabel <= JSLabel(dLabel, 0))) {
-                                dstL = dstL | aLabel;
-                            }
-                            else {
-                                BitMap::Bitmap().setBits(i, bits - 1);
-                                dstL = dstL | dLabel;
-                            }
+        JSLabel dstLabel = pcLabel;
+        CHECK_FOR_EXCEPTION(dstLabel);
+        if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
+        {
+            IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
+            dstLabel.setStar(true);
+        }
+        else {
+            // dstLabel.setStar(false);
+            JSLabel tdstLabel = (callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
+            uint64_t dstL = tdstLabel.Val();
+            /*
+            if (pcLabel <= tdstLabel) {
+                uint64_t i = 1;
+                uint64_t pLabel = tdstLabel.pLabel;
+                tdstLabel.pLabel = 0;
+                for (int j = 1; j <= 64; j++) {
+                    if (pLabel & i) {
+                        uint64_t bits = BitMap::Bitmap().getBits(i);
+                        uint64_t dLabel = BitMap::Bitmap().getRelLabel(i);
+                        uint64_t aLabel = BitMap::Bitmap().getVarLabel(i);
+                        if (!bits || !(JSLabel(dLabel, 0) <= tdstLabel) || !(tdstLabel <= JSLabel(dLabel, 0))) {
+                            dstL = dstL | aLabel;
                         }
-                        i = i << 1;
-                    }
-                }
-                else {
-                    uint64_t i = 1;
-                    uint64_t pLabel = tdstLabel.pLabel;
-                    tdstLabel.pLabel = 0;
-                    for (int j = 1; j <= 64; j++) {
-                        if (pLabel & i) {
-                            uint64_t dLabel = BitMap::Bitmap().getVarLabel(i);
+                        else {
+                            BitMap::Bitmap().setBits(i, bits - 1);
                             dstL = dstL | dLabel;
                         }
-                        i = i << 1;
                     }
-                }*/
-                dstLabel = dstLabel/*.Join(codeBlock->contextLabel)*/.Join(JSLabel(dstL));
+                    i = i << 1;
+                }
             }
-            
-            callFrame->uncheckedR(dst) = result;
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel.Join(callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel())));
-        }
-        else {
-            JSValue result = jsBoolean(jsLessEq<true>(callFrame, src1, src2));
-            CHECK_FOR_EXCEPTION(pcLabel/*.Join(codeBlock->contextLabel)*/);
-            callFrame->uncheckedR(dst) = result;
+            else {
+                uint64_t i = 1;
+                uint64_t pLabel = tdstLabel.pLabel;
+                tdstLabel.pLabel = 0;
+                for (int j = 1; j <= 64; j++) {
+                    if (pLabel & i) {
+                        uint64_t dLabel = BitMap::Bitmap().getVarLabel(i);
+                        dstL = dstL | dLabel;
+                    }
+                    i = i << 1;
+                }
+            }*/
+            dstLabel = dstLabel/*.Join(codeBlock->contextLabel)*/.Join(JSLabel(dstL));
         }
+        
+        callFrame->uncheckedR(dst) = result;
+        callFrame->setRegLabel(dst, dstLabel.Join(callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand))));
         vPC += OPCODE_LENGTH(op_lesseq);
          NEXT_INSTRUCTION();
     }
@@ -3986,16 +4263,29 @@ switch (vPC->u.opcode)
          with the ECMAScript '>' operator, and puts the result as
          a boolean in register dst.
          */
+        UNLABELED_ENTRY(op_greater);
         int dst = vPC[1].u.operand;
         JSValue src1 = callFrame->r(vPC[2].u.operand).jsValue();
         JSValue src2 = callFrame->r(vPC[3].u.operand).jsValue();
         
-        if (labelReq && !isPolicy) {
-            // JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
-            
-            JSValue result = jsBoolean(jsLess<false>(callFrame, src2, src1));
+        JSValue result = jsBoolean(jsLess<false>(callFrame, src2, src1));
+        CHECK_FOR_EXCEPTION(pcLabel/*.Join(codeBlock->contextLabel)*/);
+        callFrame->uncheckedR(dst) = result;
+        vPC += OPCODE_LENGTH(op_greater);
+         NEXT_INSTRUCTION();
+    }
+    DEFINE_LABELED_OPCODE(op_greater) {
+        int dst = vPC[1].u.operand;
+        JSValue src1 = callFrame->r(vPC[2].u.operand).jsValue();
+        JSValue src2 = callFrame->r(vPC[3].u.operand).jsValue();
+        
+        if (isPolicy || !labelReq || isLabelFree(codeBlock, vPC - iBegin, callFrame, pcLabel, dst, dst, vPC[2].u.operand, vPC[3].u.operand))
+            goto op_greater_unlabeled;
+        // JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
+        
+        JSValue result = jsBoolean(jsLess<false>(callFrame, src2, src1));
 //            CHECK_FOR_EXCEPTION(dstLabel);
-//            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+//            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
 //            {
 //                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
 //                dstLabel.setStar(true);
@@ -4003,60 +4293,54 @@ switch (vPC->u.opcode)
 //            else {
 //                // dstLabel.setStar(false);
 //            }
-            JSLabel dstLabel = pcLabel;
-            CHECK_FOR_EXCEPTION(dstLabel);
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
-            {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
-                dstLabel.setStar(true);
-            }
-            else {
-                // dstLabel.setStar(false);
-                JSLabel tdstLabel = (callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
-                uint64_t dstL = tdstLabel.Val();
-                /*
-                if (pcLabel <= tdstLabel) {
-                    uint64_t i = 1;
-                    uint64_t pLabel = tdstLabel.pLabel;
-                    tdstLabel.pLabel = 0;
-                    for (int j = 1; j <= 64; j++) {
-                        if (pLabel & i) {
-                            uint64_t bits = BitMap::Bitmap().getBits(i);
-                            uint64_t dLabel = BitMap::Bitmap().getRelLabel(i);
-                            uint64_t aLabel = BitMap::Bitmap().getVarLabel(i);
-                            if (!bits || !(JSLabel(dLabel, 0) <= tdstLabel) || !(tdstLabel <= JSLabel(dLabel, 0))) {
-                                dstL = dstL | aLabel;
-                            }
-                            else {
-                                BitMap::Bitmap().setBits(i, bits - 1);
-                                dstL = dstL | dLabel;
-                            }
+        JSLabel dstLabel = pcLabel;
+        CHECK_FOR_EXCEPTION(dstLabel);
+        if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
+        {
+            IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
+            dstLabel.setStar(true);
+        }
+        else {
+            // dstLabel.setStar(false);
+            JSLabel tdstLabel = (callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
+            uint64_t dstL = tdstLabel.Val();
+            /*
+            if (pcLabel <= tdstLabel) {
+                uint64_t i = 1;
+                uint64_t pLabel = tdstLabel.pLabel;
+                tdstLabel.pLabel = 0;
+                for (int j = 1; j <= 64; j++) {
+                    if (pLabel & i) {
+                        uint64_t bits = BitMap::Bitmap().getBits(i);
+                        uint64_t dLabel = BitMap::Bitmap().getRelLabel(i);
+                        uint64_t aLabel = BitMap::Bitmap().getVarLabel(i);
+                        if (!bits || !(JSLabel(dLabel, 0) <= tdstLabel) || !(tdstLabel <= JSLabel(dLabel, 0))) {
+                            dstL = dstL | aLabel;
                         }
-                        i = i << 1;
-                    }
-                }
-                else {
-                    uint64_t i = 1;
-                    uint64_t pLabel = tdstLabel.pLabel;
-                    tdstLabel.pLabel = 0;
-                    for (int j = 1; j <= 64; j++) {
-                        if (pLabel & i) {
-                            uint64_t dLabel = BitMap::Bitmap().getVarLabel(i);
+                        else {
+                            BitMap::Bitmap().setBits(i, bits - 1);
                             dstL = dstL | dLabel;
                         }
-                        i = i << 1;
                     }
-                }*/
-                dstLabel = dstLabel/*.Join(codeBlock->contextLabel)*/.Join(JSLabel(dstL));
+                    i = i << 1;
+                }
             }
-            callFrame->uncheckedR(dst) = result;
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel.Join(callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel())));
-        }
-        else {
-            JSValue result = jsBoolean(jsLess<false>(callFrame, src2, src1));
-            CHECK_FOR_EXCEPTION(pcLabel/*.Join(codeBlock->contextLabel)*/);
-            callFrame->uncheckedR(dst) = result;
+            else {
+                uint64_t i = 1;
+                uint64_t pLabel = tdstLabel.pLabel;
+                tdstLabel.pLabel = 0;
+                for (int j = 1; j <= 64; j++) {
+                    if (pLabel & i) {
+                        uint64_t dLabel = BitMap::Bitmap().getVarLabel(i);
+                        dstL = dstL | dLabel;
+                    }
+                    i = i << 1;
+                }
+            }*/
+            dstLabel = dstLabel/*.Join(codeBlock->contextLabel)*/.Join(JSLabel(dstL));
         }
+        callFrame->uncheckedR(dst) = result;
+        callFrame->setRegLabel(dst, dstLabel.Join(callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand))));
         vPC += OPCODE_LENGTH(op_greater);
          NEXT_INSTRUCTION();
     }
@@ -4067,16 +4351,29 @@ switch (vPC->u.opcode)
          register src2, as with the ECMAScript '>=' operator, and
          puts the result as a boolean in register dst.
          */
+        UNLABELED_ENTRY(op_greatereq);
         int dst = vPC[1].u.operand;
         JSValue src1 = callFrame->r(vPC[2].u.operand).jsValue();
         JSValue src2 = callFrame->r(vPC[3].u.operand).jsValue();
         
-        if (labelReq && !isPolicy) {
-            // JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
-            
-            JSValue result = jsBoolean(jsLessEq<false>(callFrame, src2, src1));
+        JSValue result = jsBoolean(jsLessEq<false>(callFrame, src2, src1));
+        CHECK_FOR_EXCEPTION(pcLabel/*.Join(codeBlock->contextLabel)*/);
+        callFrame->uncheckedR(dst) = result;
+        vPC += OPCODE_LENGTH(op_greatereq);
+         NEXT_INSTRUCTION();
+    }
+    DEFINE_LABELED_OPCODE(op_greatereq) {
+        int dst = vPC[1].u.operand;
+        JSValue src1 = callFrame->r(vPC[2].u.operand).jsValue();
+        JSValue src2 = callFrame->r(vPC[3].u.operand).jsValue();
+        
+        if (isPolicy || !labelReq || isLabelFree(codeBlock, vPC - iBegin, callFrame, pcLabel, dst, dst, vPC[2].u.operand, vPC[3].u.operand))
+            goto op_greatereq_unlabeled;
+        // JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
+        
+        JSValue result = jsBoolean(jsLessEq<false>(callFrame, src2, src1));
 //            CHECK_FOR_EXCEPTION(dstLabel);
-//            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+//            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
 //            {
 //                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
 //                dstLabel.setStar(true);
@@ -4084,60 +4381,54 @@ switch (vPC->u.opcode)
 //            else {
 //                // dstLabel.setStar(false);
 //            }
-            JSLabel dstLabel = pcLabel.Join(callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
-            CHECK_FOR_EXCEPTION(dstLabel);
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
-            {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
-                dstLabel.setStar(true);
-            }
-            else {
-                // dstLabel.setStar(false);
-                JSLabel tdstLabel = (callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
-                uint64_t dstL = tdstLabel.Val();
-                /*
-                if (pcLabel <= tdstLabel) {
-                    uint64_t i = 1;
-                    uint64_t pLabel = tdstLabel.pLabel;
-                    tdstLabel.pLabel = 0;
-                    for (int j = 1; j <= 64; j++) {
-                        if (pLabel & i) {
-                            uint64_t bits = BitMap::Bitmap().getBits(i);
-                            uint64_t dLabel = BitMap::Bitmap().getRelLabel(i);
-                            uint64_t aLabel = BitMap::Bitmap().getVarLabel(i);
-                            if (!bits || !(JSLabel(dLabel, 0) <= tdstLabel) || !(tdstLabel <= JSLabel(dLabel, 0))) {
-                                dstL = dstL | aLabel;
-                            }
-                            else {
-                                BitMap::Bitmap().setBits(i, bits - 1);
-                                dstL = dstL | dLabel;
-                            }
+        JSLabel dstLabel = pcLabel.Join(callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
+        CHECK_FOR_EXCEPTION(dstLabel);
+        if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
+        {
+            IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
+            dstLabel.setStar(true);
+        }
+        else {
+            // dstLabel.setStar(false);
+            JSLabel tdstLabel = (callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
+            uint64_t dstL = tdstLabel.Val();
+            /*
+            if (pcLabel <= tdstLabel) {
+                uint64_t i = 1;
+                uint64_t pLabel = tdstLabel.pLabel;
+                tdstLabel.pLabel = 0;
+                for (int j = 1; j <= 64; j++) {
+                    if (pLabel & i) {
+                        uint64_t bits = BitMap::Bitmap().getBits(i);
+                        uint64_t dLabel = BitMap::Bitmap().getRelLabel(i);
+                        uint64_t aLabel = BitMap::Bitmap().getVarLabel(i);
+                        if (!bits || !(JSLabel(dLabel, 0) <= tdstLabel) || !(tdstLabel <= JSLabel(dLabel, 0))) {
+                            dstL = dstL | aLabel;
                         }
-                        i = i << 1;
-                    }
-                }
-                else {
-                    uint64_t i = 1;
-                    uint64_t pLabel = tdstLabel.pLabel;
-                    tdstLabel.pLabel = 0;
-                    for (int j = 1; j <= 64; j++) {
-                        if (pLabel & i) {
-                            uint64_t dLabel = BitMap::Bitmap().getVarLabel(i);
+                        else {
+                            BitMap::Bitmap().setBits(i, bits - 1);
                             dstL = dstL | dLabel;
                         }
-                        i = i << 1;
                     }
-                }*/
-                dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(JSLabel(dstL));
+                    i = i << 1;
+                }
             }
-            callFrame->uncheckedR(dst) = result;
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
-        }
-        else {
-            JSValue result = jsBoolean(jsLessEq<false>(callFrame, src2, src1));
-            CHECK_FOR_EXCEPTION(pcLabel/*.Join(codeBlock->contextLabel)*/);
-            callFrame->uncheckedR(dst) = result;
+            else {
+                uint64_t i = 1;
+                uint64_t pLabel = tdstLabel.pLabel;
+                tdstLabel.pLabel = 0;
+                for (int j = 1; j <= 64; j++) {
+                    if (pLabel & i) {
+                        uint64_t dLabel = BitMap::Bitmap().getVarLabel(i);
+                        dstL = dstL | dLabel;
+                    }
+                    i = i << 1;
+                }
+            }*/
+            dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(JSLabel(dstL));
         }
+        callFrame->uncheckedR(dst) = result;
+        callFrame->setRegLabel(dst, dstLabel);
         vPC += OPCODE_LENGTH(op_greatereq);
          NEXT_INSTRUCTION();
     }
@@ -4147,36 +4438,42 @@ switch (vPC->u.opcode)
          Converts register srcDst to number, adds one, and puts the result
          back in register srcDst.
          */
+        UNLABELED_ENTRY(op_pre_inc);
         int srcDst = vPC[1].u.operand;
         JSValue v = callFrame->r(srcDst).jsValue();
         
-        if (labelReq && !isPolicy) {
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(srcDst).getRegLabel());
+        if (v.isInt32() && v.asInt32() < INT_MAX)
+            callFrame->uncheckedR(srcDst) = jsNumber(v.asInt32() + 1);
+        else {
+            JSValue result = jsNumber(v.toNumber(callFrame) + 1);
+            CHECK_FOR_EXCEPTION(pcLabel/*.Join(codeBlock->contextLabel)*/);
+            callFrame->uncheckedR(srcDst) = result;
+        }
+        vPC += OPCODE_LENGTH(op_pre_inc);
+         NEXT_INSTRUCTION();
+    }
+    DEFINE_LABELED_OPCODE(op_pre_inc) {
+        int srcDst = vPC[1].u.operand;
+        JSValue v = callFrame->r(srcDst).jsValue();
+        
+        if (isPolicy || !labelReq || isLabelFree(codeBlock, vPC - iBegin, callFrame, pcLabel, srcDst, srcDst, srcDst, srcDst))
+            goto op_pre_inc_unlabeled;
+        JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(srcDst));
 
-            if (!noSensitiveUpgrade(callFrame->r(srcDst).getRegLabel()))
-            {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(srcDst).getRegLabel().Val(), pcLabel.Val());
-                dstLabel.setStar(true);
-            }
-            
-            if (v.isInt32() && v.asInt32() < INT_MAX)
-                callFrame->uncheckedR(srcDst) = jsNumber(v.asInt32() + 1);
-            else {
-                JSValue result = jsNumber(v.toNumber(callFrame) + 1);
-                CHECK_FOR_EXCEPTION(dstLabel);
-                callFrame->uncheckedR(srcDst) = result;
-            }
-            callFrame->uncheckedR(srcDst).setRegLabel(dstLabel);
+        if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(srcDst)))
+        {
+            IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(srcDst).Val(), pcLabel.Val());
+            dstLabel.setStar(true);
         }
+        
+        if (v.isInt32() && v.asInt32() < INT_MAX)
+            callFrame->uncheckedR(srcDst) = jsNumber(v.asInt32() + 1);
         else {
-            if (v.isInt32() && v.asInt32() < INT_MAX)
-                callFrame->uncheckedR(srcDst) = jsNumber(v.asInt32() + 1);
-            else {
-                JSValue result = jsNumber(v.toNumber(callFrame) + 1);
-                CHECK_FOR_EXCEPTION(pcLabel/*.Join(codeBlock->contextLabel)*/);
-                callFrame->uncheckedR(srcDst) = result;
-            }
+            JSValue result = jsNumber(v.toNumber(callFrame) + 1);
+            CHECK_FOR_EXCEPTION(dstLabel);
+            callFrame->uncheckedR(srcDst) = result;
         }
+        callFrame->setRegLabel(srcDst, dstLabel);
         vPC += OPCODE_LENGTH(op_pre_inc);
          NEXT_INSTRUCTION();
     }
@@ -4186,36 +4483,42 @@ switch (vPC->u.opcode)
          Converts register srcDst to number, subtracts one, and puts the result
          back in register srcDst.
          */
+        UNLABELED_ENTRY(op_pre_dec);
         int srcDst = vPC[1].u.operand;
         JSValue v = callFrame->r(srcDst).jsValue();
         
-        if (labelReq && !isPolicy) {
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(srcDst).getRegLabel());
+        if (v.isInt32() && v.asInt32() > INT_MIN)
+            callFrame->uncheckedR(srcDst) = jsNumber(v.asInt32() - 1);
+        else {
+            JSValue result = jsNumber(v.toNumber(callFrame) - 1);
+            CHECK_FOR_EXCEPTION(pcLabel/*.Join(codeBlock->contextLabel)*/);
+            callFrame->uncheckedR(srcDst) = result;
+        }
+        vPC += OPCODE_LENGTH(op_pre_dec);
+         NEXT_INSTRUCTION();
+    }
+    DEFINE_LABELED_OPCODE(op_pre_dec) {
+        int srcDst = vPC[1].u.operand;
+        JSValue v = callFrame->r(srcDst).jsValue();
         
-            if (!noSensitiveUpgrade(callFrame->r(srcDst).getRegLabel()))
-            {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(srcDst).getRegLabel().Val(), pcLabel.Val());
-                dstLabel.setStar(true);
-            }
-            
-            if (v.isInt32() && v.asInt32() > INT_MIN)
-                callFrame->uncheckedR(srcDst) = jsNumber(v.asInt32() - 1);
-            else {
-                JSValue result = jsNumber(v.toNumber(callFrame) - 1);
-                CHECK_FOR_EXCEPTION(dstLabel);
-                callFrame->uncheckedR(srcDst) = result;
-            }
-            callFrame->uncheckedR(srcDst).setRegLabel(dstLabel);
+        if (isPolicy || !labelReq || isLabelFree(codeBlock, vPC - iBegin, callFrame, pcLabel, srcDst, srcDst, srcDst, srcDst))
+            goto op_pre_dec_unlabeled;
+        JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(srcDst));
+    
+        if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(srcDst)))
+        {
+            IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(srcDst).Val(), pcLabel.Val());
+            dstLabel.setStar(true);
         }
+        
+        if (v.isInt32() && v.asInt32() > INT_MIN)
+            callFrame->uncheckedR(srcDst) = jsNumber(v.asInt32() - 1);
         else {
-            if (v.isInt32() && v.asInt32() > INT_MIN)
-                callFrame->uncheckedR(srcDst) = jsNumber(v.asInt32() - 1);
-            else {
-                JSValue result = jsNumber(v.toNumber(callFrame) - 1);
-                CHECK_FOR_EXCEPTION(pcLabel/*.Join(codeBlock->contextLabel)*/);
-                callFrame->uncheckedR(srcDst) = result;
-            }
+            JSValue result = jsNumber(v.toNumber(callFrame) - 1);
+            CHECK_FOR_EXCEPTION(dstLabel);
+            callFrame->uncheckedR(srcDst) = result;
         }
+        callFrame->setRegLabel(srcDst, dstLabel);
         vPC += OPCODE_LENGTH(op_pre_dec);
          NEXT_INSTRUCTION();
     }
@@ -4226,51 +4529,58 @@ switch (vPC->u.opcode)
          written to register dst, and the number plus one is written
          back to register srcDst.
          */
+        UNLABELED_ENTRY(op_post_inc);
         int dst = vPC[1].u.operand;
         int srcDst = vPC[2].u.operand;
         JSValue v = callFrame->r(srcDst).jsValue();
         
-        if (labelReq && !isPolicy) {
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(srcDst).getRegLabel());
+        if (v.isInt32() && v.asInt32() < INT_MAX) {
+            callFrame->uncheckedR(srcDst) = jsNumber(v.asInt32() + 1);
+            callFrame->uncheckedR(dst) = v;
+        } else {
+            double number = callFrame->r(srcDst).jsValue().toNumber(callFrame);
+            CHECK_FOR_EXCEPTION(pcLabel/*.Join(codeBlock->contextLabel)*/);
+            callFrame->uncheckedR(srcDst) = jsNumber(number + 1);
+            callFrame->uncheckedR(dst) = jsNumber(number);
+        }
+        vPC += OPCODE_LENGTH(op_post_inc);
+         NEXT_INSTRUCTION();
+    }
+    DEFINE_LABELED_OPCODE(op_post_inc) {
+        int dst = vPC[1].u.operand;
+        int srcDst = vPC[2].u.operand;
+        JSValue v = callFrame->r(srcDst).jsValue();
         
-            JSLabel srcDstLabel = dstLabel;
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
-            {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
-                dstLabel.setStar(true);
-            }
-            
-            if (!noSensitiveUpgrade(callFrame->r(srcDst).getRegLabel()))
-            {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(srcDst).getRegLabel().Val(), pcLabel.Val());
-                srcDstLabel.setStar(true);
-            }
-            else {
-                // srcDstLabel.setStar(false);
-            }
-            if (v.isInt32() && v.asInt32() < INT_MAX) {
-                callFrame->uncheckedR(srcDst) = jsNumber(v.asInt32() + 1);
-                callFrame->uncheckedR(dst) = v;
-            } else {
-                double number = callFrame->r(srcDst).jsValue().toNumber(callFrame);
-                CHECK_FOR_EXCEPTION(dstLabel);
-                callFrame->uncheckedR(srcDst) = jsNumber(number + 1);
-                callFrame->uncheckedR(dst) = jsNumber(number);
-            }
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
-            callFrame->uncheckedR(srcDst).setRegLabel(srcDstLabel);
+        if (isPolicy || !labelReq || isLabelFree(codeBlock, vPC - iBegin, callFrame, pcLabel, dst, srcDst, srcDst, srcDst))
+            goto op_post_inc_unlabeled;
+        JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(srcDst));
+    
+        JSLabel srcDstLabel = dstLabel;
+        if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
+        {
+            IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
+            dstLabel.setStar(true);
+        }
+        
+        if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(srcDst)))
+        {
+            IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(srcDst).Val(), pcLabel.Val());
+            srcDstLabel.setStar(true);
         }
         else {
-            if (v.isInt32() && v.asInt32() < INT_MAX) {
-                callFrame->uncheckedR(srcDst) = jsNumber(v.asInt32() + 1);
-                callFrame->uncheckedR(dst) = v;
-            } else {
-                double number = callFrame->r(srcDst).jsValue().toNumber(callFrame);
-                CHECK_FOR_EXCEPTION(pcLabel/*.Join(codeBlock->contextLabel)*/);
-                callFrame->uncheckedR(srcDst) = jsNumber(number + 1);
-                callFrame->uncheckedR(dst) = jsNumber(number);
-            }
+            // srcDstLabel.setStar(false);
         }
+        if (v.isInt32() && v.asInt32() < INT_MAX) {
+            callFrame->uncheckedR(srcDst) = jsNumber(v.asInt32() + 1);
+            callFrame->uncheckedR(dst) = v;
+        } else {
+            double number = callFrame->r(srcDst).jsValue().toNumber(callFrame);
+            CHECK_FOR_EXCEPTION(dstLabel);
+            callFrame->uncheckedR(srcDst) = jsNumber(number + 1);
+            callFrame->uncheckedR(dst) = jsNumber(number);
+        }
+        callFrame->setRegLabel(dst, dstLabel);
+        callFrame->setRegLabel(srcDst, srcDstLabel);
         vPC += OPCODE_LENGTH(op_post_inc);
          NEXT_INSTRUCTION();
     }
@@ -4281,50 +4591,57 @@ switch (vPC->u.opcode)
          written to register dst, and the number minus one is written
          back to register srcDst.
          */
+        UNLABELED_ENTRY(op_post_dec);
+        int dst = vPC[1].u.operand;
+        int srcDst = vPC[2].u.operand;
+        JSValue v = callFrame->r(srcDst).jsValue();
+        
+        if (v.isInt32() && v.asInt32() > INT_MIN) {
+            callFrame->uncheckedR(srcDst) = jsNumber(v.asInt32() - 1);
+            callFrame->uncheckedR(dst) = v;
+        } else {
+            double number = callFrame->r(srcDst).jsValue().toNumber(callFrame);
+            CHECK_FOR_EXCEPTION(pcLabel/*.Join(codeBlock->contextLabel)*/);
+            callFrame->uncheckedR(srcDst) = jsNumber(number - 1);
+            callFrame->uncheckedR(dst) = jsNumber(number);
+        }
+        vPC += OPCODE_LENGTH(op_post_dec);
+         NEXT_INSTRUCTION();
+    }
+    DEFINE_LABELED_OPCODE(op_post_dec) {
         int dst = vPC[1].u.operand;
         int srcDst = vPC[2].u.operand;
         JSValue v = callFrame->r(srcDst).jsValue();
         
-        if (labelReq && !isPolicy) {
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(srcDst).getRegLabel());
-            JSLabel srcDstLabel = dstLabel;
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
-            {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
-                dstLabel.setStar(true);
-            }
-            
-            if (!noSensitiveUpgrade(callFrame->r(srcDst).getRegLabel()))
-            {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(srcDst).getRegLabel().Val(), pcLabel.Val());
-                srcDstLabel.setStar(true);
-            }
-            else {
-                // srcDstLabel.setStar(false);
-            }
-            if (v.isInt32() && v.asInt32() > INT_MIN) {
-                callFrame->uncheckedR(srcDst) = jsNumber(v.asInt32() - 1);
-                callFrame->uncheckedR(dst) = v;
-            } else {
-                double number = callFrame->r(srcDst).jsValue().toNumber(callFrame);
-                CHECK_FOR_EXCEPTION(dstLabel);
-                callFrame->uncheckedR(srcDst) = jsNumber(number - 1);
-                callFrame->uncheckedR(dst) = jsNumber(number);
-            }
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
-            callFrame->uncheckedR(srcDst).setRegLabel(srcDstLabel);
+        if (isPolicy || !labelReq || isLabelFree(codeBlock, vPC - iBegin, callFrame, pcLabel, dst, srcDst, srcDst, srcDst))
+            goto op_post_dec_unlabeled;
+        JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(srcDst));
+        JSLabel srcDstLabel = dstLabel;
+        if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
+        {
+            IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
+            dstLabel.setStar(true);
+        }
+        
+        if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(srcDst)))
+        {
+            IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(srcDst).Val(), pcLabel.Val());
+            srcDstLabel.setStar(true);
         }
         else {
-            if (v.isInt32() && v.asInt32() > INT_MIN) {
-                callFrame->uncheckedR(srcDst) = jsNumber(v.asInt32() - 1);
-                callFrame->uncheckedR(dst) = v;
-            } else {
-                double number = callFrame->r(srcDst).jsValue().toNumber(callFrame);
-                CHECK_FOR_EXCEPTION(pcLabel/*.Join(codeBlock->contextLabel)*/);
-                callFrame->uncheckedR(srcDst) = jsNumber(number - 1);
-                callFrame->uncheckedR(dst) = jsNumber(number);
-            }
+            // srcDstLabel.setStar(false);
+        }
+        if (v.isInt32() && v.asInt32() > INT_MIN) {
+            callFrame->uncheckedR(srcDst) = jsNumber(v.asInt32() - 1);
+            callFrame->uncheckedR(dst) = v;
+        } else {
+            double number = callFrame->r(srcDst).jsValue().toNumber(callFrame);
+            CHECK_FOR_EXCEPTION(dstLabel);
+            callFrame->uncheckedR(srcDst) = jsNumber(number - 1);
+            callFrame->uncheckedR(dst) = jsNumber(number);
         }
+        callFrame->setRegLabel(dst, dstLabel);
+        callFrame->setRegLabel(srcDst, srcDstLabel);
         vPC += OPCODE_LENGTH(op_post_dec);
          NEXT_INSTRUCTION();
     }
@@ -4339,10 +4656,10 @@ switch (vPC->u.opcode)
         JSValue srcVal = callFrame->r(src).jsValue();
         
         if (labelReq && !isPolicy) {
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(src).getRegLabel());
+            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(src));
         
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
@@ -4353,7 +4670,7 @@ switch (vPC->u.opcode)
                 CHECK_FOR_EXCEPTION(dstLabel);
                 callFrame->uncheckedR(dst) = jsNumber(number);
             }
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             if (LIKELY(srcVal.isNumber()))
@@ -4377,10 +4694,10 @@ switch (vPC->u.opcode)
         JSValue src = callFrame->r(vPC[2].u.operand).jsValue();
         
         if (labelReq && !isPolicy) {
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(vPC[2].u.operand).getRegLabel());
+            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(vPC[2].u.operand));
         
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
@@ -4391,7 +4708,7 @@ switch (vPC->u.opcode)
                 CHECK_FOR_EXCEPTION(dstLabel);
                 callFrame->uncheckedR(dst) = result;
             }
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             if (src.isInt32() && (src.asInt32() & 0x7fffffff)) // non-zero and no overflow
@@ -4412,36 +4729,43 @@ switch (vPC->u.opcode)
          in register dst. (JS add may be string concatenation or
          numeric add, depending on the types of the operands.)
          */
+        UNLABELED_ENTRY(op_add);
         int dst = vPC[1].u.operand;
         JSValue src1 = callFrame->r(vPC[2].u.operand).jsValue();
         JSValue src2 = callFrame->r(vPC[3].u.operand).jsValue();
         
-        if (labelReq && !isPolicy) {
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
+        if (src1.isInt32() && src2.isInt32() && !((src1.asInt32() | src2.asInt32()) & 0xc0000000)) // no overflow
+            callFrame->uncheckedR(dst) = jsNumber(src1.asInt32() + src2.asInt32());
+        else {
+            JSValue result = jsAdd(callFrame, src1, src2);
+            CHECK_FOR_EXCEPTION(pcLabel/*.Join(codeBlock->contextLabel)*/);
+            callFrame->uncheckedR(dst) = result;
+        }
+        vPC += OPCODE_LENGTH(op_add);
+         NEXT_INSTRUCTION();
+    }
+    DEFINE_LABELED_OPCODE(op_add) {
+        int dst = vPC[1].u.operand;
+        JSValue src1 = callFrame->r(vPC[2].u.operand).jsValue();
+        JSValue src2 = callFrame->r(vPC[3].u.operand).jsValue();
         
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
-                dstLabel.setStar(true);
-            }
-            
-            if (src1.isInt32() && src2.isInt32() && !((src1.asInt32() | src2.asInt32()) & 0xc0000000)) // no overflow
-                callFrame->uncheckedR(dst) = jsNumber(src1.asInt32() + src2.asInt32());
-            else {
-                JSValue result = jsAdd(callFrame, src1, src2);
-                CHECK_FOR_EXCEPTION(dstLabel);
-                callFrame->uncheckedR(dst) = result;
-            }
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+        if (isPolicy || !labelReq || isLabelFree(codeBlock, vPC - iBegin, callFrame, pcLabel, dst, dst, vPC[2].u.operand, vPC[3].u.operand))
+            goto op_add_unlabeled;
+        JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
+    
+        if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+            IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
+            dstLabel.setStar(true);
         }
+        
+        if (src1.isInt32() && src2.isInt32() && !((src1.asInt32() | src2.asInt32()) & 0xc0000000)) // no overflow
+            callFrame->uncheckedR(dst) = jsNumber(src1.asInt32() + src2.asInt32());
         else {
-            if (src1.isInt32() && src2.isInt32() && !((src1.asInt32() | src2.asInt32()) & 0xc0000000)) // no overflow
-                callFrame->uncheckedR(dst) = jsNumber(src1.asInt32() + src2.asInt32());
-            else {
-                JSValue result = jsAdd(callFrame, src1, src2);
-                CHECK_FOR_EXCEPTION(pcLabel/*.Join(codeBlock->contextLabel)*/);
-                callFrame->uncheckedR(dst) = result;
-            }
+            JSValue result = jsAdd(callFrame, src1, src2);
+            CHECK_FOR_EXCEPTION(dstLabel);
+            callFrame->uncheckedR(dst) = result;
         }
+        callFrame->setRegLabel(dst, dstLabel);
         vPC += OPCODE_LENGTH(op_add);
          NEXT_INSTRUCTION();
     }
@@ -4451,36 +4775,43 @@ switch (vPC->u.opcode)
          Multiplies register src1 and register src2 (converted to
          numbers), and puts the product in register dst.
          */
+        UNLABELED_ENTRY(op_mul);
         int dst = vPC[1].u.operand;
         JSValue src1 = callFrame->r(vPC[2].u.operand).jsValue();
         JSValue src2 = callFrame->r(vPC[3].u.operand).jsValue();
         
-        if (labelReq && !isPolicy) {
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
+        if (src1.isInt32() && src2.isInt32() && !(src1.asInt32() | src2.asInt32()) >> 15) // no overflow
+            callFrame->uncheckedR(dst) = jsNumber(src1.asInt32() * src2.asInt32());
+        else {
+            JSValue result = jsNumber(src1.toNumber(callFrame) * src2.toNumber(callFrame));
+            CHECK_FOR_EXCEPTION(pcLabel/*.Join(codeBlock->contextLabel)*/);
+            callFrame->uncheckedR(dst) = result;
+        }
+        vPC += OPCODE_LENGTH(op_mul);
+         NEXT_INSTRUCTION();
+    }
+    DEFINE_LABELED_OPCODE(op_mul) {
+        int dst = vPC[1].u.operand;
+        JSValue src1 = callFrame->r(vPC[2].u.operand).jsValue();
+        JSValue src2 = callFrame->r(vPC[3].u.operand).jsValue();
         
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
-                dstLabel.setStar(true);
-            }
-            
-            if (src1.isInt32() && src2.isInt32() && !(src1.asInt32() | src2.asInt32()) >> 15) // no overflow
-                callFrame->uncheckedR(dst) = jsNumber(src1.asInt32() * src2.asInt32());
-            else {
-                JSValue result = jsNumber(src1.toNumber(callFrame) * src2.toNumber(callFrame));
-                CHECK_FOR_EXCEPTION(dstLabel);
-                callFrame->uncheckedR(dst) = result;
-            }
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+        if (isPolicy || !labelReq || isLabelFree(codeBlock, vPC - iBegin, callFrame, pcLabel, dst, dst, vPC[2].u.operand, vPC[3].u.operand))
+            goto op_mul_unlabeled;
+        JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
+    
+        if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+            IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
+            dstLabel.setStar(true);
         }
+        
+        if (src1.isInt32() && src2.isInt32() && !(src1.asInt32() | src2.asInt32()) >> 15) // no overflow
+            callFrame->uncheckedR(dst) = jsNumber(src1.asInt32() * src2.asInt32());
         else {
-            if (src1.isInt32() && src2.isInt32() && !(src1.asInt32() | src2.asInt32()) >> 15) // no overflow
-                callFrame->uncheckedR(dst) = jsNumber(src1.asInt32() * src2.asInt32());
-            else {
-                JSValue result = jsNumber(src1.toNumber(callFrame) * src2.toNumber(callFrame));
-                CHECK_FOR_EXCEPTION(pcLabel/*.Join(codeBlock->contextLabel)*/);
-                callFrame->uncheckedR(dst) = result;
-            }
+            JSValue result = jsNumber(src1.toNumber(callFrame) * src2.toNumber(callFrame));
+            CHECK_FOR_EXCEPTION(dstLabel);
+            callFrame->uncheckedR(dst) = result;
         }
+        callFrame->setRegLabel(dst, dstLabel);
         vPC += OPCODE_LENGTH(op_mul);
          NEXT_INSTRUCTION();
     }
@@ -4496,17 +4827,17 @@ switch (vPC->u.opcode)
         JSValue divisor = callFrame->r(vPC[3].u.operand).jsValue();
         
         if (labelReq && !isPolicy) {
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
+            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
         
             JSValue result = jsNumber(dividend.toNumber(callFrame) / divisor.toNumber(callFrame));
             CHECK_FOR_EXCEPTION(dstLabel);
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
             callFrame->uncheckedR(dst) = result;
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             JSValue result = jsNumber(dividend.toNumber(callFrame) / divisor.toNumber(callFrame));
@@ -4528,10 +4859,10 @@ switch (vPC->u.opcode)
         JSValue divisor = callFrame->r(vPC[3].u.operand).jsValue();
         
         if (labelReq && !isPolicy) {
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
+            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
 
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
@@ -4547,7 +4878,7 @@ switch (vPC->u.opcode)
                 CHECK_FOR_EXCEPTION(dstLabel);
                 callFrame->uncheckedR(dst) = result;
             }
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             if (dividend.isInt32() && divisor.isInt32() && divisor.asInt32() != 0 && divisor.asInt32() != -1) {
@@ -4573,36 +4904,43 @@ switch (vPC->u.opcode)
          src1 (converted to number), and puts the difference in
          register dst.
          */
+        UNLABELED_ENTRY(op_sub);
         int dst = vPC[1].u.operand;
         JSValue src1 = callFrame->r(vPC[2].u.operand).jsValue();
         JSValue src2 = callFrame->r(vPC[3].u.operand).jsValue();
         
-        if (labelReq && !isPolicy) {
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
+        if (src1.isInt32() && src2.isInt32() && !((src1.asInt32() | src2.asInt32()) & 0xc0000000)) // no overflow
+            callFrame->uncheckedR(dst) = jsNumber(src1.asInt32() - src2.asInt32());
+        else {
+            JSValue result = jsNumber(src1.toNumber(callFrame) - src2.toNumber(callFrame));
+            CHECK_FOR_EXCEPTION(pcLabel/*.Join(codeBlock->contextLabel)*/);
+            callFrame->uncheckedR(dst) = result;
+        }
+        vPC += OPCODE_LENGTH(op_sub);
+         NEXT_INSTRUCTION();
+    }
+    DEFINE_LABELED_OPCODE(op_sub) {
+        int dst = vPC[1].u.operand;
+        JSValue src1 = callFrame->r(vPC[2].u.operand).jsValue();
+        JSValue src2 = callFrame->r(vPC[3].u.operand).jsValue();
         
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
-                dstLabel.setStar(true);
-            }
-            
-            if (src1.isInt32() && src2.isInt32() && !((src1.asInt32() | src2.asInt32()) & 0xc0000000)) // no overflow
-                callFrame->uncheckedR(dst) = jsNumber(src1.asInt32() - src2.asInt32());
-            else {
-                JSValue result = jsNumber(src1.toNumber(callFrame) - src2.toNumber(callFrame));
-                CHECK_FOR_EXCEPTION(dstLabel);
-                callFrame->uncheckedR(dst) = result;
-            }
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+        if (isPolicy || !labelReq || isLabelFree(codeBlock, vPC - iBegin, callFrame, pcLabel, dst, dst, vPC[2].u.operand, vPC[3].u.operand))
+            goto op_sub_unlabeled;
+        JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
+    
+        if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+            IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
+            dstLabel.setStar(true);
         }
+        
+        if (src1.isInt32() && src2.isInt32() && !((src1.asInt32() | src2.asInt32()) & 0xc0000000)) // no overflow
+            callFrame->uncheckedR(dst) = jsNumber(src1.asInt32() - src2.asInt32());
         else {
-            if (src1.isInt32() && src2.isInt32() && !((src1.asInt32() | src2.asInt32()) & 0xc0000000)) // no overflow
-                callFrame->uncheckedR(dst) = jsNumber(src1.asInt32() - src2.asInt32());
-            else {
-                JSValue result = jsNumber(src1.toNumber(callFrame) - src2.toNumber(callFrame));
-                CHECK_FOR_EXCEPTION(pcLabel/*.Join(codeBlock->contextLabel)*/);
-                callFrame->uncheckedR(dst) = result;
-            }
+            JSValue result = jsNumber(src1.toNumber(callFrame) - src2.toNumber(callFrame));
+            CHECK_FOR_EXCEPTION(dstLabel);
+            callFrame->uncheckedR(dst) = result;
         }
+        callFrame->setRegLabel(dst, dstLabel);
         vPC += OPCODE_LENGTH(op_sub);
          NEXT_INSTRUCTION();
     }
@@ -4618,10 +4956,10 @@ switch (vPC->u.opcode)
         JSValue shift = callFrame->r(vPC[3].u.operand).jsValue();
         
         if (labelReq && !isPolicy) {
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
+            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
         
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
@@ -4632,7 +4970,7 @@ switch (vPC->u.opcode)
                 CHECK_FOR_EXCEPTION(dstLabel);
                 callFrame->uncheckedR(dst) = result;
             }
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             if (val.isInt32() && shift.isInt32())
@@ -4658,10 +4996,10 @@ switch (vPC->u.opcode)
         JSValue shift = callFrame->r(vPC[3].u.operand).jsValue();
         
         if (labelReq && !isPolicy) {
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
+            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
         
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
@@ -4672,7 +5010,7 @@ switch (vPC->u.opcode)
                 CHECK_FOR_EXCEPTION(dstLabel);
                 callFrame->uncheckedR(dst) = result;
             }
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             if (val.isInt32() && shift.isInt32())
@@ -4698,10 +5036,10 @@ switch (vPC->u.opcode)
         JSValue shift = callFrame->r(vPC[3].u.operand).jsValue();
         
         if (labelReq && !isPolicy) {
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
+            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
         
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
@@ -4712,7 +5050,7 @@ switch (vPC->u.opcode)
                 CHECK_FOR_EXCEPTION(dstLabel);
                 callFrame->uncheckedR(dst) = result;
             }
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             if (val.isUInt32() && shift.isInt32())
@@ -4738,10 +5076,10 @@ switch (vPC->u.opcode)
         JSValue src2 = callFrame->r(vPC[3].u.operand).jsValue();
         
         if (labelReq && !isPolicy) {
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
+            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
         
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
@@ -4752,7 +5090,7 @@ switch (vPC->u.opcode)
                 CHECK_FOR_EXCEPTION(dstLabel);
                 callFrame->uncheckedR(dst) = result;
             }
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             if (src1.isInt32() && src2.isInt32())
@@ -4777,10 +5115,10 @@ switch (vPC->u.opcode)
         JSValue src1 = callFrame->r(vPC[2].u.operand).jsValue();
         JSValue src2 = callFrame->r(vPC[3].u.operand).jsValue();
         if (labelReq && !isPolicy) {
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
+            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
         
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
@@ -4791,7 +5129,7 @@ switch (vPC->u.opcode)
                 CHECK_FOR_EXCEPTION(dstLabel);
                 callFrame->uncheckedR(dst) = result;
             }
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             if (src1.isInt32() && src2.isInt32())
@@ -4817,11 +5155,11 @@ switch (vPC->u.opcode)
         JSValue src2 = callFrame->r(vPC[3].u.operand).jsValue();
         
         if (labelReq && !isPolicy) {
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(vPC[2].u.operand).getRegLabel().Join(callFrame->r(vPC[3].u.operand).getRegLabel()));
+            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(vPC[2].u.operand).Join(callFrame->regLabel(vPC[3].u.operand)));
         
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
 
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
@@ -4832,7 +5170,7 @@ switch (vPC->u.opcode)
                 CHECK_FOR_EXCEPTION(dstLabel);
                 callFrame->uncheckedR(dst) = result;
             }
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             if (src1.isInt32() && src2.isInt32())
@@ -4857,17 +5195,17 @@ switch (vPC->u.opcode)
         int src = vPC[2].u.operand;
         
         if (labelReq && !isPolicy) {
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(src).getRegLabel());
+            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(src));
         
             JSValue result = jsBoolean(!callFrame->r(src).jsValue().toBoolean());
             CHECK_FOR_EXCEPTION(dstLabel);
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
             callFrame->uncheckedR(dst) = result;
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             JSValue result = jsBoolean(!callFrame->r(src).jsValue().toBoolean());
@@ -4891,7 +5229,7 @@ switch (vPC->u.opcode)
         
         if (isInvalidParamForInstanceOf(callFrame, baseVal, exceptionValue)) {
             // IFC4BC - Setting the label for exceptionValue
-            exceptionValue.setValueLabel(pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(base).getRegLabel()));
+            exceptionValue.setValueLabel(pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(base)));
             // ------
             goto vm_throw;
         }
@@ -4922,8 +5260,8 @@ switch (vPC->u.opcode)
         JSValue baseVal = callFrame->r(base).jsValue();
         
         if (labelReq && !isPolicy) {
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(value).getRegLabel().Join(
-                                callFrame->r(base).getRegLabel().Join(callFrame->r(baseProto).getRegLabel())));
+            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(value).Join(
+                                callFrame->regLabel(base).Join(callFrame->regLabel(baseProto))));
         
             ASSERT(!isInvalidParamForInstanceOf(callFrame, baseVal, exceptionValue));
         
@@ -4932,13 +5270,13 @@ switch (vPC->u.opcode)
             // bool result = asObject(baseVal)->methodTable()->hasInstance(asObject(baseVal), callFrame, callFrame->r(value).jsValue(), callFrame->r(baseProto).jsValue());
             CHECK_FOR_EXCEPTION(dstLabel);
         
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
             callFrame->uncheckedR(dst) = jsBoolean(result);
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             ASSERT(!isInvalidParamForInstanceOf(callFrame, baseVal, exceptionValue));
@@ -4960,14 +5298,14 @@ switch (vPC->u.opcode)
         
         if (labelReq && !isPolicy) {
             // IFC4BC - DNSU
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(src).getRegLabel());
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(src));
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
             callFrame->uncheckedR(dst) = JSValue(jsTypeStringForValue(callFrame, callFrame->r(src).jsValue()));
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             callFrame->uncheckedR(dst) = JSValue(jsTypeStringForValue(callFrame, callFrame->r(src).jsValue()));
@@ -4987,14 +5325,14 @@ switch (vPC->u.opcode)
         JSValue v = callFrame->r(src).jsValue();
         if (labelReq && !isPolicy) {
             // IFC4BC - DNSU
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(src).getRegLabel());
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(src));
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
             callFrame->uncheckedR(dst) = jsBoolean(v.isCell() ? v.asCell()->structure()->typeInfo().masqueradesAsUndefined() : v.isUndefined());
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             callFrame->uncheckedR(dst) = jsBoolean(v.isCell() ? v.asCell()->structure()->typeInfo().masqueradesAsUndefined() : v.isUndefined());
@@ -5013,14 +5351,14 @@ switch (vPC->u.opcode)
         int src = vPC[2].u.operand;
         if (labelReq && !isPolicy) {
             // IFC4BC - DNSU
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(src).getRegLabel());
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(src));
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
             callFrame->uncheckedR(dst) = jsBoolean(callFrame->r(src).jsValue().isBoolean());
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             callFrame->uncheckedR(dst) = jsBoolean(callFrame->r(src).jsValue().isBoolean());
@@ -5039,14 +5377,14 @@ switch (vPC->u.opcode)
         int src = vPC[2].u.operand;
         if (labelReq && !isPolicy) {
             // IFC4BC - DNSU
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(src).getRegLabel());
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(src));
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
             callFrame->uncheckedR(dst) = jsBoolean(callFrame->r(src).jsValue().isNumber());
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             callFrame->uncheckedR(dst) = jsBoolean(callFrame->r(src).jsValue().isNumber());
@@ -5065,14 +5403,14 @@ switch (vPC->u.opcode)
         int src = vPC[2].u.operand;
         if (labelReq && !isPolicy) {
             // IFC4BC - DNSU
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(src).getRegLabel());
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(src));
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
             callFrame->uncheckedR(dst) = jsBoolean(callFrame->r(src).jsValue().isString());
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             callFrame->uncheckedR(dst) = jsBoolean(callFrame->r(src).jsValue().isString());
@@ -5091,14 +5429,14 @@ switch (vPC->u.opcode)
         int src = vPC[2].u.operand;
         if (labelReq && !isPolicy) {
             // IFC4BC - DNSU
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(src).getRegLabel());
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(src));
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
             callFrame->uncheckedR(dst) = jsBoolean(jsIsObjectType(callFrame->r(src).jsValue()));
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             callFrame->uncheckedR(dst) = jsBoolean(jsIsObjectType(callFrame->r(src).jsValue()));            
@@ -5117,14 +5455,14 @@ switch (vPC->u.opcode)
         int src = vPC[2].u.operand;
         if (labelReq && !isPolicy) {
             // IFC4BC - DNSU
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(src).getRegLabel());
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(src));
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
             callFrame->uncheckedR(dst) = jsBoolean(jsIsFunctionType(callFrame->r(src).jsValue()));
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             callFrame->uncheckedR(dst) = jsBoolean(jsIsFunctionType(callFrame->r(src).jsValue()));
@@ -5151,7 +5489,7 @@ switch (vPC->u.opcode)
         
         if (isInvalidParamForIn(callFrame, baseVal, exceptionValue)) {
             // IFC4BC - Setting the exception value label.
-            exceptionValue.setValueLabel(callFrame->r(base).getRegLabel().Join(callFrame->r(property).getRegLabel()));
+            exceptionValue.setValueLabel(callFrame->regLabel(base).Join(callFrame->regLabel(property)));
             goto vm_throw;
         }
         
@@ -5172,18 +5510,18 @@ switch (vPC->u.opcode)
         }
         if (context.Val() != pcLabel/*.Join(codeBlock->contextLabel)*/.Val())
         {
-            labelReq = true;
+            REQUIRE_LABELS();
         }
         if (labelReq && !isPolicy) {
             // IFC4BC - NSU check
-            JSLabel dstLabel = context.Join(callFrame->r(base).getRegLabel().Join(callFrame->r(property).getRegLabel()));
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+            JSLabel dstLabel = context.Join(callFrame->regLabel(base).Join(callFrame->regLabel(property)));
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
             callFrame->uncheckedR(dst) = result;
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             callFrame->uncheckedR(dst) = result;
@@ -5207,6 +5545,7 @@ switch (vPC->u.opcode)
             goto vm_throw;
         if (labelReq && !isLabeled) {
             labelRegistersMinusDst (callFrame, codeBlock, pcLabel, dst);
+            CHECK_LABELED_INSTRUCTIONS();
         }
         vPC += OPCODE_LENGTH(op_resolve);
          NEXT_INSTRUCTION();
@@ -5227,6 +5566,7 @@ switch (vPC->u.opcode)
             goto vm_throw;
         if (labelReq && !isLabeled && !isPolicy) {
             labelRegistersMinusDst (callFrame, codeBlock, pcLabel, dst);
+            CHECK_LABELED_INSTRUCTIONS();
         }
         
         vPC += OPCODE_LENGTH(op_resolve_skip);
@@ -5250,6 +5590,7 @@ switch (vPC->u.opcode)
             goto vm_throw;
         if (labelReq && !isLabeled && !isPolicy) {
             labelRegistersMinusDst (callFrame, codeBlock, pcLabel, dst);
+            CHECK_LABELED_INSTRUCTIONS();
         }
         if (isPolicy)
         {
@@ -5282,6 +5623,7 @@ switch (vPC->u.opcode)
             goto vm_throw;
         if (labelReq && !isLabeled && !isPolicy) {
             labelRegistersMinusDst (callFrame, codeBlock, pcLabel, dst);
+            CHECK_LABELED_INSTRUCTIONS();
         }
         
         vPC += OPCODE_LENGTH(op_resolve_global_dynamic);
@@ -5307,18 +5649,18 @@ switch (vPC->u.opcode)
         }
         
         if (rVal.getValueLabel().Val() && rVal.getValueLabel() != pcLabel/*.Join(codeBlock->contextLabel)*/ && !labelReq) {
-            labelReq = true;
+            REQUIRE_LABELS();
             labelRegisters (callFrame, codeBlock, pcLabel);
         }
         if (labelReq && !isPolicy) {
             JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(rVal.getValueLabel());
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
             callFrame->uncheckedR(dst) = rVal;
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             callFrame->uncheckedR(dst) = rVal;
@@ -5342,18 +5684,18 @@ switch (vPC->u.opcode)
         // For global objects with label 0, it would be the pcLabel and hence proceed properly.
         // rVal.setValueLabel(rVal.joinValueLabel(pcLabel));
         if (rVal.getValueLabel().Val() && rVal.getValueLabel() != pcLabel/*.Join(codeBlock->contextLabel)*/ && !labelReq) {
-            labelReq = true;
+            REQUIRE_LABELS();
             labelRegisters (callFrame, codeBlock, pcLabel);
         }
         if (labelReq && !isPolicy) {
             JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(rVal.getValueLabel());
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
             callFrame->uncheckedR(dst) = rVal;
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             callFrame->uncheckedR(dst) = rVal;        
@@ -5380,8 +5722,8 @@ switch (vPC->u.opcode)
 //            ABORT_TRANSACTION();
 //        }
         JSLabel dstLabel = pcLabel;
-        if (!noSensitiveUpgrade(registerPointer->get().getValueLabel())){
-            printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, registerPointer->get().getValueLabel().Val(), pcLabel.Val());
+        if (!noSensitiveUpgrade(codeBlock, registerPointer->get().getValueLabel())){
+            IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, registerPointer->get().getValueLabel().Val(), pcLabel.Val());
             dstLabel.setStar(true);
         }
         
@@ -5420,8 +5762,8 @@ switch (vPC->u.opcode)
 //        }
         
         JSLabel dstLabel = pcLabel;
-        if (!noSensitiveUpgrade(registerPointer->get().getValueLabel())){
-            printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, registerPointer->get().getValueLabel().Val(), pcLabel.Val());
+        if (!noSensitiveUpgrade(codeBlock, registerPointer->get().getValueLabel())){
+            IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, registerPointer->get().getValueLabel().Val(), pcLabel.Val());
             dstLabel.setStar(true);
         }
         JSValue val = callFrame->r(value).jsValue();
@@ -5486,19 +5828,19 @@ switch (vPC->u.opcode)
         JSValue ret = scope->registerAt(index).get();
         increasingContextLabel = increasingContextLabel.Join(scope->getObjectLabel());
         if (increasingContextLabel != pcLabel && !labelReq) {
-            labelReq = true;
+            REQUIRE_LABELS();
             labelRegisters (callFrame, codeBlock, pcLabel);
         }
 
         if (labelReq && !isPolicy) {
             JSLabel dstLabel = ret.joinValueLabel(increasingContextLabel);
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
             callFrame->uncheckedR(dst) = ret;
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             callFrame->uncheckedR(dst) = ret;   
@@ -5582,6 +5924,7 @@ switch (vPC->u.opcode)
         resolveBase(callFrame, vPC, &labelReq);
         if (labelReq && !isLabeled && !isPolicy) {
             labelRegistersMinusDst (callFrame, codeBlock, pcLabel, dst);
+            CHECK_LABELED_INSTRUCTIONS();
         }
         
         CHECK_FOR_EXCEPTION(callFrame->globalData().exception.getValueLabel());
@@ -5635,11 +5978,8 @@ switch (vPC->u.opcode)
         if (UNLIKELY(!resolveBaseAndProperty(callFrame, vPC, exceptionValue, &labelReq)))
             goto vm_throw;
         if (labelReq && !isLabeled && !isPolicy) {
-            for (int i = 0; i < codeBlock->m_numCalleeRegisters; i++)
-                if (i != bdst && i != pdst)
-                    callFrame->uncheckedR(i).setRegLabel(pcLabel);
-            for(int i = -7, j = 1; j <= codeBlock->numParameters(); j++, i--)
-                callFrame->uncheckedR(i).setRegLabel(pcLabel);
+            labelRegistersMinusDst(callFrame, codeBlock, pcLabel, bdst, pdst);
+            CHECK_LABELED_INSTRUCTIONS();
         }
         vPC += OPCODE_LENGTH(op_resolve_with_base);
          NEXT_INSTRUCTION();
@@ -5664,11 +6004,8 @@ switch (vPC->u.opcode)
         if (UNLIKELY(!resolveThisAndProperty(callFrame, vPC, exceptionValue, &labelReq)))
             goto vm_throw;
         if (labelReq && !isLabeled && !isPolicy) {
-            for (int i = 0; i < codeBlock->m_numCalleeRegisters; i++)
-                if (i != tdst && i != pdst)
-                    callFrame->uncheckedR(i).setRegLabel(pcLabel);
-            for(int i = -7, j = 1; j <= codeBlock->numParameters(); j++, i--)
-                callFrame->uncheckedR(i).setRegLabel(pcLabel);
+            labelRegistersMinusDst(callFrame, codeBlock, pcLabel, tdst, pdst);
+            CHECK_LABELED_INSTRUCTIONS();
         }
         
         vPC += OPCODE_LENGTH(op_resolve_with_this);
@@ -5707,26 +6044,27 @@ switch (vPC->u.opcode)
         }
         
         // IFC4BC
-        JSLabel context = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(base).getRegLabel());
+        JSLabel context = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(base));
+        IFC_COUNT(codeBlock, GetIFC);
         JSValue result = baseValue.getIFC(callFrame, ident, slot, &context);
         // result.setValueLabel(result.joinValueLabel(baseValue.getValueLabel()));
         context = context.Join(result.getValueLabel());
-        if (JSLabel::ABORT_FLAG) {
-            JSLabel::ABORT_FLAG = false;
+        if (ifcContext.abortFlag) {
+            ifcContext.abortFlag = false;
             // ABORT_TRANSACTION();
         }
         CHECK_FOR_EXCEPTION(context);
         if (context.Val() != pcLabel.Val() && !labelReq) {
-            labelReq = true;
+            REQUIRE_LABELS();
             labelRegisters (callFrame, codeBlock, pcLabel);
         }
         if (labelReq && !isPolicy) {
             // context.setStar(false);
             JSLabel dstLabel = context;
             
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
             {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             else
@@ -5734,7 +6072,7 @@ switch (vPC->u.opcode)
                 // dstLabel.setStar(false);
             }
             callFrame->uncheckedR(dst) = result;
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             callFrame->uncheckedR(dst) = result;
@@ -6047,25 +6385,26 @@ skip_id_custom_self:
         PropertySlot slot(baseValue);
         
         // IFC4BC
-        JSLabel context = pcLabel.Join(callFrame->r(base).getRegLabel());
+        JSLabel context = pcLabel.Join(callFrame->regLabel(base));
+        IFC_COUNT(codeBlock, GetIFC);
         JSValue result = baseValue.getIFC(callFrame, ident, slot, &context);
         context = context.Join(result.getValueLabel());
-        if (JSLabel::ABORT_FLAG) {
-            JSLabel::ABORT_FLAG = false;
+        if (ifcContext.abortFlag) {
+            ifcContext.abortFlag = false;
             // ABORT_TRANSACTION();
         }
         CHECK_FOR_EXCEPTION(context);
         if (context.Val() != pcLabel.Val() && !labelReq) {
-            labelReq = true;
+            REQUIRE_LABELS();
             labelRegisters (callFrame, codeBlock, pcLabel);
         }
         if (labelReq && !isPolicy) {
             // context.setStar(false);
             JSLabel dstLabel = context;
             
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
             {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             else
@@ -6073,7 +6412,7 @@ skip_id_custom_self:
                 // dstLabel.setStar(false);
             }
             callFrame->uncheckedR(dst) = result;
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             callFrame->uncheckedR(dst) = result;
@@ -6265,7 +6604,7 @@ skip_get_string_length:
         JSValue sentValue = callFrame->r(value).jsValue();
         
         if (labelReq && !isPolicy) {
-            sentValue.setValueLabel(sentContextLabel.Join(callFrame->r(value).getRegLabel()));
+            sentValue.setValueLabel(sentContextLabel.Join(callFrame->regLabel(value)));
             // if (sentValue.getValueLabel().Star())
             //     ABORT_TRANSACTION();
         }
@@ -6273,7 +6612,7 @@ skip_get_string_length:
             sentValue.setValueLabel(sentContextLabel);
         }
         
-        JSLabel::argLabel[0] = sentValue.getValueLabel().getPair();
+        ifcContext.valueLabel = sentValue.getValueLabel().getPair();
         Identifier& ident = codeBlock->identifier(property);
         PutPropertySlot slot(codeBlock->isStrictMode());
         
@@ -6289,9 +6628,10 @@ skip_get_string_length:
         } else{
             if(!isPolicy)
             {
+            IFC_COUNT(codeBlock, PutIFC);
             baseValue.putIFC(callFrame, ident, sentValue, slot, &sentContextLabel, &abortRun, &isStructChanged);
-            if (abortRun || JSLabel::ABORT_FLAG){
-                JSLabel::ABORT_FLAG = false;
+            if (abortRun || ifcContext.abortFlag){
+                ifcContext.abortFlag = false;
                 ABORT_TRANSACTION();
             }
             }
@@ -6300,12 +6640,12 @@ skip_get_string_length:
                 baseValue.put(callFrame, ident, callFrame->r(value).jsValue(), slot);
         }
         CHECK_FOR_EXCEPTION(sentContextLabel);
-        JSLabel::argLabel[0] = JSLabel().getPair();;
+        ifcContext.valueLabel = JSLabel().getPair();
         
         if (isStructChanged && asObject(baseValue)->getObjectLabel().Val()) {
             asObject(baseValue)->setObjectLabel(asObject(baseValue)->joinObjectLabel(sentContextLabel));
             if (labelReq && !isPolicy) 
-                callFrame->uncheckedR(base).setRegLabel(asObject(baseValue)->getObjectLabel());
+                callFrame->setRegLabel(base, asObject(baseValue)->getObjectLabel());
         }
         
         // IFC4BC-Do not cache, so the other opcodes would not be used
@@ -6430,7 +6770,7 @@ skip_put_by_id:
         JSValue sentValue = callFrame->r(value).jsValue();
         // baseValue.setValueLabel(sentContextLabel);
         if (labelReq && !isPolicy) {
-            sentValue.setValueLabel(sentContextLabel.Join(callFrame->r(value).getRegLabel()));
+            sentValue.setValueLabel(sentContextLabel.Join(callFrame->regLabel(value)));
             // if (sentValue.getValueLabel().Star())
             //     ABORT_TRANSACTION();
         }
@@ -6451,9 +6791,10 @@ skip_put_by_id:
         } else{
             if(!isPolicy)
             {
+                IFC_COUNT(codeBlock, PutIFC);
                 baseValue.putIFC(callFrame, ident, sentValue, slot, &sentContextLabel, &abortRun, &isStructChanged);
-                if (abortRun || JSLabel::ABORT_FLAG){
-                    JSLabel::ABORT_FLAG = false;
+                if (abortRun || ifcContext.abortFlag){
+                    ifcContext.abortFlag = false;
                     ABORT_TRANSACTION();
                 }
             }
@@ -6466,7 +6807,7 @@ skip_put_by_id:
         if (isStructChanged && (asObject(baseValue)->getObjectLabel().Val())) {
             asObject(baseValue)->setObjectLabel(asObject(baseValue)->joinObjectLabel(sentContextLabel));
                 if (labelReq && !isPolicy)
-                    callFrame->uncheckedR(base).setRegLabel(asObject(baseValue)->getObjectLabel());
+                    callFrame->setRegLabel(base, asObject(baseValue)->getObjectLabel());
         }
         
         vPC += OPCODE_LENGTH(op_put_by_id_generic);
@@ -6501,9 +6842,9 @@ skip_put_by_id:
         CHECK_FOR_EXCEPTION(pcLabel/*.Join(codeBlock->contextLabel)*/);
         if (labelReq && !isPolicy) {
             JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/;
-            if(!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+            if(!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
             {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             else
@@ -6511,7 +6852,7 @@ skip_put_by_id:
                 // dstLabel.setStar(false);
             }
             callFrame->uncheckedR(dst) = jsBoolean(result);
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             callFrame->uncheckedR(dst) = jsBoolean(result);            
@@ -6546,9 +6887,9 @@ skip_put_by_id:
                 // }
                 
                 JSLabel dstLabel = resLabel.Join(pcLabel/*.Join(codeBlock->contextLabel)*/.Join(baseValue.joinValueLabel(subscript.joinValueLabel(expectedSubscript.getValueLabel()))));
-                if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+                if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
                 {
-                    printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+                    IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                     dstLabel.setStar(true);
                 }
                 else
@@ -6556,7 +6897,7 @@ skip_put_by_id:
                     // dstLabel.setStar(false);
                 }
                 callFrame->uncheckedR(dst) = res;
-                callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+                callFrame->setRegLabel(dst, dstLabel);
             }
             else {
                 callFrame->uncheckedR(dst) = res;
@@ -6567,6 +6908,7 @@ skip_put_by_id:
         {
             Identifier propertyName(callFrame, subscript.toString(callFrame)->value(callFrame));
             // IFC4BC
+            IFC_COUNT(codeBlock, GetIFC);
             result = baseValue.getIFC(callFrame, propertyName, &context);
             // if (result.getValueLabel().Star()) {
             context = context.Join(result.getValueLabel());
@@ -6577,14 +6919,14 @@ skip_put_by_id:
         }
         CHECK_FOR_EXCEPTION(context);
         if (context.Val() != pcLabel.Val() && !labelReq) {
-            labelReq = true;
+            REQUIRE_LABELS();
             labelRegisters(callFrame, codeBlock, pcLabel);
         }
         if (labelReq && !isPolicy) {
             JSLabel dstLabel = context;
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
             {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             else
@@ -6592,7 +6934,7 @@ skip_put_by_id:
                 // dstLabel.setStar(false);
             }
             callFrame->uncheckedR(dst) = result;
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             callFrame->uncheckedR(dst) = result;            
@@ -6608,9 +6950,9 @@ skip_put_by_id:
         JSLabel context = pcLabel/*.Join(codeBlock->contextLabel)*/;
         if (labelReq && !isPolicy) {
             JSLabel dstLabel = context;
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
             {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             else
@@ -6620,6 +6962,7 @@ skip_put_by_id:
             if (arguments) {
                 Identifier& ident = codeBlock->identifier(property);
                 PropertySlot slot(arguments);
+                IFC_COUNT(codeBlock, GetIFC);
                 JSValue result = arguments.getIFC(callFrame, ident, slot, &context);
                 // if (result.getValueLabel().Star()) {
                     context = context.Join(result.getValueLabel());
@@ -6629,19 +6972,20 @@ skip_put_by_id:
                 callFrame->uncheckedR(dst) = result;
             } else
                 callFrame->uncheckedR(dst) = jsNumber(callFrame->argumentCount());
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel.Join(context));
+            callFrame->setRegLabel(dst, dstLabel.Join(context));
         }
         else {
             if (arguments) {
                 Identifier& ident = codeBlock->identifier(property);
                 PropertySlot slot(arguments);
+                IFC_COUNT(codeBlock, GetIFC);
                 JSValue result = arguments.getIFC(callFrame, ident, slot, &context);
                 // if (result.getValueLabel().Star()) {
                 context = context.Join(result.getValueLabel());
                     // context.setStar(false);
                 // }
                 if (context.Val() != pcLabel.Val() && !labelReq) {
-                    labelReq = true;
+                    REQUIRE_LABELS();
                     labelRegisters(callFrame, codeBlock, pcLabel);
                 }
                 CHECK_FOR_EXCEPTION(context);
@@ -6649,7 +6993,7 @@ skip_put_by_id:
             } else
                 callFrame->uncheckedR(dst) = jsNumber(callFrame->argumentCount());
             if (labelReq && !isPolicy)
-                callFrame->uncheckedR(dst).setRegLabel(context);
+                callFrame->setRegLabel(dst, context);
         }
         
         vPC += OPCODE_LENGTH(op_get_arguments_length);
@@ -6665,10 +7009,10 @@ skip_put_by_id:
             // IFC4BC - DNSU. Might require more functionality
             if (labelReq && !isPolicy) {
                 JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/;
-                if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+                if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
                 {
 
-                    printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+                    IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                     dstLabel.setStar(true);
                 }
                 else
@@ -6676,7 +7020,7 @@ skip_put_by_id:
                     // dstLabel.setStar(false);
                 }
                 callFrame->uncheckedR(dst) = callFrame->argument(subscript.asUInt32());
-                callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+                callFrame->setRegLabel(dst, dstLabel);
             }
             else {
                 callFrame->uncheckedR(dst) = callFrame->argument(subscript.asUInt32());                
@@ -6686,6 +7030,7 @@ skip_put_by_id:
         }
         
         if (!arguments) {
+            resolveAliasedRegLabels(callFrame, codeBlock);
             Arguments* arguments = Arguments::create(*globalData, callFrame);
             // IFC4BC - Assigning label to arguments object
             arguments->setObjectLabel(pcLabel/*.Join(codeBlock->contextLabel)*/);
@@ -6693,20 +7038,20 @@ skip_put_by_id:
             if (labelReq && !isPolicy) {
                 JSLabel argLabel = pcLabel/*.Join(codeBlock->contextLabel)*/;
                 JSLabel argULabel = pcLabel/*.Join(codeBlock->contextLabel)*/;
-                if(!noSensitiveUpgrade(callFrame->r(argumentsRegister).getRegLabel()))
+                if(!noSensitiveUpgrade(codeBlock, callFrame->regLabel(argumentsRegister)))
                 {
-                    printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(argumentsRegister).getRegLabel().Val(), pcLabel.Val());
+                    IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(argumentsRegister).Val(), pcLabel.Val());
                     argLabel.setStar(true);
                 }
-                if(!noSensitiveUpgrade(callFrame->r(unmodifiedArgumentsRegister(argumentsRegister)).getRegLabel()))
+                if(!noSensitiveUpgrade(codeBlock, callFrame->regLabel(unmodifiedArgumentsRegister(argumentsRegister))))
                 {
-                    printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(argumentsRegister).getRegLabel().Val(), pcLabel.Val());
+                    IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(argumentsRegister).Val(), pcLabel.Val());
                     argULabel.setStar(true);
                 }
                 callFrame->uncheckedR(argumentsRegister) = JSValue(arguments);
                 callFrame->uncheckedR(unmodifiedArgumentsRegister(argumentsRegister)) = JSValue(arguments);
-                callFrame->uncheckedR(argumentsRegister).setRegLabel(argLabel);
-                callFrame->uncheckedR(unmodifiedArgumentsRegister(argumentsRegister)).setRegLabel(argULabel);
+                callFrame->setRegLabel(argumentsRegister, argLabel);
+                callFrame->setRegLabel(unmodifiedArgumentsRegister(argumentsRegister), argULabel);
             }
             else {
                 callFrame->uncheckedR(argumentsRegister) = JSValue(arguments);
@@ -6741,21 +7086,28 @@ skip_put_by_id:
                 JSArray* jsArray = asArray(baseValue);
                 if (jsArray->canGetIndex(i))
                     result = jsArray->getIndex(i);
-                else
+                else {
+                    IFC_COUNT(codeBlock, GetIFC);
                     result = jsArray->JSArray::getIFC(callFrame, i, &context);
+                }
             } else if (isJSString(baseValue) && asString(baseValue)->canGetIndex(i))
                 result = asString(baseValue)->getIndex(callFrame, i);
-            else
+            else {
+                IFC_COUNT(codeBlock, GetIFC);
                 result = baseValue.getIFC(callFrame, i, &context);
+            }
             // Original
             // result = baseValue.get(callFrame, i);
-        } else if (isName(subscript))
+        } else if (isName(subscript)) {
+            IFC_COUNT(codeBlock, GetIFC);
             result = baseValue.getIFC(callFrame, jsCast<NameInstance*>(subscript.asCell())->privateName(), &context);
+        }
         // Original
         // result = baseValue.get(callFrame, jsCast<NameInstance*>(subscript.asCell())->privateName());
         else {
             Identifier property(callFrame, subscript.toString(callFrame)->value(callFrame));
             // IFC4BC - Changed to include context label
+            IFC_COUNT(codeBlock, GetIFC);
             result = baseValue.getIFC(callFrame, property, &context);
             // Original
             // result = baseValue.get(callFrame, property);
@@ -6766,7 +7118,7 @@ skip_put_by_id:
         // }
         if (context.Val() != pcLabel/*.Join(codeBlock->contextLabel)*/.Val() && !labelReq)
         {
-            labelReq = true;
+            REQUIRE_LABELS();
             labelRegisters(callFrame, codeBlock, pcLabel/*.Join(codeBlock->contextLabel)*/);
         }
         CHECK_FOR_EXCEPTION(context);
@@ -6776,9 +7128,9 @@ skip_put_by_id:
             {
                 dstLabel = dstLabel.Join(baseValue.asCell()->getObjectLabel());
             }
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
             {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             else
@@ -6786,7 +7138,7 @@ skip_put_by_id:
                 // dstLabel.setStar(false);
             }
             callFrame->uncheckedR(dst) = result;
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             callFrame->uncheckedR(dst) = result;
@@ -6813,7 +7165,7 @@ skip_put_by_id:
         JSValue subscript = callFrame->r(property).jsValue();
         JSValue sentValue = callFrame->r(value).jsValue();
         if (labelReq && !isPolicy) {
-            sentValue.setValueLabel(pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(value).getRegLabel()));
+            sentValue.setValueLabel(pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(value)));
             // if (sentValue.getValueLabel().Star())
             //     ABORT_TRANSACTION();
         }
@@ -6835,38 +7187,46 @@ skip_put_by_id:
                     // IFC4BC - adds at a particular index in the array
                     isStructChanged = true;
                 }
-                else
+                else {
+                    IFC_COUNT(codeBlock, PutIFC);
                     jsArray->JSArray::putByIndexIFC(jsArray, callFrame, i, sentValue, codeBlock->isStrictMode(),
                                                     &context, &abortRun, &isStructChanged);
-            } else
+                }
+            } else {
+                IFC_COUNT(codeBlock, PutIFC);
                 baseValue.putByIndexIFC(callFrame, i, sentValue, codeBlock->isStrictMode(), &context, &abortRun, &isStructChanged);
+            }
         } else if (isName(subscript)) {
             PutPropertySlot slot(codeBlock->isStrictMode());
-            if(!isPolicy)
+            if(!isPolicy) {
+                IFC_COUNT(codeBlock, PutIFC);
                 baseValue.putIFC(callFrame, jsCast<NameInstance*>(subscript.asCell())->privateName(), sentValue, slot, &context, &abortRun, &isStructChanged);
+            }
             else
                 baseValue.put(callFrame, jsCast<NameInstance*>(subscript.asCell())->privateName(), callFrame->r(value).jsValue(), slot);
         } else {
             Identifier property(callFrame, subscript.toString(callFrame)->value(callFrame));
             if (!globalData->exception) { // Don't put to an object if toString threw an exception.
                 PutPropertySlot slot(codeBlock->isStrictMode());
-                if(!isPolicy)
+                if(!isPolicy) {
+                    IFC_COUNT(codeBlock, PutIFC);
                     baseValue.putIFC(callFrame, property, sentValue, slot, &context, &abortRun, &isStructChanged);
+                }
                 else
                     baseValue.put(callFrame, property, callFrame->r(value).jsValue(), slot);
             }
         }
         
         // IFC4BC - Setting labels and aborting if something failed
-        if (abortRun || JSLabel::ABORT_FLAG) {
-            JSLabel::ABORT_FLAG = false;
+        if (abortRun || ifcContext.abortFlag) {
+            ifcContext.abortFlag = false;
             ABORT_TRANSACTION();
         }
         
         if (isStructChanged && (asObject(baseValue)->getObjectLabel().Val())) {
             asObject(baseValue)->setObjectLabel(asObject(baseValue)->joinObjectLabel(context));
             if (labelReq && !isPolicy)
-                callFrame->uncheckedR(base).setRegLabel(asObject(baseValue)->getObjectLabel());
+                callFrame->setRegLabel(base, asObject(baseValue)->getObjectLabel());
         }
         
         CHECK_FOR_EXCEPTION(context);
@@ -6914,9 +7274,9 @@ skip_put_by_id:
         CHECK_FOR_EXCEPTION(pcLabel/*.Join(codeBlock->contextLabel)*/);
         if (labelReq && !isPolicy) {
             JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/;
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
             {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             else
@@ -6924,7 +7284,7 @@ skip_put_by_id:
                 // dstLabel.setStar(false);
             }
             callFrame->uncheckedR(dst) = jsBoolean(result);
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             callFrame->uncheckedR(dst) = jsBoolean(result);            
@@ -6952,7 +7312,7 @@ skip_put_by_id:
         JSValue sentValue = callFrame->r(value).jsValue();
         // IFC4BC - Set the label and check for star
         if (labelReq && !isPolicy) {
-            sentValue.setValueLabel(pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(value).getRegLabel()));
+            sentValue.setValueLabel(pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(value)));
             // if (sentValue.getValueLabel().Star())
             //    ABORT_TRANSACTION();
         }
@@ -7012,12 +7372,25 @@ skip_put_by_id:
          Additionally this loop instruction may terminate JS execution is
          the JS timeout is reached.
          */
+        UNLABELED_ENTRY(op_loop_if_true);
         int cond = vPC[1].u.operand;
         int target = vPC[2].u.operand;
         
+        if (callFrame->r(cond).jsValue().toBoolean()) {
+            vPC += target;
+            CHECK_FOR_TIMEOUT();
+             NEXT_INSTRUCTION();
+        }
+        
+        vPC += OPCODE_LENGTH(op_loop_if_true);
+         NEXT_INSTRUCTION();
+    }
+    DEFINE_LABELED_OPCODE(op_loop_if_true) {
+        int cond = vPC[1].u.operand;
+        
         // IFC4BC -- To push context label on the pcstack
         if (labelReq && !isPolicy) {
-            JSLabel contextLabel = callFrame->r(cond).getRegLabel();
+            JSLabel contextLabel = callFrame->regLabel(cond);
 //            if (contextLabel >= pcLabel) {
 //                uint64_t i = 1;
 //                uint64_t pLabel = contextLabel.pLabel;
@@ -7037,16 +7410,7 @@ skip_put_by_id:
                 ABORT_TRANSACTION();
             OP_BRANCH(contextLabel);
         }
-        // IFC4BC ---------------------------------------
-        
-        if (callFrame->r(cond).jsValue().toBoolean()) {
-            vPC += target;
-            CHECK_FOR_TIMEOUT();
-             NEXT_INSTRUCTION();
-        }
-        
-        vPC += OPCODE_LENGTH(op_loop_if_true);
-         NEXT_INSTRUCTION();
+        goto op_loop_if_true_unlabeled;
     }
     DEFINE_OPCODE(op_loop_if_false) {
         /* loop_if_true cond(r) target(offset)
@@ -7057,12 +7421,25 @@ skip_put_by_id:
          Additionally this loop instruction may terminate JS execution is
          the JS timeout is reached.
          */
+        UNLABELED_ENTRY(op_loop_if_false);
         int cond = vPC[1].u.operand;
         int target = vPC[2].u.operand;
         
+        if (!callFrame->r(cond).jsValue().toBoolean()) {
+            vPC += target;
+            CHECK_FOR_TIMEOUT();
+             NEXT_INSTRUCTION();
+        }
+        
+        vPC += OPCODE_LENGTH(op_loop_if_true);
+         NEXT_INSTRUCTION();
+    }
+    DEFINE_LABELED_OPCODE(op_loop_if_false) {
+        int cond = vPC[1].u.operand;
+        
         // IFC4BC -- To push context label on the pcstack
         if (labelReq && !isPolicy) {
-            JSLabel contextLabel = callFrame->r(cond).getRegLabel();
+            JSLabel contextLabel = callFrame->regLabel(cond);
 //            if (contextLabel >= pcLabel) {
 //                uint64_t i = 1;
 //                uint64_t pLabel = contextLabel.pLabel;
@@ -7082,16 +7459,7 @@ skip_put_by_id:
                 ABORT_TRANSACTION();
             OP_BRANCH(contextLabel);
         }
-        // IFC4BC ---------------------------------------
-        
-        if (!callFrame->r(cond).jsValue().toBoolean()) {
-            vPC += target;
-            CHECK_FOR_TIMEOUT();
-             NEXT_INSTRUCTION();
-        }
-        
-        vPC += OPCODE_LENGTH(op_loop_if_true);
-         NEXT_INSTRUCTION();
+        goto op_loop_if_false_unlabeled;
     }
     DEFINE_OPCODE(op_jtrue) {
         /* jtrue cond(r) target(offset)
@@ -7099,12 +7467,24 @@ skip_put_by_id:
          Jumps to offset target from the current instruction, if and
          only if register cond converts to boolean as true.
          */
+        UNLABELED_ENTRY(op_jtrue);
         int cond = vPC[1].u.operand;
         int target = vPC[2].u.operand;
         
+        if (callFrame->r(cond).jsValue().toBoolean()) {
+            vPC += target;
+             NEXT_INSTRUCTION();
+        }
+        
+        vPC += OPCODE_LENGTH(op_jtrue);
+         NEXT_INSTRUCTION();
+    }
+    DEFINE_LABELED_OPCODE(op_jtrue) {
+        int cond = vPC[1].u.operand;
+        
         // IFC4BC -- To push context label on the pcstack
         if (labelReq && !isPolicy) {
-            JSLabel contextLabel = callFrame->r(cond).getRegLabel();
+            JSLabel contextLabel = callFrame->regLabel(cond);
 //            if (contextLabel >= pcLabel) {
 //                uint64_t i = 1;
 //                uint64_t pLabel = contextLabel.pLabel;
@@ -7124,15 +7504,7 @@ skip_put_by_id:
                 ABORT_TRANSACTION();
             OP_BRANCH(contextLabel);
         }
-        // IFC4BC ---------------------------------------
-        
-        if (callFrame->r(cond).jsValue().toBoolean()) {
-            vPC += target;
-             NEXT_INSTRUCTION();
-        }
-        
-        vPC += OPCODE_LENGTH(op_jtrue);
-         NEXT_INSTRUCTION();
+        goto op_jtrue_unlabeled;
     }
     DEFINE_OPCODE(op_jfalse) {
         /* jfalse cond(r) target(offset)
@@ -7140,12 +7512,24 @@ skip_put_by_id:
          Jumps to offset target from the current instruction, if and
          only if register cond converts to boolean as false.
          */
+        UNLABELED_ENTRY(op_jfalse);
         int cond = vPC[1].u.operand;
         int target = vPC[2].u.operand;
         
+        if (!callFrame->r(cond).jsValue().toBoolean()) {
+            vPC += target;
+             NEXT_INSTRUCTION();
+        }
+        
+        vPC += OPCODE_LENGTH(op_jfalse);
+         NEXT_INSTRUCTION();
+    }
+    DEFINE_LABELED_OPCODE(op_jfalse) {
+        int cond = vPC[1].u.operand;
+        
         // IFC4BC -- To push context label on the pcstack
         if (labelReq && !isPolicy) {
-            JSLabel contextLabel = callFrame->r(cond).getRegLabel();
+            JSLabel contextLabel = callFrame->regLabel(cond);
 //            if (contextLabel >= pcLabel) {
 //                uint64_t i = 1;
 //                uint64_t pLabel = contextLabel.pLabel;
@@ -7165,15 +7549,7 @@ skip_put_by_id:
                 ABORT_TRANSACTION();
             OP_BRANCH(contextLabel);
         }
-        // IFC4BC ---------------------------------------
-        
-        if (!callFrame->r(cond).jsValue().toBoolean()) {
-            vPC += target;
-             NEXT_INSTRUCTION();
-        }
-        
-        vPC += OPCODE_LENGTH(op_jfalse);
-         NEXT_INSTRUCTION();
+        goto op_jfalse_unlabeled;
     }
     
     // Abhi -- Functionality for opcode - op_jempty
@@ -7192,7 +7568,7 @@ skip_put_by_id:
         
         // IFC4BC -- To push context label on the pcstack
         if (labelReq && !isPolicy) {
-           JSLabel contextLabel = callFrame->r(cond).getRegLabel();
+           JSLabel contextLabel = callFrame->regLabel(cond);
             if (contextLabel.Star())
                 ABORT_TRANSACTION();
             OP_BRANCH(contextLabel);
@@ -7221,7 +7597,7 @@ skip_put_by_id:
         
         // IFC4BC -- To push context label on the pcstack
         if (labelReq && !isPolicy) {
-           JSLabel contextLabel = callFrame->r(src).getRegLabel();
+           JSLabel contextLabel = callFrame->regLabel(src);
             if (contextLabel.Star())
                 ABORT_TRANSACTION();
             OP_BRANCH(contextLabel);
@@ -7248,7 +7624,7 @@ skip_put_by_id:
         
         // IFC4BC -- To push context label on the pcstack
         if (labelReq && !isPolicy) {
-            JSLabel contextLabel = callFrame->r(src).getRegLabel();
+            JSLabel contextLabel = callFrame->regLabel(src);
             if (contextLabel.Star())
                 ABORT_TRANSACTION();
             OP_BRANCH(contextLabel);
@@ -7275,7 +7651,7 @@ skip_put_by_id:
         
         // IFC4BC -- To push context label on the pcstack
         if (labelReq && !isPolicy) {
-            JSLabel contextLabel = callFrame->r(src).getRegLabel();
+            JSLabel contextLabel = callFrame->regLabel(src);
             if (contextLabel.Star())
                 ABORT_TRANSACTION();
             OP_BRANCH(contextLabel);
@@ -7309,7 +7685,7 @@ skip_put_by_id:
         bool result = jsLess<true>(callFrame, src1, src2);
         if (labelReq && !isPolicy) {
             JSLabel contextLabel;
-            JSLabel tdstLabel = (callFrame->r(vPC[1].u.operand).getRegLabel().Join(callFrame->r(vPC[2].u.operand).getRegLabel()));
+            JSLabel tdstLabel = (callFrame->regLabel(vPC[1].u.operand).Join(callFrame->regLabel(vPC[2].u.operand)));
             uint64_t dstL = tdstLabel.Val();
             /*
             if (pcLabel <= tdstLabel) {
@@ -7397,7 +7773,7 @@ skip_put_by_id:
         bool result = jsLessEq<true>(callFrame, src1, src2);
         
         if (labelReq && !isPolicy) {
-//            JSLabel contextLabel = callFrame->r(vPC[1].u.operand).getRegLabel().Join(callFrame->r(vPC[2].u.operand).getRegLabel());
+//            JSLabel contextLabel = callFrame->regLabel(vPC[1].u.operand).Join(callFrame->regLabel(vPC[2].u.operand));
 //            if (contextLabel >= pcLabel) {
 //                uint64_t i = 1;
 //                uint64_t pLabel = contextLabel.pLabel;
@@ -7414,7 +7790,7 @@ skip_put_by_id:
 //                contextLabel.pLabel = pLabel;
 //            }
             JSLabel contextLabel;
-            JSLabel tdstLabel = (callFrame->r(vPC[1].u.operand).getRegLabel().Join(callFrame->r(vPC[2].u.operand).getRegLabel()));
+            JSLabel tdstLabel = (callFrame->regLabel(vPC[1].u.operand).Join(callFrame->regLabel(vPC[2].u.operand)));
             uint64_t dstL = tdstLabel.Val();
             /*
             if (pcLabel <= tdstLabel) {
@@ -7488,7 +7864,7 @@ skip_put_by_id:
         bool result = jsLess<false>(callFrame, src2, src1);
        
         if (labelReq && !isPolicy) {
-//            JSLabel contextLabel = callFrame->r(vPC[1].u.operand).getRegLabel().Join(callFrame->r(vPC[2].u.operand).getRegLabel());
+//            JSLabel contextLabel = callFrame->regLabel(vPC[1].u.operand).Join(callFrame->regLabel(vPC[2].u.operand));
 //            if (contextLabel >= pcLabel) {
 //                uint64_t i = 1;
 //                uint64_t pLabel = contextLabel.pLabel;
@@ -7505,7 +7881,7 @@ skip_put_by_id:
 //                contextLabel.pLabel = pLabel;
 //            }
             JSLabel contextLabel;
-            JSLabel tdstLabel = (callFrame->r(vPC[1].u.operand).getRegLabel().Join(callFrame->r(vPC[2].u.operand).getRegLabel()));
+            JSLabel tdstLabel = (callFrame->regLabel(vPC[1].u.operand).Join(callFrame->regLabel(vPC[2].u.operand)));
             uint64_t dstL = tdstLabel.Val();
             /*
             if (pcLabel <= tdstLabel) {
@@ -7579,7 +7955,7 @@ skip_put_by_id:
         bool result = jsLessEq<false>(callFrame, src2, src1);
       
         if (labelReq && !isPolicy) {
-//            JSLabel contextLabel = callFrame->r(vPC[1].u.operand).getRegLabel().Join(callFrame->r(vPC[2].u.operand).getRegLabel());
+//            JSLabel contextLabel = callFrame->regLabel(vPC[1].u.operand).Join(callFrame->regLabel(vPC[2].u.operand));
 //            if (contextLabel >= pcLabel) {
 //                uint64_t i = 1;
 //                uint64_t pLabel = contextLabel.pLabel;
@@ -7596,7 +7972,7 @@ skip_put_by_id:
 //                contextLabel.pLabel = pLabel;
 //            }
             JSLabel contextLabel;
-            JSLabel tdstLabel = (callFrame->r(vPC[1].u.operand).getRegLabel().Join(callFrame->r(vPC[2].u.operand).getRegLabel()));
+            JSLabel tdstLabel = (callFrame->regLabel(vPC[1].u.operand).Join(callFrame->regLabel(vPC[2].u.operand)));
             uint64_t dstL = tdstLabel.Val();
             /*
             if (pcLabel <= tdstLabel) {
@@ -7668,7 +8044,7 @@ skip_put_by_id:
         bool result = jsLess<true>(callFrame, src1, src2);
         
         if (labelReq && !isPolicy) {
-//            JSLabel contextLabel = callFrame->r(vPC[1].u.operand).getRegLabel().Join(callFrame->r(vPC[2].u.operand).getRegLabel());
+//            JSLabel contextLabel = callFrame->regLabel(vPC[1].u.operand).Join(callFrame->regLabel(vPC[2].u.operand));
 //            if (contextLabel >= pcLabel) {
 //                uint64_t i = 1;
 //                uint64_t pLabel = contextLabel.pLabel;
@@ -7685,7 +8061,7 @@ skip_put_by_id:
 //                contextLabel.pLabel = pLabel;
 //            }
             JSLabel contextLabel;
-            JSLabel tdstLabel = (callFrame->r(vPC[1].u.operand).getRegLabel().Join(callFrame->r(vPC[2].u.operand).getRegLabel()));
+            JSLabel tdstLabel = (callFrame->regLabel(vPC[1].u.operand).Join(callFrame->regLabel(vPC[2].u.operand)));
             uint64_t dstL = tdstLabel.Val();
             /*
             if (pcLabel <= tdstLabel) {
@@ -7755,7 +8131,7 @@ skip_put_by_id:
         bool result = jsLessEq<true>(callFrame, src1, src2);
         
         if (labelReq && !isPolicy) {
-//            JSLabel contextLabel = callFrame->r(vPC[1].u.operand).getRegLabel().Join(callFrame->r(vPC[2].u.operand).getRegLabel());
+//            JSLabel contextLabel = callFrame->regLabel(vPC[1].u.operand).Join(callFrame->regLabel(vPC[2].u.operand));
 //            if (contextLabel >= pcLabel) {
 //                uint64_t i = 1;
 //                uint64_t pLabel = contextLabel.pLabel;
@@ -7772,7 +8148,7 @@ skip_put_by_id:
 //                contextLabel.pLabel = pLabel;
 //            }
             JSLabel contextLabel;
-            JSLabel tdstLabel = (callFrame->r(vPC[1].u.operand).getRegLabel().Join(callFrame->r(vPC[2].u.operand).getRegLabel()));
+            JSLabel tdstLabel = (callFrame->regLabel(vPC[1].u.operand).Join(callFrame->regLabel(vPC[2].u.operand)));
             uint64_t dstL = tdstLabel.Val();
             /*
             if (pcLabel <= tdstLabel) {
@@ -7842,7 +8218,7 @@ skip_put_by_id:
         bool result = jsLess<false>(callFrame, src2, src1);
         
         if (labelReq && !isPolicy) {
-//            JSLabel contextLabel = callFrame->r(vPC[1].u.operand).getRegLabel().Join(callFrame->r(vPC[2].u.operand).getRegLabel());
+//            JSLabel contextLabel = callFrame->regLabel(vPC[1].u.operand).Join(callFrame->regLabel(vPC[2].u.operand));
 //            if (contextLabel >= pcLabel) {
 //                uint64_t i = 1;
 //                uint64_t pLabel = contextLabel.pLabel;
@@ -7859,7 +8235,7 @@ skip_put_by_id:
 //                contextLabel.pLabel = pLabel;
 //            }
             JSLabel contextLabel;
-            JSLabel tdstLabel = (callFrame->r(vPC[1].u.operand).getRegLabel().Join(callFrame->r(vPC[2].u.operand).getRegLabel()));
+            JSLabel tdstLabel = (callFrame->regLabel(vPC[1].u.operand).Join(callFrame->regLabel(vPC[2].u.operand)));
             uint64_t dstL = tdstLabel.Val();
             /*
             if (pcLabel <= tdstLabel) {
@@ -7929,7 +8305,7 @@ skip_put_by_id:
         bool result = jsLessEq<false>(callFrame, src2, src1);
         
         if (labelReq && !isPolicy) {
-//            JSLabel contextLabel = callFrame->r(vPC[1].u.operand).getRegLabel().Join(callFrame->r(vPC[2].u.operand).getRegLabel());
+//            JSLabel contextLabel = callFrame->regLabel(vPC[1].u.operand).Join(callFrame->regLabel(vPC[2].u.operand));
 //            if (contextLabel >= pcLabel) {
 //                uint64_t i = 1;
 //                uint64_t pLabel = contextLabel.pLabel;
@@ -7946,7 +8322,7 @@ skip_put_by_id:
 //                contextLabel.pLabel = pLabel;
 //            }
             JSLabel contextLabel;
-            JSLabel tdstLabel = (callFrame->r(vPC[1].u.operand).getRegLabel().Join(callFrame->r(vPC[2].u.operand).getRegLabel()));
+            JSLabel tdstLabel = (callFrame->regLabel(vPC[1].u.operand).Join(callFrame->regLabel(vPC[2].u.operand)));
             uint64_t dstL = tdstLabel.Val();
             /*
             if (pcLabel <= tdstLabel) {
@@ -8016,7 +8392,7 @@ skip_put_by_id:
         bool result = jsLess<true>(callFrame, src1, src2);
 
         if (labelReq && !isPolicy) {
-//            JSLabel contextLabel = callFrame->r(vPC[1].u.operand).getRegLabel().Join(callFrame->r(vPC[2].u.operand).getRegLabel());
+//            JSLabel contextLabel = callFrame->regLabel(vPC[1].u.operand).Join(callFrame->regLabel(vPC[2].u.operand));
 //            if (contextLabel >= pcLabel) {
 //                uint64_t i = 1;
 //                uint64_t pLabel = contextLabel.pLabel;
@@ -8033,7 +8409,7 @@ skip_put_by_id:
 //                contextLabel.pLabel = pLabel;
 //            }
             JSLabel contextLabel;
-            JSLabel tdstLabel = (callFrame->r(vPC[1].u.operand).getRegLabel().Join(callFrame->r(vPC[2].u.operand).getRegLabel()));
+            JSLabel tdstLabel = (callFrame->regLabel(vPC[1].u.operand).Join(callFrame->regLabel(vPC[2].u.operand)));
             uint64_t dstL = tdstLabel.Val();
             /*
             if (pcLabel <= tdstLabel) {
@@ -8103,7 +8479,7 @@ skip_put_by_id:
         bool result = jsLessEq<true>(callFrame, src1, src2);
 
         if (labelReq && !isPolicy) {
-//            JSLabel contextLabel = callFrame->r(vPC[1].u.operand).getRegLabel().Join(callFrame->r(vPC[2].u.operand).getRegLabel());
+//            JSLabel contextLabel = callFrame->regLabel(vPC[1].u.operand).Join(callFrame->regLabel(vPC[2].u.operand));
 //            if (contextLabel >= pcLabel) {
 //                uint64_t i = 1;
 //                uint64_t pLabel = contextLabel.pLabel;
@@ -8120,7 +8496,7 @@ skip_put_by_id:
 //                contextLabel.pLabel = pLabel;
 //            }
             JSLabel contextLabel;
-            JSLabel tdstLabel = (callFrame->r(vPC[1].u.operand).getRegLabel().Join(callFrame->r(vPC[2].u.operand).getRegLabel()));
+            JSLabel tdstLabel = (callFrame->regLabel(vPC[1].u.operand).Join(callFrame->regLabel(vPC[2].u.operand)));
             uint64_t dstL = tdstLabel.Val();
             /*
             if (pcLabel <= tdstLabel) {
@@ -8191,7 +8567,7 @@ skip_put_by_id:
         bool result = jsLess<false>(callFrame, src2, src1);
         
         if (labelReq && !isPolicy) {
-//            JSLabel contextLabel = callFrame->r(vPC[1].u.operand).getRegLabel().Join(callFrame->r(vPC[2].u.operand).getRegLabel());
+//            JSLabel contextLabel = callFrame->regLabel(vPC[1].u.operand).Join(callFrame->regLabel(vPC[2].u.operand));
 //            if (contextLabel >= pcLabel) {
 //                uint64_t i = 1;
 //                uint64_t pLabel = contextLabel.pLabel;
@@ -8208,7 +8584,7 @@ skip_put_by_id:
 //                contextLabel.pLabel = pLabel;
 //            }
             JSLabel contextLabel;
-            JSLabel tdstLabel = (callFrame->r(vPC[1].u.operand).getRegLabel().Join(callFrame->r(vPC[2].u.operand).getRegLabel()));
+            JSLabel tdstLabel = (callFrame->regLabel(vPC[1].u.operand).Join(callFrame->regLabel(vPC[2].u.operand)));
             uint64_t dstL = tdstLabel.Val();
             /*
             if (pcLabel <= tdstLabel) {
@@ -8278,7 +8654,7 @@ skip_put_by_id:
         bool result = jsLessEq<false>(callFrame, src2, src1);
         
         if (labelReq && !isPolicy) {
-//            JSLabel contextLabel = callFrame->r(vPC[1].u.operand).getRegLabel().Join(callFrame->r(vPC[2].u.operand).getRegLabel());
+//            JSLabel contextLabel = callFrame->regLabel(vPC[1].u.operand).Join(callFrame->regLabel(vPC[2].u.operand));
 //            if (contextLabel >= pcLabel) {
 //                uint64_t i = 1;
 //                uint64_t pLabel = contextLabel.pLabel;
@@ -8295,7 +8671,7 @@ skip_put_by_id:
 //                contextLabel.pLabel = pLabel;
 //            }
             JSLabel contextLabel;
-            JSLabel tdstLabel = (callFrame->r(vPC[1].u.operand).getRegLabel().Join(callFrame->r(vPC[2].u.operand).getRegLabel()));
+            JSLabel tdstLabel = (callFrame->regLabel(vPC[1].u.operand).Join(callFrame->regLabel(vPC[2].u.operand)));
             uint64_t dstL = tdstLabel.Val();
             /*
             if (pcLabel <= tdstLabel) {
@@ -8365,7 +8741,7 @@ skip_put_by_id:
         JSValue scrutinee = callFrame->r(vPC[3].u.operand).jsValue();
         
         if (labelReq && !isPolicy) {
-            JSLabel contextLabel = callFrame->r(vPC[3].u.operand).getRegLabel();
+            JSLabel contextLabel = callFrame->regLabel(vPC[3].u.operand);
             if (contextLabel.Star())
                 ABORT_TRANSACTION();
             OP_BRANCH(contextLabel);
@@ -8392,7 +8768,7 @@ skip_put_by_id:
         int defaultOffset = vPC[2].u.operand;
         JSValue scrutinee = callFrame->r(vPC[3].u.operand).jsValue();
         if (labelReq && !isPolicy) {
-            JSLabel contextLabel = callFrame->r(vPC[3].u.operand).getRegLabel();
+            JSLabel contextLabel = callFrame->regLabel(vPC[3].u.operand);
             if (contextLabel.Star())
                 ABORT_TRANSACTION();
             OP_BRANCH(contextLabel);
@@ -8421,7 +8797,7 @@ skip_put_by_id:
         int defaultOffset = vPC[2].u.operand;
         JSValue scrutinee = callFrame->r(vPC[3].u.operand).jsValue();
         if (labelReq && !isPolicy) {
-            JSLabel contextLabel = callFrame->r(vPC[3].u.operand).getRegLabel();
+            JSLabel contextLabel = callFrame->regLabel(vPC[3].u.operand);
             if (contextLabel.Star())
                 ABORT_TRANSACTION();
             OP_BRANCH(contextLabel);
@@ -8452,8 +8828,8 @@ skip_put_by_id:
             fV.asCell()->structure()->setProtoLabel(pcLabel/*.Join(codeBlock->contextLabel)*/);
             if (labelReq && !isPolicy) {
                 JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/;
-                if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                    printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+                if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+                    IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                     dstLabel.setStar(true);
                 }
                 else
@@ -8461,7 +8837,7 @@ skip_put_by_id:
                     // dstLabel.setStar(false);
                 }
                 callFrame->uncheckedR(dst) = fV;
-                callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+                callFrame->setRegLabel(dst, dstLabel);
             }
             else {
                 callFrame->uncheckedR(dst) = fV;                
@@ -8507,8 +8883,8 @@ skip_put_by_id:
         // IFC4BC - Setting the value label
         if (labelReq && !isPolicy) {
             JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/;
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             else
@@ -8516,7 +8892,7 @@ skip_put_by_id:
                 // dstLabel.setStar(false);
             }
             callFrame->uncheckedR(dst) = JSValue(func);
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             callFrame->uncheckedR(dst) = JSValue(func);
@@ -8574,9 +8950,9 @@ skip_put_by_id:
                 JSLabel funcLabel = asObject(funcVal)->getObjectLabel();
                 if (funcLabel.Star())
                 {
-                    printf("Function object contains a star in call_eval\n");
+                    IFC_TRACE(StarredCall, codeBlock, vPC - iBegin, funcLabel.Val(), pcLabel.Val());
                 }
-                funcLabel = funcLabel.Join(callFrame->r(func).getRegLabel());
+                funcLabel = funcLabel.Join(callFrame->regLabel(func));
                 OP_CALLBRANCH(funcLabel, (existsHandler || pcstack.excHandler()), existsHandler);
             }
             //---------------------------------------------------------------//
@@ -8659,16 +9035,16 @@ skip_put_by_id:
             // if ((pcLabel/*.Join(codeBlock->contextLabel)*/ != funcLabel || !(JSLabelMap::labelMap().isOrdered(pcLabel.Val(), funcLabel.Val()))) && !labelReq)
             if ((pcLabel != funcLabel) && !labelReq)
             {
-                labelReq = true;
+                REQUIRE_LABELS();
                 labelRegisters(callFrame, codeBlock, pcLabel);
             }
             
             if (labelReq && !isPolicy) {
                 if (funcLabel.Star())
                 {
-                    printf("Function object contains a star in call\n");
+                    IFC_TRACE(StarredCall, codeBlock, vPC - iBegin, funcLabel.Val(), pcLabel.Val());
                 }
-                funcLabel = funcLabel.Join(callFrame->r(func).getRegLabel());
+                funcLabel = funcLabel.Join(callFrame->regLabel(func));
                 OP_CALLBRANCH(funcLabel, (existsHandler || pcstack.excHandler()), existsHandler);
             }
             else {
@@ -8676,10 +9052,9 @@ skip_put_by_id:
             }
             pcLabel = pcstack.Head();
             pcLabel.setStar(false);
-            JSLabel::pcGlobalLabel = pcLabel.getPair();
-            JSLabel::BRANCH_FLAG = pcstack.branchFlag();
+            ifcContext.pcGlobalLabel = pcLabel.getPair();
+            ifcContext.branchFlag = pcstack.branchFlag();
 
-            printf("Function call %p from %p at %ld with label %lld\n", newCodeBlock, codeBlock, vPC - iBegin, pcLabel.Val());
             // OP_CALLBRANCH(pcstack.Head(), (existsHandler || pcstack.excHandler()), existsHandler);
             
             // For cases when the call itself has two possible paths
@@ -8700,23 +9075,8 @@ skip_put_by_id:
                 goto vm_throw;
             }
             
-            // IFC4BC - Create CFG
-            if (pcstack.excHandler()) {
-                // SEN exists
-                if (!newCodeBlock->has_SENanalysis) {
-                    newCodeBlock->analyzerSEN.genContextTable(newCodeBlock, this, pcstack.excHandler());
-                    newCodeBlock->has_SENanalysis = true;
-                }
-                newCodeBlock->analyzer = newCodeBlock->analyzerSEN;
-            }
-            else {
-                // No exception handler
-                if (!newCodeBlock->has_analysis) {
-                    newCodeBlock->analyzerNOR.genContextTable(newCodeBlock, this, pcstack.excHandler());
-                    newCodeBlock->has_analysis = true;
-                }
-                newCodeBlock->analyzer = newCodeBlock->analyzerNOR;
-            }
+            // IFC4BC - Analysis flavor; the CFG is built on the first branch
+            newCodeBlock->selectAnalysis(pcstack.excHandler());
             // -------------------------
             
             callFrame->init(newCodeBlock, vPC + OPCODE_LENGTH(op_call), callDataScopeChain, previousCallFrame, argCount, jsCast<JSFunction*>(v));
@@ -8729,13 +9089,14 @@ skip_put_by_id:
                 {
                     // Can assign just pc as it is already a join
                     if (j <= argCount)
-                        callFrame->uncheckedR(i).setRegLabel(callFrame->r(i).getRegLabel().Join(pcLabel));
+                        callFrame->setRegLabel(i, callFrame->regLabel(i).Join(pcLabel));
                 }
             }
              */
             //------
             
             codeBlock = newCodeBlock;
+            CHECK_LABELED_INSTRUCTIONS();
             ASSERT(codeBlock == callFrame->codeBlock());
             *topCallFrameSlot = callFrame;
             vPC = newCodeBlock->instructions().begin();
@@ -8750,34 +9111,30 @@ skip_put_by_id:
         
         if (callType == CallTypeHost) {
             // IFC4BC - Passing the label to WebCore
-            JSLabel::pcGlobalLabel = pcLabel.getPair();
-            JSLabel::BRANCH_FLAG = pcstack.branchFlag();
+            ifcContext.pcGlobalLabel = pcLabel.getPair();
+            ifcContext.branchFlag = pcstack.branchFlag();
             ScopeChainNode* scopeChain = callFrame->scopeChain();
             CallFrame* newCallFrame = CallFrame::create(callFrame->registers() + registerOffset);
             newCallFrame->init(0, vPC + OPCODE_LENGTH(op_call), scopeChain, callFrame, argCount, asObject(v));
             JSValue returnValue;
             JSLabel argumentsLabel = JSLabel();
+            ExecState* outerHostCall = ifcContext.labeledHostCall;
+            JSLabel outerHostCallPC = ifcContext.hostCallPCLabel;
+            JSLabel* outerReturnLabel = ifcContext.returnLabel;
+            JSLabel hostReturnLabel;
+            ifcContext.labeledHostCall = 0;
+            ifcContext.returnLabel = &hostReturnLabel;
             
             if (labelReq && !isPolicy) {
                 // IFC4BC - Passing the argument labels
-                for (int i = 0, j = -7; i < argCount; i++, j--) {
-                    if (i == 100) {
-                        printf("More than 100 arguments to native function call\n");
-                        // ABORT_CALL();
-                        break;
-                    }
-                    
-                    if (i != 0)
-                    {
-                        JSLabel::argLabel[i] = newCallFrame->r(j).getRegLabel().Join(pcLabel/*.Join(codeBlock->contextLabel)*/).getPair();
-                    }
-                    else
-                    {
-                        JSLabel::argLabel[i] = newCallFrame->r(j).getRegLabel().getPair();
-                    }
-                     
-                    argumentsLabel = argumentsLabel.Join(newCallFrame->r(j).getRegLabel());
-                }
+                IFC_COUNT(codeBlock, LabeledHostCall);
+                IFC_COUNT_N(codeBlock, HostArgumentLabels, argCount);
+                // The callee reads them from its own registers; see
+                // ExecState::argumentLabel
+                ifcContext.labeledHostCall = newCallFrame;
+                ifcContext.hostCallPCLabel = pcLabel;
+                for (int i = 0; i < argCount; i++)
+                    argumentsLabel = argumentsLabel.Join(newCallFrame->uncheckedRegLabel(CallFrame::argumentOffsetIncludingThis(i)));
             }
             
             {
@@ -8786,10 +9143,13 @@ skip_put_by_id:
                 returnValue = (callData.native.function(newCallFrame));
                 *topCallFrameSlot = callFrame;
             }
+            ifcContext.labeledHostCall = outerHostCall;
+            ifcContext.hostCallPCLabel = outerHostCallPC;
+            ifcContext.returnLabel = outerReturnLabel;
             
             if (!isPolicy)
                 for (int i = -1; i >= -6; i--)
-                    newCallFrame->uncheckedR(i).setRegLabel(pcLabel);
+                    newCallFrame->setRegLabel(i, pcLabel);
             
             // IFC4BC
             if (isPolicy && isSetLabel) // Did the policy set the label for global variable?
@@ -8811,8 +9171,8 @@ skip_put_by_id:
                 }
             }
                 
-            if (JSLabel::ABORT_FLAG) {
-                JSLabel::ABORT_FLAG = false;
+            if (ifcContext.abortFlag) {
+                ifcContext.abortFlag = false;
                 ABORT_TRANSACTION();
             }
             
@@ -8823,22 +9183,15 @@ skip_put_by_id:
             {
                 returnValue.setValueLabel(returnValue.joinValueLabel(pcLabel/*.Join(codeBlock->contextLabel)*/.Join(argumentsLabel)));
             }
-            returnValue.setValueLabel(returnValue.joinValueLabel(JSLabel::returnLabel));
-            JSLabel::returnLabel = JSLabel().getPair();
+            returnValue.setValueLabel(returnValue.joinValueLabel(hostReturnLabel));
             if (returnValue.getValueLabel().Val() != pcLabel/*.Join(codeBlock->contextLabel)*/.Val() && !labelReq)
             {
-                labelReq = true;
+                REQUIRE_LABELS();
                 labelRegisters(callFrame, codeBlock, pcLabel);
             }
             
-            // Reset the argLabel to 0.
-            if (!isPolicy)
-                for (int i = 0; i < argCount; i++) {
-                    JSLabel::argLabel[i] = JSLabel().getPair();
-                }
-            
-            JSLabel::pcGlobalLabel = pcLabel.getPair();
-            JSLabel::BRANCH_FLAG = pcstack.branchFlag();
+            ifcContext.pcGlobalLabel = pcLabel.getPair();
+            ifcContext.branchFlag = pcstack.branchFlag();
             
             CHECK_FOR_EXCEPTION(returnValue.getValueLabel());
             
@@ -8938,15 +9291,15 @@ skip_put_by_id:
             // if ((funcLabel != pcLabel || !(JSLabelMap::labelMap().isOrdered(pcLabel.Val(), funcLabel.Val()))) && !labelReq)
             if ((funcLabel != pcLabel) && !labelReq)
             {
-                labelReq = true;
+                REQUIRE_LABELS();
                 labelRegisters(callFrame, codeBlock, pcLabel);
             }
             if (labelReq && !isPolicy) {
                 if (funcLabel.Star())
                 {
-                    printf("Function object contains a star in call\n");
+                    IFC_TRACE(StarredCall, codeBlock, vPC - iBegin, funcLabel.Val(), pcLabel.Val());
                 }
-                funcLabel = funcLabel.Join(callFrame->r(vPC[1].u.operand).getRegLabel());
+                funcLabel = funcLabel.Join(callFrame->regLabel(vPC[1].u.operand));
                 OP_CALLBRANCH(funcLabel, (existsHandler || pcstack.excHandler()), existsHandler);
             }
             else {
@@ -8955,8 +9308,8 @@ skip_put_by_id:
             
             pcLabel = pcstack.Head();
             pcLabel.setStar(false);
-            JSLabel::pcGlobalLabel = pcLabel.getPair();
-            JSLabel::BRANCH_FLAG = pcstack.branchFlag();
+            ifcContext.pcGlobalLabel = pcLabel.getPair();
+            ifcContext.branchFlag = pcstack.branchFlag();
             // printf("Function call with label %lld\n", pcLabel.Val());
             // printf("Function call varargs %p from %p at %ld with label %lld\n", newCodeBlock,
                    // codeBlock, vPC - iBegin, pcLabel.Val());
@@ -8972,27 +9325,14 @@ skip_put_by_id:
             }
              */
             
-            if (pcstack.excHandler()) {
-                // SEN exists
-                if (!newCodeBlock->has_SENanalysis) {
-                    newCodeBlock->analyzerSEN.genContextTable(newCodeBlock, this, pcstack.excHandler());
-                    newCodeBlock->has_SENanalysis = true;
-                }
-                newCodeBlock->analyzer = newCodeBlock->analyzerSEN;
-            }
-            else {
-                // No exception handler
-                if (!newCodeBlock->has_analysis) {
-                    newCodeBlock->analyzerNOR.genContextTable(newCodeBlock, this, pcstack.excHandler());
-                    newCodeBlock->has_analysis = true;
-                }
-                newCodeBlock->analyzer = newCodeBlock->analyzerNOR;
-            }
+            // IFC4BC - Analysis flavor; the CFG is built on the first branch
+            newCodeBlock->selectAnalysis(pcstack.excHandler());
             // -------------------------
             
             newCallFrame->init(newCodeBlock, vPC + OPCODE_LENGTH(op_call_varargs), callDataScopeChain, callFrame, argCount, jsCast<JSFunction*>(v));
             
             codeBlock = newCodeBlock;
+            CHECK_LABELED_INSTRUCTIONS();
             callFrame = newCallFrame;
             ASSERT(codeBlock == callFrame->codeBlock());
             *topCallFrameSlot = callFrame;
@@ -9005,7 +9345,7 @@ skip_put_by_id:
             if (labelReq) {
                 for(int i = -7, j = 1; j <= newCodeBlock->numParameters(); j++, i--)
                     if (j <= argCount)
-                        callFrame->uncheckedR(i).setRegLabel(callFrame->r(i).getRegLabel().Join(pcLabel));
+                        callFrame->setRegLabel(i, callFrame->regLabel(i).Join(pcLabel));
             }
              */
             //------
@@ -9018,34 +9358,30 @@ skip_put_by_id:
         }
         
         if (callType == CallTypeHost) {
-            JSLabel::pcGlobalLabel = pcLabel.getPair();
-            JSLabel::BRANCH_FLAG = pcstack.branchFlag();
+            ifcContext.pcGlobalLabel = pcLabel.getPair();
+            ifcContext.branchFlag = pcstack.branchFlag();
             ScopeChainNode* scopeChain = callFrame->scopeChain();
             newCallFrame->init(0, vPC + OPCODE_LENGTH(op_call_varargs), scopeChain, callFrame, argCount, asObject(v));
             
             JSValue returnValue;
             JSLabel argumentsLabel = JSLabel();
+            ExecState* outerHostCall = ifcContext.labeledHostCall;
+            JSLabel outerHostCallPC = ifcContext.hostCallPCLabel;
+            JSLabel* outerReturnLabel = ifcContext.returnLabel;
+            JSLabel hostReturnLabel;
+            ifcContext.labeledHostCall = 0;
+            ifcContext.returnLabel = &hostReturnLabel;
             
             if (labelReq && !isPolicy) {
                 // IFC4BC - Passing the argument labels
-                for (int i = 0, j = -7; i < argCount; i++, j--) {
-                    if (i == 100) {
-                        printf("More than 100 arguments to native function call_varargs\n");
-                        // ABORT_CALL();
-                        break;
-                    }
-                    
-                    if (i != 0)
-                    {
-                        JSLabel::argLabel[i] = newCallFrame->r(j).getRegLabel().Join(pcLabel).getPair();
-                    }
-                    else
-                    {
-                        JSLabel::argLabel[i] = newCallFrame->r(j).getRegLabel().getPair();
-                    }
-                     
-                    argumentsLabel = argumentsLabel.Join(newCallFrame->r(j).getRegLabel());
-                }
+                IFC_COUNT(codeBlock, LabeledHostCall);
+                IFC_COUNT_N(codeBlock, HostArgumentLabels, argCount);
+                // The callee reads them from its own registers; see
+                // ExecState::argumentLabel
+                ifcContext.labeledHostCall = newCallFrame;
+                ifcContext.hostCallPCLabel = pcLabel;
+                for (int i = 0; i < argCount; i++)
+                    argumentsLabel = argumentsLabel.Join(newCallFrame->uncheckedRegLabel(CallFrame::argumentOffsetIncludingThis(i)));
             }
             {
                 *topCallFrameSlot = newCallFrame;
@@ -9053,33 +9389,29 @@ skip_put_by_id:
                 returnValue = (callData.native.function(newCallFrame));
                 *topCallFrameSlot = callFrame;
             }
+            ifcContext.labeledHostCall = outerHostCall;
+            ifcContext.hostCallPCLabel = outerHostCallPC;
+            ifcContext.returnLabel = outerReturnLabel;
             if (!isPolicy)
                 for (int i = -1; i >= -6; i--)
-                    newCallFrame->uncheckedR(i).setRegLabel(pcLabel);
+                    newCallFrame->setRegLabel(i, pcLabel);
             
             // IFC4BC
-            if (JSLabel::ABORT_FLAG) {
-                JSLabel::ABORT_FLAG = false;
+            if (ifcContext.abortFlag) {
+                ifcContext.abortFlag = false;
                 ABORT_TRANSACTION();
             }
             
             // Join the return value with the pc in which it was performed
             returnValue.setValueLabel(returnValue.joinValueLabel(pcLabel/*.Join(codeBlock->contextLabel)*/.Join(argumentsLabel)));
-            returnValue.setValueLabel(returnValue.joinValueLabel(JSLabel::returnLabel));
-            JSLabel::returnLabel = JSLabel().getPair();
+            returnValue.setValueLabel(returnValue.joinValueLabel(hostReturnLabel));
             if (returnValue.getValueLabel().Val() != pcLabel/*.Join(codeBlock->contextLabel)*/.Val() && !labelReq)
             {
-                labelReq = true;
+                REQUIRE_LABELS();
                 labelRegisters(callFrame, codeBlock, pcLabel/*.Join(codeBlock->contextLabel)*/);
             }
-            // Reset the argLabel to 0.
-            
-            for (int i = 0; i < argCount; i++) {
-                JSLabel::argLabel[i] = JSLabel().getPair();
-            }
-            
-            JSLabel::pcGlobalLabel = pcLabel.getPair();
-            JSLabel::BRANCH_FLAG = pcstack.branchFlag();
+            ifcContext.pcGlobalLabel = pcLabel.getPair();
+            ifcContext.branchFlag = pcstack.branchFlag();
             
             CHECK_FOR_EXCEPTION(returnValue.getValueLabel());
             
@@ -9113,7 +9445,7 @@ skip_put_by_id:
         // Label the activation object being copied
         
         if (activationValue) {
-            if (callFrame->r(activation).getRegLabel().Star())
+            if (callFrame->regLabel(activation).Star())
                 ABORT_TRANSACTION();
             
             asActivation(activationValue)->tearOff(*globalData);
@@ -9143,7 +9475,7 @@ skip_put_by_id:
         int src1 = vPC[1].u.operand;
         ASSERT(!codeBlock->needsFullScopeChain() && codeBlock->ownerExecutable()->usesArguments());
         
-        if (callFrame->r(src1).getRegLabel().Star())
+        if (callFrame->regLabel(src1).Star())
             ABORT_TRANSACTION();
         
         if (JSValue arguments = callFrame->r(unmodifiedArgumentsRegister(src1)).jsValue())
@@ -9187,13 +9519,13 @@ skip_put_by_id:
             pcReg = pcstack.Reg();
             pcLabel = pcstack.Head();
             pcLabel.setStar(false);
-            JSLabel::pcGlobalLabel = pcLabel.getPair();
-            JSLabel::BRANCH_FLAG = pcstack.branchFlag();
+            ifcContext.pcGlobalLabel = pcLabel.getPair();
+            ifcContext.branchFlag = pcstack.branchFlag();
         }
         int result = vPC[1].u.operand;
         
         JSValue returnValue = callFrame->r(result).jsValue();
-        returnValue.setValueLabel(callFrame->r(result).getRegLabel().Join(pcLabel/*.Join(codeBlock->contextLabel)*/));
+        returnValue.setValueLabel(callFrame->regLabel(result).Join(pcLabel/*.Join(codeBlock->contextLabel)*/));
         
         CallFrame* prevCallFrame = callFrame;
         
@@ -9205,8 +9537,8 @@ skip_put_by_id:
             pcSLen = pcstack.Len();
             pcReg = pcstack.Reg();
             pcLabel.setStar(false);
-            JSLabel::pcGlobalLabel = pcLabel.getPair();
-            JSLabel::BRANCH_FLAG = pcstack.branchFlag();
+            ifcContext.pcGlobalLabel = pcLabel.getPair();
+            ifcContext.branchFlag = pcstack.branchFlag();
         }
 
         vPC = callFrame->returnVPC();
@@ -9218,6 +9550,7 @@ skip_put_by_id:
         *topCallFrameSlot = callFrame;
         functionReturnValue = returnValue;
         codeBlock = callFrame->codeBlock();
+        CHECK_LABELED_INSTRUCTIONS();
         iBegin = codeBlock->instructions().begin();
 
         ASSERT(codeBlock == callFrame->codeBlock());
@@ -9246,19 +9579,19 @@ skip_put_by_id:
         
         if (functionReturnValue.getValueLabel().Val() != pcLabel/*.Join(codeBlock->contextLabel)*/.Val() && !labelReq)
         {
-            labelReq = true;
+            REQUIRE_LABELS();
             labelRegisters(callFrame, codeBlock, pcLabel/*.Join(codeBlock->contextLabel)*/);
         }
         if (labelReq && !isPolicy) {
-            if (!noSensitiveUpgrade(callFrame->uncheckedR(vPC[1].u.operand).getRegLabel())) {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->uncheckedR(vPC[1].u.operand).getRegLabel().Val(), pcLabel.Val());
+            if (!noSensitiveUpgrade(codeBlock, callFrame->uncheckedRegLabel(vPC[1].u.operand))) {
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->uncheckedRegLabel(vPC[1].u.operand).Val(), pcLabel.Val());
                 retLabel.setStar(true);
             }
             else {
                 retLabel.setStar(false);
             }
             callFrame->uncheckedR(vPC[1].u.operand) = functionReturnValue;
-            callFrame->uncheckedR(vPC[1].u.operand).setRegLabel(retLabel);
+            callFrame->setRegLabel(vPC[1].u.operand, retLabel);
         }
         else {
             callFrame->uncheckedR(vPC[1].u.operand) = functionReturnValue;            
@@ -9301,21 +9634,21 @@ skip_put_by_id:
             pcSLen = pcstack.Len();
             pcReg = pcstack.Reg();
             pcLabel.setStar(false);
-            JSLabel::pcGlobalLabel = pcLabel.getPair();
-            JSLabel::BRANCH_FLAG = pcstack.branchFlag();
+            ifcContext.pcGlobalLabel = pcLabel.getPair();
+            ifcContext.branchFlag = pcstack.branchFlag();
         }
         
         int result = vPC[1].u.operand;
         
         JSValue returnValue = callFrame->r(result).jsValue();
-        returnValue.setValueLabel(callFrame->r(result).getRegLabel().Join(pcLabel/*.Join(codeBlock->contextLabel)*/));
+        returnValue.setValueLabel(callFrame->regLabel(result).Join(pcLabel/*.Join(codeBlock->contextLabel)*/));
         
         // IFC4BC
         CallFrame* prevCallFrame = callFrame;
         
         if (UNLIKELY(!returnValue.isObject())) {
             returnValue = callFrame->r(vPC[2].u.operand).jsValue();
-            returnValue.setValueLabel(callFrame->r(vPC[2].u.operand).getRegLabel());
+            returnValue.setValueLabel(callFrame->regLabel(vPC[2].u.operand));
         }
 
         if (!popNow && !dontPop)
@@ -9326,8 +9659,8 @@ skip_put_by_id:
             pcSLen = pcstack.Len();
             pcReg = pcstack.Reg();
             pcLabel.setStar(false);
-            JSLabel::pcGlobalLabel = pcLabel.getPair();
-            JSLabel::BRANCH_FLAG = pcstack.branchFlag();
+            ifcContext.pcGlobalLabel = pcLabel.getPair();
+            ifcContext.branchFlag = pcstack.branchFlag();
         }
 
         vPC = callFrame->returnVPC();
@@ -9339,6 +9672,7 @@ skip_put_by_id:
         *topCallFrameSlot = callFrame;
         functionReturnValue = returnValue;
         codeBlock = callFrame->codeBlock();
+        CHECK_LABELED_INSTRUCTIONS();
         ASSERT(codeBlock == callFrame->codeBlock());
 
         iBegin = codeBlock->instructions().begin();
@@ -9371,7 +9705,7 @@ skip_put_by_id:
         // Sparse Labelling - We can do without labelling, but keeping it until alternative is found for getting the labels
         if (!isPolicy)
             for (i = 0; i < (size_t)codeBlock->m_numCalleeRegisters; i++) {
-                callFrame->uncheckedR(i).setRegLabel(pcLabel/*.Join(codeBlock->contextLabel)*/);
+                callFrame->setRegLabel(i, pcLabel/*.Join(codeBlock->contextLabel)*/);
             }
         // Setting the labels for the constant registers
         // This happens during move anyways, but might have vague labels
@@ -9382,7 +9716,7 @@ skip_put_by_id:
 //                v.asCell()->setObjectLabel(pcLabel/*.Join(codeBlock->contextLabel)*/);
 //                v.asCell()->structure()->setProtoLabel(pcLabel/*.Join(codeBlock->contextLabel)*/);
 //            }
-//            callFrame->r(index++).setRegLabel(pcLabel/*.Join(codeBlock->contextLabel)*/);
+//            callFrame->setRegLabel(index++, pcLabel/*.Join(codeBlock->contextLabel)*/);
 //        }
         // IFC4BC -------------------------------------------------------- */
         i = 0;
@@ -9392,8 +9726,8 @@ skip_put_by_id:
 //            Identifier& ident = codeBlock->identifier(i++);
 //            printf("P:%s\n", ident.ustring().utf8().data());
 //        }
-        if (JSLabel::ABORT_FLAG) {
-            JSLabel::ABORT_FLAG = false;
+        if (ifcContext.abortFlag) {
+            ifcContext.abortFlag = false;
         }
         vPC += OPCODE_LENGTH(op_enter);
          NEXT_INSTRUCTION();
@@ -9410,25 +9744,26 @@ skip_put_by_id:
             /* IFC4BC - Check the function's label with the current context.
              JSFunction* executingFunction = jsCast<JSFunction*>(callFrame->callee());
              if (labelReq)
-             if(!noSensitiveUpgrade(executingFunction->getObjectLabel()))
+             if(!noSensitiveUpgrade(codeBlock, executingFunction->getObjectLabel()))
              ABORT_TRANSACTION();
              // ------*/
             
+            resolveAliasedRegLabels(callFrame, codeBlock);
             JSActivation* activation = JSActivation::create(*globalData, callFrame, static_cast<FunctionExecutable*>(codeBlock->ownerExecutable()));
             // IFC4BC - Let the label be set
             activation->setObjectLabel(pcLabel/*.Join(codeBlock->contextLabel)*/);
             activation->structure()->setProtoLabel(pcLabel/*.Join(codeBlock->contextLabel)*/);
             if (labelReq && !isPolicy) {
                 JSLabel actLabel = pcLabel/*.Join(codeBlock->contextLabel)*/;
-                if (!noSensitiveUpgrade(callFrame->r(activationReg).getRegLabel())) {
-                    printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(activationReg).getRegLabel().Val(), pcLabel.Val());
+                if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(activationReg))) {
+                    IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(activationReg).Val(), pcLabel.Val());
                     actLabel.setStar(true);
                 }
                 else {
                     // actLabel.setStar(false);
                 }
                 callFrame->r(activationReg) = JSValue(activation);
-                callFrame->r(activationReg).setRegLabel(actLabel);
+                callFrame->setRegLabel(activationReg, actLabel);
             }
             else {
                 callFrame->r(activationReg) = JSValue(activation);
@@ -9467,15 +9802,15 @@ skip_put_by_id:
         newlyCreatedObject->structure()->setProtoLabel(pcLabel/*.Join(codeBlock->contextLabel)*/);
         if (labelReq && !isPolicy) {
             JSLabel thisLabel = pcLabel/*.Join(codeBlock->contextLabel)*/;
-            if (!noSensitiveUpgrade(callFrame->r(thisRegister).getRegLabel())) {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(thisRegister).getRegLabel().Val(), pcLabel.Val());
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(thisRegister))) {
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(thisRegister).Val(), pcLabel.Val());
                 thisLabel.setStar(true);
             }
             else {
                 // thisLabel.setStar(false);
             }
             callFrame->uncheckedR(thisRegister) = JSValue(newlyCreatedObject);
-            callFrame->uncheckedR(thisRegister).setRegLabel(thisLabel);
+            callFrame->setRegLabel(thisRegister, thisLabel);
         }
         else {
             callFrame->uncheckedR(thisRegister) = JSValue(newlyCreatedObject);
@@ -9505,15 +9840,15 @@ skip_put_by_id:
         if (thisVal.isPrimitive()){
             if (labelReq && !isPolicy) {
                 JSLabel thisLabel = pcLabel/*.Join(codeBlock->contextLabel)*/;
-                if(!noSensitiveUpgrade(callFrame->r(thisRegister).getRegLabel())) {
-                    printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(thisRegister).getRegLabel().Val(), pcLabel.Val());
+                if(!noSensitiveUpgrade(codeBlock, callFrame->regLabel(thisRegister))) {
+                    IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(thisRegister).Val(), pcLabel.Val());
                     thisLabel.setStar(true);
                 }
                 else {
                     // thisLabel.setStar(false);
                 }
                 callFrame->uncheckedR(thisRegister) = JSValue(thisVal.toThisObject(callFrame));
-                callFrame->uncheckedR(thisRegister).setRegLabel(thisLabel);
+                callFrame->setRegLabel(thisRegister, thisLabel);
             }
             else {
                 callFrame->uncheckedR(thisRegister) = JSValue(thisVal.toThisObject(callFrame));                
@@ -9539,7 +9874,7 @@ skip_put_by_id:
         // IFC4BC - Set the label to the pcstack head as this is at the beginning of the code block.
         callFrame->uncheckedR(dst) = JSValue();
         if (labelReq && !isPolicy)
-            callFrame->uncheckedR(dst).setRegLabel(pcLabel/*.Join(codeBlock->contextLabel)*/);
+            callFrame->setRegLabel(dst, pcLabel/*.Join(codeBlock->contextLabel)*/);
         // ------
         vPC += OPCODE_LENGTH(op_init_lazy_reg);
          NEXT_INSTRUCTION();
@@ -9556,6 +9891,7 @@ skip_put_by_id:
         
         // IFC4BC
         if (!callFrame->r(dst).jsValue()) {
+            resolveAliasedRegLabels(callFrame, codeBlock);
             Arguments* arguments = Arguments::create(*globalData, callFrame);
             // IFC4BC - Assigning label to arguments object
             arguments->setObjectLabel(pcLabel/*.Join(codeBlock->contextLabel)*/);
@@ -9563,15 +9899,15 @@ skip_put_by_id:
             if (labelReq && !isPolicy) {
                 JSLabel argLabel = pcLabel/*.Join(codeBlock->contextLabel)*/;
                 JSLabel argULabel = pcLabel/*.Join(codeBlock->contextLabel)*/;
-                if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())) {
-                    printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+                if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))) {
+                    IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                     argLabel.setStar(true);
                 }
                 else {
                     // argLabel.setStar(false);
                 }
-                if (!noSensitiveUpgrade(callFrame->r(unmodifiedArgumentsRegister(dst)).getRegLabel())) {
-                    printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+                if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(unmodifiedArgumentsRegister(dst)))) {
+                    IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                     argULabel.setStar(true);
                 }
                 else {
@@ -9579,8 +9915,8 @@ skip_put_by_id:
                 }
                 callFrame->uncheckedR(dst) = JSValue(arguments);
                 callFrame->uncheckedR(unmodifiedArgumentsRegister(dst)) = JSValue(arguments);
-                callFrame->r(dst).setRegLabel(argLabel);
-                callFrame->r(unmodifiedArgumentsRegister(dst)).setRegLabel(argULabel);
+                callFrame->setRegLabel(dst, argLabel);
+                callFrame->setRegLabel(unmodifiedArgumentsRegister(dst), argULabel);
             }
             else {
                 callFrame->uncheckedR(dst) = JSValue(arguments);
@@ -9679,15 +10015,15 @@ skip_put_by_id:
             // if ((pcLabel != funcLabel || !(JSLabelMap::labelMap().isOrdered(pcLabel.Val(), funcLabel.Val()))) && !labelReq)
             if ((pcLabel != funcLabel) && !labelReq)
             {
-                labelReq = true;
+                REQUIRE_LABELS();
                 labelRegisters(callFrame, codeBlock, pcLabel);
             }
             if (labelReq && !isPolicy) {
                 if (funcLabel.Star())
                 {
-                    printf("Function object contains a star in call\n");
+                    IFC_TRACE(StarredCall, codeBlock, vPC - iBegin, funcLabel.Val(), pcLabel.Val());
                 }
-                funcLabel = funcLabel.Join(callFrame->r(func).getRegLabel());
+                funcLabel = funcLabel.Join(callFrame->regLabel(func));
                 OP_CALLBRANCH(funcLabel, (existsHandler || pcstack.excHandler()), existsHandler);
             }
             else {
@@ -9696,8 +10032,8 @@ skip_put_by_id:
             
             pcLabel = pcstack.Head();
             pcLabel.setStar(false);
-            JSLabel::pcGlobalLabel = pcLabel.getPair();
-            JSLabel::BRANCH_FLAG = pcstack.branchFlag();
+            ifcContext.pcGlobalLabel = pcLabel.getPair();
+            ifcContext.branchFlag = pcstack.branchFlag();
             // printf("Function call construct with label %lld\n", pcLabel.Val());
             // printf("Function construct %p from %p at %ld with label %lld\n", newCodeBlock,
                    // codeBlock, vPC - iBegin, pcLabel.Val());
@@ -9712,22 +10048,8 @@ skip_put_by_id:
                 pcstack.Join(pcstack.Head(), true);
             }
             */
-            if (pcstack.excHandler()) {
-                // SEN exists
-                if (!newCodeBlock->has_SENanalysis) {
-                    newCodeBlock->analyzerSEN.genContextTable(newCodeBlock, this, pcstack.excHandler());
-                    newCodeBlock->has_SENanalysis = true;
-                }
-                newCodeBlock->analyzer = newCodeBlock->analyzerSEN;
-            }
-            else {
-                // No exception handler
-                if (!newCodeBlock->has_analysis) {
-                    newCodeBlock->analyzerNOR.genContextTable(newCodeBlock, this, pcstack.excHandler());
-                    newCodeBlock->has_analysis = true;
-                }
-                newCodeBlock->analyzer = newCodeBlock->analyzerNOR;
-            }
+            // IFC4BC - Analysis flavor; the CFG is built on the first branch
+            newCodeBlock->selectAnalysis(pcstack.excHandler());
             // -------------------------
             
             callFrame = slideRegisterWindowForCall(newCodeBlock, registerFile, callFrame, registerOffset, argCount);
@@ -9745,12 +10067,13 @@ skip_put_by_id:
             if (labelReq) {
                 for(int i = -7, j = 1; j <= newCodeBlock->numParameters(); j++, i--)
                     if (j <= argCount)
-                        callFrame->uncheckedR(i).setRegLabel(callFrame->r(i).getRegLabel().Join(pcLabel));
+                        callFrame->setRegLabel(i, callFrame->regLabel(i).Join(pcLabel));
             }
              */
             //------
             
             codeBlock = newCodeBlock;
+            CHECK_LABELED_INSTRUCTIONS();
             *topCallFrameSlot = callFrame;
             vPC = newCodeBlock->instructions().begin();
             iBegin = newCodeBlock->instructions().begin();
@@ -9763,34 +10086,30 @@ skip_put_by_id:
         }
         
         if (constructType == ConstructTypeHost) {
-            JSLabel::pcGlobalLabel = pcLabel.getPair();
-            JSLabel::BRANCH_FLAG = pcstack.branchFlag();
+            ifcContext.pcGlobalLabel = pcLabel.getPair();
+            ifcContext.branchFlag = pcstack.branchFlag();
             ScopeChainNode* scopeChain = callFrame->scopeChain();
             CallFrame* newCallFrame = CallFrame::create(callFrame->registers() + registerOffset);
             newCallFrame->init(0, vPC + OPCODE_LENGTH(op_construct), scopeChain, callFrame, argCount, asObject(v));
             
             JSValue returnValue;
             JSLabel argumentsLabel = JSLabel();
+            ExecState* outerHostCall = ifcContext.labeledHostCall;
+            JSLabel outerHostCallPC = ifcContext.hostCallPCLabel;
+            JSLabel* outerReturnLabel = ifcContext.returnLabel;
+            JSLabel hostReturnLabel;
+            ifcContext.labeledHostCall = 0;
+            ifcContext.returnLabel = &hostReturnLabel;
             if (labelReq && !isPolicy) {
                 // IFC4BC - Passing the argument labels
-                for (int i = 0, j = -7; i < argCount; i++, j--) {
-                    if (i == 100) {
-                        printf("More than 100 arguments to native function construct\n");
-                        // ABORT_CALL();
-                        break;
-                    }
-                    
-                    if (i != 0)
-                    {
-                        JSLabel::argLabel[i] = newCallFrame->r(j).getRegLabel().Join(pcLabel).getPair();
-                    }
-                    else
-                    {
-                        JSLabel::argLabel[i] = newCallFrame->r(j).getRegLabel().getPair();
-                    }
-                     
-                    argumentsLabel = argumentsLabel.Join(newCallFrame->r(j).getRegLabel());
-                }
+                IFC_COUNT(codeBlock, LabeledHostCall);
+                IFC_COUNT_N(codeBlock, HostArgumentLabels, argCount);
+                // The callee reads them from its own registers; see
+                // ExecState::argumentLabel
+                ifcContext.labeledHostCall = newCallFrame;
+                ifcContext.hostCallPCLabel = pcLabel;
+                for (int i = 0; i < argCount; i++)
+                    argumentsLabel = argumentsLabel.Join(newCallFrame->uncheckedRegLabel(CallFrame::argumentOffsetIncludingThis(i)));
             }
             {
                 *topCallFrameSlot = newCallFrame;
@@ -9798,32 +10117,28 @@ skip_put_by_id:
                 returnValue = (constructData.native.function(newCallFrame));
                 *topCallFrameSlot = callFrame;
             }
+            ifcContext.labeledHostCall = outerHostCall;
+            ifcContext.hostCallPCLabel = outerHostCallPC;
+            ifcContext.returnLabel = outerReturnLabel;
             if (!isPolicy)
                 for (int i = -1; i >= -6; i--)
-                    newCallFrame->uncheckedR(i).setRegLabel(pcLabel);
+                    newCallFrame->setRegLabel(i, pcLabel);
             
-            if (JSLabel::ABORT_FLAG) {
-                JSLabel::ABORT_FLAG = false;
+            if (ifcContext.abortFlag) {
+                ifcContext.abortFlag = false;
                 ABORT_TRANSACTION();
             }
             
             // Join the return value with the pc in which it was performed
             returnValue.setValueLabel(returnValue.joinValueLabel(pcLabel/*.Join(codeBlock->contextLabel)*/.Join(argumentsLabel)));
-            returnValue.setValueLabel(returnValue.joinValueLabel(JSLabel::returnLabel));
-            JSLabel::returnLabel = JSLabel().getPair();
+            returnValue.setValueLabel(returnValue.joinValueLabel(hostReturnLabel));
             if (returnValue.getValueLabel().Val() != pcLabel.Val() && !labelReq)
             {
-                labelReq = true;
+                REQUIRE_LABELS();
                 labelRegisters(callFrame, codeBlock, pcLabel);
             }
-            // Reset the argLabel to 0.
-            
-            for (int i = 0; i < argCount; i++) {
-                JSLabel::argLabel[i] = JSLabel().getPair();
-            }
-            
-            JSLabel::pcGlobalLabel = pcLabel.getPair();
-            JSLabel::BRANCH_FLAG = pcstack.branchFlag();
+            ifcContext.pcGlobalLabel = pcLabel.getPair();
+            ifcContext.branchFlag = pcstack.branchFlag();
             
             CHECK_FOR_EXCEPTION(returnValue.getValueLabel());
             functionReturnValue = returnValue;
@@ -9855,16 +10170,16 @@ skip_put_by_id:
             int i = src;
             int total = src + count;
             while (i < total){
-                dstLabel = dstLabel.Join(callFrame->r(i++).getRegLabel());
+                dstLabel = dstLabel.Join(callFrame->regLabel(i++));
             }
             // IFC4BC -- DNSU check
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
             callFrame->uncheckedR(dst) = concatenateStrings(callFrame, &callFrame->registers()[src], count);
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
             CHECK_FOR_EXCEPTION(dstLabel);
         }
         else {
@@ -9879,14 +10194,14 @@ skip_put_by_id:
         int dst = vPC[1].u.operand;
         int src = vPC[2].u.operand;
         if (labelReq && !isPolicy) {
-            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(src).getRegLabel());
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel())){
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+            JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(src));
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst))){
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
             callFrame->uncheckedR(dst) = callFrame->r(src).jsValue().toPrimitive(callFrame);
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+            callFrame->setRegLabel(dst, dstLabel);
         }
         else {
             callFrame->uncheckedR(dst) = callFrame->r(src).jsValue().toPrimitive(callFrame);            
@@ -9906,10 +10221,10 @@ skip_put_by_id:
         JSValue v = callFrame->r(scope).jsValue();
         JSObject* o = v.toObject(callFrame);
         
-        o->setObjectLabel(pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(scope).getRegLabel()));
-        o->structure()->setProtoLabel(pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(scope).getRegLabel()));
+        o->setObjectLabel(pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(scope)));
+        o->structure()->setProtoLabel(pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(scope)));
         
-        CHECK_FOR_EXCEPTION(pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->r(scope).getRegLabel()));
+        CHECK_FOR_EXCEPTION(pcLabel/*.Join(codeBlock->contextLabel)*/.Join(callFrame->regLabel(scope)));
         
         callFrame->uncheckedR(scope) = JSValue(o);
         
@@ -9918,7 +10233,7 @@ skip_put_by_id:
             scopeLabel.setStar(true);
         }
         if (!pcLabel.NSU(callFrame->scopeChain()->scopeNextLabel)) {
-            printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->scopeChain()->scopeNextLabel.Val(), pcLabel.Val());
+            IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->scopeChain()->scopeNextLabel.Val(), pcLabel.Val());
             scopeLabel.setStar(true);
         }
         else {
@@ -9979,24 +10294,24 @@ skip_put_by_id:
             JSLabel dstLabel = pcLabel/*.Join(codeBlock->contextLabel)*/;
             JSLabel iLabel = pcLabel/*.Join(codeBlock->contextLabel)*/;
             JSLabel sLabel = pcLabel/*.Join(codeBlock->contextLabel)*/;
-            if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
             {
 
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                 dstLabel.setStar(true);
             }
             
-            if (!noSensitiveUpgrade(callFrame->r(i).getRegLabel()))
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(i)))
             {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(i).getRegLabel().Val(), pcLabel.Val());
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(i).Val(), pcLabel.Val());
                 iLabel.setStar(true);
             }
             else {
                 // iLabel.setStar(false);
             }
-            if (!noSensitiveUpgrade(callFrame->r(size).getRegLabel()))
+            if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(size)))
             {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(size).getRegLabel().Val(), pcLabel.Val());
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(size).Val(), pcLabel.Val());
                 sLabel.setStar(true);
             }
             else {
@@ -10006,9 +10321,9 @@ skip_put_by_id:
             callFrame->uncheckedR(base) = JSValue(o);
             callFrame->uncheckedR(i) = Register::withInt(0);
             callFrame->uncheckedR(size) = Register::withInt(jsPropertyNameIterator->size());
-            callFrame->uncheckedR(dst).setRegLabel(dstLabel);
-            callFrame->uncheckedR(i).setRegLabel(iLabel);
-            callFrame->uncheckedR(size).setRegLabel(sLabel);
+            callFrame->setRegLabel(dst, dstLabel);
+            callFrame->setRegLabel(i, iLabel);
+            callFrame->setRegLabel(size, sLabel);
         }
         else {
             callFrame->uncheckedR(dst) = jsPropertyNameIterator;
@@ -10048,20 +10363,20 @@ skip_put_by_id:
             pcstack.Join(context, true); // Add the label to the context. Ideally, to be done in get_pnames
             pcLabel = pcstack.Head();
             pcLabel.setStar(false);
-            JSLabel::pcGlobalLabel = pcLabel.getPair();
-            JSLabel::BRANCH_FLAG = pcstack.branchFlag();
+            ifcContext.pcGlobalLabel = pcLabel.getPair();
+            ifcContext.branchFlag = pcstack.branchFlag();
             if (labelReq && !isPolicy) {
                 JSLabel iLabel = context;
-                if (!noSensitiveUpgrade(callFrame->r(i).getRegLabel()))
+                if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(i)))
                 {
-                    printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(i).getRegLabel().Val(), pcLabel.Val());
+                    IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(i).Val(), pcLabel.Val());
                     iLabel.setStar(true);
                 }
                 else {
                     // iLabel.setStar(false);
                 }
                 callFrame->uncheckedR(i) = Register::withInt(callFrame->r(i).i() + 1);
-                callFrame->uncheckedR(i).setRegLabel(iLabel);
+                callFrame->setRegLabel(i, iLabel);
             }
             else {
                 callFrame->uncheckedR(i) = Register::withInt(callFrame->r(i).i() + 1);                
@@ -10073,20 +10388,20 @@ skip_put_by_id:
                 pcstack.Join(context, true); // Add the label to the context. Ideally, to be done in get_pnames
                 pcLabel = pcstack.Head();
                 pcLabel.setStar(false);
-                JSLabel::pcGlobalLabel = pcLabel.getPair();
-                JSLabel::BRANCH_FLAG = pcstack.branchFlag();
+                ifcContext.pcGlobalLabel = pcLabel.getPair();
+                ifcContext.branchFlag = pcstack.branchFlag();
                 if (labelReq && !isPolicy) {
                     JSLabel dstLabel = context;
-                    if (!noSensitiveUpgrade(callFrame->r(dst).getRegLabel()))
+                    if (!noSensitiveUpgrade(codeBlock, callFrame->regLabel(dst)))
                     {
-                        printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->r(dst).getRegLabel().Val(), pcLabel.Val());
+                        IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->regLabel(dst).Val(), pcLabel.Val());
                         dstLabel.setStar(true);
                     }
                     else {
                         // dstLabel.setStar(false);
                     }
                     callFrame->uncheckedR(dst) = key;
-                    callFrame->uncheckedR(dst).setRegLabel(dstLabel);
+                    callFrame->setRegLabel(dst, dstLabel);
                 }
                 else {
                     callFrame->uncheckedR(dst) = key;
@@ -10138,7 +10453,7 @@ skip_put_by_id:
             scopeLabel.setStar(true);
         }
         if (!pcLabel.NSU(callFrame->scopeChain()->scopeNextLabel)) {
-            printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->scopeChain()->scopeNextLabel.Val(), pcLabel.Val());
+            IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->scopeChain()->scopeNextLabel.Val(), pcLabel.Val());
             scopeLabel.setStar(true);
         }
         else {
@@ -10169,16 +10484,16 @@ skip_new_scope:
         // IFC4BC - NSU check for writing the exc value to the reg
         if (labelReq && !isPolicy) {
             JSLabel exLabel = pcLabel/*.Join(codeBlock->contextLabel)*/.Join(exceptionValue.getValueLabel());
-            if (!noSensitiveUpgrade(callFrame->uncheckedR(ex).getRegLabel()))
+            if (!noSensitiveUpgrade(codeBlock, callFrame->uncheckedRegLabel(ex)))
             {
-                printf("Sensitive Upgrade at %ld in %p from label %lld to %lld\n", vPC - iBegin, codeBlock, callFrame->uncheckedR(ex).getRegLabel().Val(), pcLabel.Val());
+                IFC_TRACE(SensitiveUpgrade, codeBlock, vPC - iBegin, callFrame->uncheckedRegLabel(ex).Val(), pcLabel.Val());
                 exLabel.setStar(true);
             }
             else {
                 // exLabel.setStar(false);
             }
             callFrame->uncheckedR(ex) = exceptionValue;
-            callFrame->uncheckedR(ex).setRegLabel(exLabel);
+            callFrame->setRegLabel(ex, exLabel);
         }
         else {
             callFrame->uncheckedR(ex) = exceptionValue;            
@@ -10206,20 +10521,21 @@ skip_new_scope:
         handler = throwException(callFrame, exceptionValue, vPC - iBegin);
         if (!handler){
             // Abhi -- removing all entries from programcounter as an unhandled exception has occurred.
-            while (pcSLen > 0) {
-                pcstack.Pop();
+            if (pcSLen > 0) {
+                pcstack.Clear();
                 pcIPD = pcstack.Loc();
                 pcSLen = pcstack.Len();
                 pcReg = pcstack.Reg();
                 pcLabel = pcstack.Head();
                 pcLabel.setStar(false);
-                JSLabel::pcGlobalLabel = pcLabel.getPair();
-                JSLabel::BRANCH_FLAG = pcstack.branchFlag();
+                ifcContext.pcGlobalLabel = pcLabel.getPair();
+                ifcContext.branchFlag = pcstack.branchFlag();
             }
             return throwError(callFrame, exceptionValue);
         }
         
         codeBlock = callFrame->codeBlock();
+        CHECK_LABELED_INSTRUCTIONS();
         iBegin = codeBlock->instructions().begin();
         vPC = iBegin + handler->target;
         
@@ -10236,8 +10552,8 @@ skip_new_scope:
             pcstack.Join(exceptionValue.getValueLabel());
             pcLabel = pcstack.Head();
             pcLabel.setStar(false);
-            JSLabel::pcGlobalLabel = pcLabel.getPair();
-            JSLabel::BRANCH_FLAG = pcstack.branchFlag();
+            ifcContext.pcGlobalLabel = pcLabel.getPair();
+            ifcContext.branchFlag = pcstack.branchFlag();
         }
         // Check this! This might not be right.
         else { // Do not remove the curly braces
@@ -10248,8 +10564,8 @@ skip_new_scope:
         pcSLen = pcstack.Len();
         pcReg = pcstack.Reg();
         pcLabel.setStar(false);
-        JSLabel::pcGlobalLabel = pcLabel.getPair();
-        JSLabel::BRANCH_FLAG = pcstack.branchFlag();
+        ifcContext.pcGlobalLabel = pcLabel.getPair();
+        ifcContext.branchFlag = pcstack.branchFlag();
         // IFC4BC ------------------------------------------------
         
          NEXT_INSTRUCTION();
@@ -10274,9 +10590,9 @@ skip_new_scope:
         
         int result = vPC[1].u.operand;
         JSValue res = callFrame->r(result).jsValue();
-        res.setValueLabel(callFrame->r(result).getRegLabel());
-        JSLabel::pcGlobalLabel = JSLabel().getPair(); // Reset the pcGlobalLabel
-        JSLabel::BRANCH_FLAG = false;
+        res.setValueLabel(callFrame->regLabel(result));
+        ifcContext.pcGlobalLabel = JSLabel().getPair(); // Reset the pcGlobalLabel
+        ifcContext.branchFlag = false;
         return res;
     }
     DEFINE_OPCODE(op_put_getter_setter) {
@@ -10370,6 +10686,21 @@ skip_new_scope:
         vPC += OPCODE_LENGTH(op_profile_did_call);
          NEXT_INSTRUCTION();
     }
+#if ENABLE(COMPUTED_GOTO_CLASSIC_INTERPRETER)
+    // IFC4BC - An instruction at an armed IPD dispatches to its opcode's
+    // trap, which pops the context waiting for this IPD in this frame, if
+    // it is on top, and goes on to the handler the instruction stands for.
+#define DEFINE_IPD_MERGE_TRAP(id, length) \
+    id##_ipd_merge: \
+        ipdMergeOpcode = id; \
+        goto op_ipd_merge;
+    FOR_EACH_OPCODE_ID(DEFINE_IPD_MERGE_TRAP)
+#undef DEFINE_IPD_MERGE_TRAP
+op_ipd_merge: {
+    OP_MERGE();
+    goto *m_labeledOpcodeTable[ipdMergeOpcode];
+}
+#endif
 vm_throw: {
     globalData->exception = JSValue();
     // IFC4BC
@@ -10388,15 +10719,15 @@ vm_throw: {
     handler = throwException(callFrame, exceptionValue, vPC - iBegin);
     if (!handler) {
         // Abhi -- removing all entries from programcounter as an unhandled exception has occurred.
-            while (pcSLen > 0) {
-                pcstack.Pop();
+            if (pcSLen > 0) {
+                pcstack.Clear();
                 pcIPD = pcstack.Loc();
                 pcSLen = pcstack.Len();
                 pcReg = pcstack.Reg();
                 pcLabel = pcstack.Head();
                 pcLabel.setStar(false);
-                JSLabel::pcGlobalLabel = pcLabel.getPair();
-                JSLabel::BRANCH_FLAG = pcstack.branchFlag();
+                ifcContext.pcGlobalLabel = pcLabel.getPair();
+                ifcContext.branchFlag = pcstack.branchFlag();
 #if LDEBUG
                 printf("Popping as no handler found\n");
 #endif
@@ -10409,6 +10740,7 @@ vm_throw: {
     }
     
     codeBlock = callFrame->codeBlock();
+    CHECK_LABELED_INSTRUCTIONS();
     iBegin = codeBlock->instructions().begin();
     vPC = iBegin + handler->target;
     
@@ -10429,8 +10761,8 @@ vm_throw: {
         pcstack.Join(exceptionValue.getValueLabel());
         pcLabel = pcstack.Head();
         pcLabel.setStar(false);
-        JSLabel::pcGlobalLabel = pcLabel.getPair();
-        JSLabel::BRANCH_FLAG = pcstack.branchFlag();
+        ifcContext.pcGlobalLabel = pcLabel.getPair();
+        ifcContext.branchFlag = pcstack.branchFlag();
     }
     else {  // Please do not remove the curly brackets.
         // This case if for sanity check. Must not occur!!!
@@ -10441,8 +10773,8 @@ vm_throw: {
     pcSLen = pcstack.Len();
     pcReg = pcstack.Reg();
     pcLabel.setStar(false);
-    JSLabel::pcGlobalLabel = pcLabel.getPair();
-    JSLabel::BRANCH_FLAG = pcstack.branchFlag();
+    ifcContext.pcGlobalLabel = pcLabel.getPair();
+    ifcContext.branchFlag = pcstack.branchFlag();
     // IFC4BC ------------------------------------------------------------
      NEXT_INSTRUCTION();
 }
@@ -10566,6 +10898,13 @@ void Interpreter::dumpSampleData(ExecState* exec)
 #else
     UNUSED_PARAM(exec);
 #endif
+#if ENABLE(IFC_STATS)
+    if (IFCStats::isEnabled()) {
+        String ifcStats = IFCStats::dump();
+        if (!ifcStats.isEmpty())
+            dataLog("\n%s", ifcStats.utf8().data());
+    }
+#endif
 }
 void Interpreter::startSampling()
 {
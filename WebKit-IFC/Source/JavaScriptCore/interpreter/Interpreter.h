@@ -45,9 +45,10 @@
 #include <wtf/Vector.h>
 
 // IFC4BC	---------------------------- //
+#include "IFCStats.h"
 #include "ProgramCounter.h"
 #include "URLMap.h"
-// #include "JSLabelMap.h"
+#include "JSLabelMap.h"
 // #include "BufferMap.h"
 // #include "KnowKey.h"
 // ------------------------------------- //
@@ -259,6 +260,9 @@ namespace JSC {
         void dumpSampleData(ExecState* exec);
         void startSampling();
         void stopSampling();
+
+        // IFC4BC - For tests of the wraparound; only moves the epoch forward
+        void advanceLabelEpoch(uint32_t epoch) { m_labelEpoch = std::max(m_labelEpoch, epoch); }
         
         // Knowledge map
         // typedef HashMap<int, Vector<KnowKey> > KnowRegMap;
@@ -296,19 +300,52 @@ namespace JSC {
                 return false;
             }
             /*
-            if (JSLabelMap::labelMap().isOrdered(label.Val(), pcstack.Head().Val())) {
-                return true; // Allowed check as label is higher in the lattice than current pc
-            }
             else if (label.Star()) {
                 return false;   // Check if the label already contains a star
             }*/
-            else {              // Check if the label is lower than the pc
-                return (label >= pcstack.Head() ? true : false);
+            else if (label >= pcstack.Head()) { // Check if the label is lower than the pc
+                return true;
             }
+            // Allowed if the policy declared the label above the pc
+            return JSLabelMap::labelMap().isOrdered(label.Val(), pcstack.Head().Val());
             //return (label >= pcstack.Head()) ? true : false;
         }
+        inline bool noSensitiveUpgrade(CodeBlock* codeBlock, JSLabel label) {
+            bool allowed = noSensitiveUpgrade(label);
+            IFC_COUNT(codeBlock, NSUCheck);
+            if (!allowed)
+                IFC_COUNT(codeBlock, NSUFailure);
+            return allowed;
+        }
+        // Gives every register of the frame the label, except those written
+        // later; keeps the labels of dst and dst2 when given
         void labelRegisters(CallFrame*, CodeBlock*, JSLabel);
-        void labelRegistersMinusDst(CallFrame*, CodeBlock*, JSLabel, int);
+        void labelRegistersMinusDst(CallFrame*, CodeBlock*, JSLabel, int dst);
+        void labelRegistersMinusDst(CallFrame*, CodeBlock*, JSLabel, int dst, int dst2);
+        // Restarts the label epochs after m_labelEpoch wraps
+        void resetLabelEpochs(CallFrame*);
+        // Writes the registers an activation or arguments object of the
+        // frame can reach with the labels the frame reads them with
+        void resolveAliasedRegLabels(CallFrame*, CodeBlock*);
+        // True if the instruction at position may skip its labels: the
+        // static analysis marked it label-free and the registers it writes
+        // carry the pc label, and those it reads the pc label or bottom.
+        // A register whose label the plain handler copies, as op_mov copies
+        // its source's, must be passed as written: a bottom label copied
+        // under a raised pc would leak. Pass a register twice where there
+        // are fewer.
+        bool isLabelFree(CodeBlock*, int position, CallFrame*, JSLabel pcLabel, int written1, int written2, int read1, int read2);
+        
+        // IPD of the branch at position, analysing the CodeBlock on first use
+        int immediatePostDominator(CodeBlock*, int position);
+        void prepareAnalysis(CodeBlock*);
+        // Switches the CodeBlock's FOR_EACH_LABELED_OPCODE_ID instructions to
+        // the handlers that track labels
+        void quickenLabeled(CodeBlock*);
+        // Makes the instruction at ipd pop the pc context waiting for it
+        void armIPDMerge(CodeBlock*, int ipd);
+        // For the inline caches; keeps an armed IPD trap armed
+        void setOpcode(Instruction*, OpcodeID);
         
         // IFC4BC -------------------------------
 
@@ -360,6 +397,7 @@ namespace JSC {
         int m_reentryDepth;
 
         RegisterFile m_registerFile;
+        uint32_t m_labelEpoch; // IFC4BC - Of the latest labelRegisters; see ExecState::regLabel
         
 #if ENABLE(LLINT)
         Opcode* m_opcodeTable; // Maps OpcodeID => Opcode for compiling
@@ -367,6 +405,8 @@ namespace JSC {
 #elif ENABLE(COMPUTED_GOTO_CLASSIC_INTERPRETER)
         Opcode m_opcodeTable[numOpcodeIDs]; // Maps OpcodeID => Opcode for compiling
         HashMap<Opcode, OpcodeID> m_opcodeIDTable; // Maps Opcode => OpcodeID for decompiling
+        Opcode m_labeledOpcodeTable[numOpcodeIDs]; // IFC4BC - Maps OpcodeID => Opcode in quickened CodeBlocks; the plain handler for opcodes that are not quickened
+        Opcode m_ipdMergeOpcodeTable[numOpcodeIDs]; // IFC4BC - Maps OpcodeID => Opcode at an armed IPD
 #endif
 
 #if !ASSERT_DISABLED
@@ -66,6 +66,9 @@ namespace JSC {
         // IFC4BC - Making getter setter function for the label
         void setRegLabel(JSLabel);
         JSLabel getRegLabel() const;
+        // The label with the epoch it was written in; see ExecState::regLabel
+        void setRegLabel(JSLabel, uint32_t epoch);
+        uint32_t getRegLabelEpoch() const;
         
         
         int32_t i() const;
@@ -105,6 +108,9 @@ namespace JSC {
         
         // IFC4BC -- This is the label for the value stored in the register
         JSLabel regLabel;
+        // The label epoch of the frame when regLabel was written. Fills what
+        // was padding, so Register stays the size of WriteBarrier<Unknown>.
+        uint32_t regLabelEpoch;
         // IFC4BC ---------------------------------------------------------
     };
 
@@ -174,6 +180,17 @@ namespace JSC {
         return regLabel;
     }
 
+    ALWAYS_INLINE void Register::setRegLabel(JSLabel l, uint32_t epoch)
+    {
+        regLabel = l;
+        regLabelEpoch = epoch;
+    }
+
+    ALWAYS_INLINE uint32_t Register::getRegLabelEpoch() const
+    {
+        return regLabelEpoch;
+    }
+
     ALWAYS_INLINE EncodedJSValue Register::encodedJSValue() const
     {
         return u.value;
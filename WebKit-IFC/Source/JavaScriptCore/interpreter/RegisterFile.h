@@ -69,6 +69,8 @@ namespace JSC {
         Register* begin() const { return static_cast<Register*>(m_reservation.base()); }
         Register* end() const { return m_end; }
         size_t size() const { return end() - begin(); }
+        // IFC4BC - End of the committed registers, in use or not
+        Register* commitEnd() const { return m_commitEnd; }
 
         bool grow(Register*);
         void shrink(Register*);
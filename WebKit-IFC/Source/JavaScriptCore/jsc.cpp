@@ -26,6 +26,8 @@
 #include "Completion.h"
 #include <wtf/CurrentTime.h>
 #include "ExceptionHelpers.h"
+#include "IFCContext.h"
+#include "IFCStats.h"
 #include "InitializeThreading.h"
 #include "Interpreter.h"
 #include "JSArray.h"
@@ -102,6 +104,16 @@ static JSValue JSC_HOST_CALL functionSetSamplingFlags(ExecState*);
 static JSValue JSC_HOST_CALL functionClearSamplingFlags(ExecState*);
 #endif
 
+static JSValue JSC_HOST_CALL functionIFCLabel(ExecState*);
+static JSValue JSC_HOST_CALL functionIFCLabelOf(ExecState*);
+static JSValue JSC_HOST_CALL functionIFCAdvanceLabelEpoch(ExecState*);
+
+#if ENABLE(IFC_STATS)
+static JSValue JSC_HOST_CALL functionIFCStats(ExecState*);
+static JSValue JSC_HOST_CALL functionResetIFCStats(ExecState*);
+static JSValue JSC_HOST_CALL functionIFCCounter(ExecState*);
+#endif
+
 struct Script {
     bool isFile;
     char* argument;
@@ -203,6 +215,14 @@ protected:
         addFunction(globalData, "setSamplingFlags", functionSetSamplingFlags, 1);
         addFunction(globalData, "clearSamplingFlags", functionClearSamplingFlags, 1);
 #endif
+        addFunction(globalData, "ifcLabel", functionIFCLabel, 2);
+        addFunction(globalData, "ifcLabelOf", functionIFCLabelOf, 1);
+        addFunction(globalData, "ifcAdvanceLabelEpoch", functionIFCAdvanceLabelEpoch, 1);
+#if ENABLE(IFC_STATS)
+        addFunction(globalData, "ifcStats", functionIFCStats, 0);
+        addFunction(globalData, "resetIFCStats", functionResetIFCStats, 0);
+        addFunction(globalData, "ifcCounter", functionIFCCounter, 1);
+#endif
         
         addConstructableFunction(globalData, "Uint8Array", constructJSUint8Array, 1);
         addConstructableFunction(globalData, "Uint8ClampedArray", constructJSUint8ClampedArray, 1);
@@ -404,6 +424,53 @@ JSValue JSC_HOST_CALL functionClearSamplingFlags(ExecState* exec)
 }
 #endif
 
+// IFC4BC - Hooks for LayoutTests/ifc. ifcLabel(value, bits) returns the
+// value labelled with the label bits; ifcLabelOf(value) returns the bits of
+// the label value carries, joined with the pc of the call.
+JSValue JSC_HOST_CALL functionIFCLabel(ExecState* exec)
+{
+    // The interpreter joins the result with the argument labels and the pc
+    exec->ifcContext().setReturnLabel(JSLabel(static_cast<uint64_t>(exec->argument(1).toNumber(exec))));
+    return exec->argument(0);
+}
+
+JSValue JSC_HOST_CALL functionIFCLabelOf(ExecState* exec)
+{
+    return (jsNumber(static_cast<double>(exec->argumentLabel(0).Val())));
+}
+
+// Moves the frame label epoch forward, so a test can make it wrap
+JSValue JSC_HOST_CALL functionIFCAdvanceLabelEpoch(ExecState* exec)
+{
+    exec->interpreter()->advanceLabelEpoch(exec->argument(0).toUInt32(exec));
+    return (jsUndefined());
+}
+
+#if ENABLE(IFC_STATS)
+JSValue JSC_HOST_CALL functionIFCStats(ExecState* exec)
+{
+    // Counting is off unless the shell was started with --ifcStats=true.
+    return (jsString(exec, UString(IFCStats::dump().impl())));
+}
+
+JSValue JSC_HOST_CALL functionResetIFCStats(ExecState*)
+{
+    IFCStats::reset();
+    return (jsUndefined());
+}
+
+JSValue JSC_HOST_CALL functionIFCCounter(ExecState* exec)
+{
+    CString name = exec->argument(0).toString(exec)->value(exec).utf8();
+    for (unsigned i = 0; i < IFCStats::NumberOfCounters; i++) {
+        IFCStats::Counter counter = static_cast<IFCStats::Counter>(i);
+        if (!strcmp(name.data(), IFCStats::counterName(counter)))
+            return (jsNumber(static_cast<double>(IFCStats::total(counter))));
+    }
+    return (throwError(exec, createRangeError(exec, "Unknown IFC counter")));
+}
+#endif
+
 JSValue JSC_HOST_CALL functionReadline(ExecState* exec)
 {
     Vector<char, 256> line;
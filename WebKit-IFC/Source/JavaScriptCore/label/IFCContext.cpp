@@ -0,0 +1,47 @@
+/*
+ *  IFCContext.cpp
+ *  JavaScriptCore
+ *
+ */
+
+#include "config.h"
+#include "IFCContext.h"
+
+#include "CallFrame.h"
+#include <wtf/ThreadSpecific.h>
+#include <wtf/Threading.h>
+
+namespace JSC {
+
+    IFCContext::IFCContext()
+        : labeledHostCall(0)
+        , returnLabel(0)
+        , abortFlag(false)
+        , branchFlag(false)
+    {
+        pcGlobalLabel.clabel = 0;
+        eventNodeLabel.clabel = 0;
+        eventContextLabel.clabel = 0;
+        valueLabel.clabel = 0;
+    }
+
+    JSLabel IFCContext::thisLabel() const
+    {
+        return labeledHostCall ? labeledHostCall->thisLabel() : JSLabel();
+    }
+
+    JSLabel IFCContext::argumentLabel(size_t argument) const
+    {
+        return labeledHostCall ? labeledHostCall->argumentLabel(argument) : JSLabel();
+    }
+
+    IFCContext& IFCContext::threadDefault()
+    {
+        AtomicallyInitializedStatic(WTF::ThreadSpecific<IFCContext>&, defaultContexts = *new WTF::ThreadSpecific<IFCContext>);
+        IFCContext* context = defaultContexts;
+        if (!wtfThreadData().currentIFCContext())
+            wtfThreadData().setCurrentIFCContext(context);
+        return *context;
+    }
+
+}
@@ -0,0 +1,94 @@
+/*
+ *  IFCContext.h
+ *  JavaScriptCore
+ *
+ *  The label state the interpreter shares with the runtime and WebCore
+ *  while it runs code: the pc, the host call whose argument labels can be
+ *  read and where it leaves the label of its result, the event labels,
+ *  and the abort and branch flags. Each JSGlobalData has one (JSGlobalData::ifcContext),
+ *  so VMs on different threads, such as workers, never share it.
+ *
+ *  Code that has no ExecState gets the context of the VM running on its
+ *  thread from IFCContext::current(). Like the identifier table, a
+ *  thread's default VMs share the thread's own context, and the API
+ *  shims switch to a context group's while it runs. A thread that has not
+ *  entered a VM yet gets its own context too, so labels WebCore sets
+ *  before the first script runs are the ones that script sees.
+ *
+ */
+
+#ifndef IFCContext_h
+#define IFCContext_h
+
+#include "JSExportMacros.h"
+#include "JSLabel.h"
+#include <wtf/FastAllocBase.h>
+#include <wtf/Noncopyable.h>
+#include <wtf/WTFThreadData.h>
+
+namespace JSC {
+
+    class ExecState;
+
+    class IFCContext {
+        WTF_MAKE_NONCOPYABLE(IFCContext);
+        WTF_MAKE_FAST_ALLOCATED;
+    public:
+        IFCContext();
+
+        // The context of the VM running on this thread
+        static IFCContext& current()
+        {
+            if (IFCContext* context = wtfThreadData().currentIFCContext())
+                return *context;
+            return threadDefault();
+        }
+
+        // The context of this thread's default VMs
+        JS_EXPORT_PRIVATE static IFCContext& threadDefault();
+
+        JSLabel::pair pcGlobalLabel;      // the pc of the running code
+        JSLabel::pair eventNodeLabel;     // the node an event is dispatched to
+        JSLabel::pair eventContextLabel;  // the context set for an event handler
+        JSLabel::pair valueLabel;         // the value a put_by_id passes to a setter
+
+        // The labels of the running host call's arguments, or bottom when it
+        // was made without labels; see ExecState::argumentLabel
+        JS_EXPORT_PRIVATE JSLabel thisLabel() const;
+        JS_EXPORT_PRIVATE JSLabel argumentLabel(size_t argument) const;
+
+        // A host function sets the label of its result here
+        void setReturnLabel(JSLabel label)
+        {
+            if (returnLabel)
+                *returnLabel = label;
+        }
+
+        ExecState* labeledHostCall;       // the host call made with labels, or 0
+        JSLabel hostCallPCLabel;          // the pc labeledHostCall was made under
+        JSLabel* returnLabel;             // the running host call's, or 0
+
+        bool abortFlag;                   // a native function found a violation
+        bool branchFlag;                  // the pc was raised by a branch; see JSLabel::NSU
+    };
+
+    // this is the context and l is the label of the value being changed.
+    // returns true for valid upgrades
+    // false for sensitive upgrades
+    // if vo < pc terminate - > don't dynamically upgrade
+    inline bool JSLabel::NSU(JSLabel l) {
+        if (IFCContext::current().branchFlag == false)
+            return true;
+        JSLabelTable& table = JSLabelTable::labelTable();
+        if (table.isPolicy(m_id)) // PC is policy
+            return true;
+        if (table.isPolicy(l.m_id)) // Modifying policy value even though PC is not policy
+            return false;
+        // IFC4BC - For global objects like window, we allow if it has a label 0.
+        return table.leq(m_id, l.m_id);
+        // TODO - add code for star
+    }
+
+}
+
+#endif // IFCContext_h
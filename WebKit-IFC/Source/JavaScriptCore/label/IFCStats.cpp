@@ -0,0 +1,273 @@
+/*
+ *  IFCStats.cpp
+ *  JavaScriptCore
+ *
+ */
+
+#include "config.h"
+#include "IFCStats.h"
+
+#include "CodeBlock.h"
+#include "Executable.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wtf/HashMap.h>
+#include <wtf/Threading.h>
+#include <wtf/Vector.h>
+#include <wtf/text/CString.h>
+#include <wtf/text/StringBuilder.h>
+#include <wtf/text/StringHash.h>
+
+namespace JSC {
+
+    static const char* const counterNames[IFCStats::NumberOfCounters] = {
+        "push", "join", "pop", "nsu", "nsuFail", "labelReg", "regs", "getIFC", "putIFC", "hostCall", "hostArg", "lblFree", "lfMiss"
+    };
+
+    // Cost is a rough count of label operations: events that are
+    // summarized by a finer counter (failures, sweeps, calls) weigh 0, as
+    // do label-free instructions, which skip the label operations.
+    static const unsigned costWeights[IFCStats::NumberOfCounters] = {
+        1, 1, 1, 1, 0, 0, 1, 1, 1, 0, 1, 0, 0
+    };
+
+    const char* IFCStats::counterName(Counter counter)
+    {
+        return counterNames[counter];
+    }
+
+    uint64_t IFCStats::cost(const Entry& entry)
+    {
+        uint64_t cost = 0;
+        for (unsigned i = 0; i < NumberOfCounters; i++)
+            cost += costWeights[i] * entry.counts[i];
+        return cost;
+    }
+
+#if ENABLE(IFC_STATS)
+
+    namespace {
+
+        struct Site {
+            String url;
+            String description;
+            IFCStats::Entry entry;
+
+            uint64_t cost() const { return IFCStats::cost(entry); }
+        };
+
+        struct ScriptCost {
+            String url;
+            uint64_t cost;
+            unsigned sites;
+        };
+
+        String describe(CodeBlock* codeBlock)
+        {
+            StringBuilder builder;
+            switch (codeBlock->codeType()) {
+            case GlobalCode:
+                builder.append("<global>");
+                break;
+            case EvalCode:
+                builder.append("<eval>");
+                break;
+            case FunctionCode: {
+                FunctionExecutable* executable = jsCast<FunctionExecutable*>(codeBlock->ownerExecutable());
+                const Identifier& name = executable->name().isEmpty() ? executable->inferredName() : executable->name();
+                if (name.isEmpty())
+                    builder.append("<anonymous>");
+                else
+                    builder.append(String(name.ustring().impl()));
+                break;
+            }
+            }
+            return builder.toString();
+        }
+
+        class SiteRegistry {
+        public:
+            // Sites are never freed; CodeBlocks keep pointers to their entry.
+            IFCStats::Entry* entryFor(CodeBlock* codeBlock)
+            {
+                ScriptExecutable* executable = codeBlock->ownerExecutable();
+                String url(executable->sourceURL().impl());
+                String description = describe(codeBlock);
+
+                StringBuilder key;
+                key.append(url);
+                key.append(':');
+                key.append(String::number(executable->lineNo()));
+                key.append(' ');
+                key.append(description);
+                String siteKey = key.toString();
+
+                MutexLocker locker(m_lock);
+                HashMap<String, Site*>::iterator it = m_sites.find(siteKey);
+                if (it != m_sites.end())
+                    return &it->second->entry;
+
+                Site* site = new Site;
+                site->url = url;
+                site->description = siteKey;
+                memset(&site->entry, 0, sizeof(site->entry));
+                m_sites.add(siteKey, site);
+                m_order.append(site);
+                return &site->entry;
+            }
+
+            void reset()
+            {
+                MutexLocker locker(m_lock);
+                for (size_t i = 0; i < m_order.size(); i++)
+                    memset(&m_order[i]->entry, 0, sizeof(m_order[i]->entry));
+            }
+
+            void snapshot(Vector<Site*>& sites)
+            {
+                MutexLocker locker(m_lock);
+                sites = m_order;
+            }
+
+        private:
+            Mutex m_lock;
+            HashMap<String, Site*> m_sites;
+            Vector<Site*> m_order;
+        };
+
+        SiteRegistry& siteRegistry()
+        {
+            AtomicallyInitializedStatic(SiteRegistry&, registry = *new SiteRegistry);
+            return registry;
+        }
+
+        int compareSites(const void* left, const void* right)
+        {
+            uint64_t leftCost = (*static_cast<Site* const*>(left))->cost();
+            uint64_t rightCost = (*static_cast<Site* const*>(right))->cost();
+            return (leftCost < rightCost) ? 1 : (leftCost > rightCost) ? -1 : 0;
+        }
+
+        int compareScripts(const void* left, const void* right)
+        {
+            uint64_t leftCost = static_cast<const ScriptCost*>(left)->cost;
+            uint64_t rightCost = static_cast<const ScriptCost*>(right)->cost;
+            return (leftCost < rightCost) ? 1 : (leftCost > rightCost) ? -1 : 0;
+        }
+
+        void appendFormat(StringBuilder& builder, const char* format, unsigned long long value)
+        {
+            char buffer[32];
+            snprintf(buffer, sizeof(buffer), format, value);
+            builder.append(buffer);
+        }
+
+    }
+
+    void IFCStats::count(CodeBlock* codeBlock, Counter counter, unsigned amount)
+    {
+        Entry* entry = codeBlock->ifcStats;
+        if (UNLIKELY(!entry)) {
+            entry = siteRegistry().entryFor(codeBlock);
+            codeBlock->ifcStats = entry;
+        }
+        entry->counts[counter] += amount;
+    }
+
+    String IFCStats::dump()
+    {
+        Vector<Site*> sites;
+        siteRegistry().snapshot(sites);
+
+        Vector<Site*> active;
+        for (size_t i = 0; i < sites.size(); i++) {
+            if (sites[i]->cost())
+                active.append(sites[i]);
+        }
+        if (active.isEmpty())
+            return String();
+        qsort(active.begin(), active.size(), sizeof(Site*), compareSites);
+
+        StringBuilder builder;
+        builder.append("IFC cost by function\n");
+        builder.append("      cost");
+        for (unsigned i = 0; i < NumberOfCounters; i++) {
+            char buffer[16];
+            snprintf(buffer, sizeof(buffer), " %9s", counterNames[i]);
+            builder.append(buffer);
+        }
+        builder.append("  site\n");
+
+        HashMap<String, size_t> scriptIndex;
+        Vector<ScriptCost> scripts;
+        for (size_t i = 0; i < active.size(); i++) {
+            Site* site = active[i];
+            uint64_t cost = site->cost();
+            appendFormat(builder, "%10llu", cost);
+            for (unsigned j = 0; j < NumberOfCounters; j++)
+                appendFormat(builder, " %9llu", site->entry.counts[j]);
+            builder.append("  ");
+            builder.append(site->description);
+            builder.append('\n');
+
+            HashMap<String, size_t>::iterator it = scriptIndex.find(site->url);
+            if (it == scriptIndex.end()) {
+                ScriptCost script = { site->url, 0, 0 };
+                scriptIndex.add(site->url, scripts.size());
+                scripts.append(script);
+                it = scriptIndex.find(site->url);
+            }
+            scripts[it->second].cost += cost;
+            scripts[it->second].sites++;
+        }
+
+        qsort(scripts.begin(), scripts.size(), sizeof(ScriptCost), compareScripts);
+        builder.append("\nIFC cost by script\n");
+        for (size_t i = 0; i < scripts.size(); i++) {
+            appendFormat(builder, "%10llu", scripts[i].cost);
+            appendFormat(builder, " %6llu  ", scripts[i].sites);
+            builder.append(scripts[i].url.isEmpty() ? String("<no url>") : scripts[i].url);
+            builder.append('\n');
+        }
+        return builder.toString();
+    }
+
+    uint64_t IFCStats::total(Counter counter)
+    {
+        Vector<Site*> sites;
+        siteRegistry().snapshot(sites);
+        uint64_t total = 0;
+        for (size_t i = 0; i < sites.size(); i++)
+            total += sites[i]->entry.counts[counter];
+        return total;
+    }
+
+    void IFCStats::reset()
+    {
+        siteRegistry().reset();
+    }
+
+#else // !ENABLE(IFC_STATS)
+
+    void IFCStats::count(CodeBlock*, Counter, unsigned)
+    {
+    }
+
+    String IFCStats::dump()
+    {
+        return String();
+    }
+
+    uint64_t IFCStats::total(Counter)
+    {
+        return 0;
+    }
+
+    void IFCStats::reset()
+    {
+    }
+
+#endif // ENABLE(IFC_STATS)
+
+}
@@ -0,0 +1,94 @@
+/*
+ *  IFCStats.h
+ *  JavaScriptCore
+ *
+ *  Per-CodeBlock counters of the work the interpreter does for IFC: pc
+ *  stack pushes, joins and pops, NSU checks, labelRegisters sweeps, getIFC
+ *  and putIFC slow paths, labelled host calls and label-free instructions
+ *  (see analysis/LabelFreeAnalysis.h). Built when
+ *  ENABLE(IFC_STATS) is set and only counted when Options::ifcStats() is
+ *  on (JSC_ifcStats=true, --ifcStats=true in jsc); otherwise each site is
+ *  a single test of a global.
+ *
+ *  Counters are kept per source position (url, first line, function), so
+ *  recompiled CodeBlocks for the same function add up. dump() lists them
+ *  sorted by cost, followed by a per-url summary. It is reachable from
+ *  jsc as ifcStats(), from layout tests as internals.ifcStats(), and is
+ *  printed with the sampling data when the sampling tool is enabled. jsc's
+ *  ifcCounter(name) returns one counter's total, for LayoutTests/ifc.
+ *
+ */
+
+#ifndef IFCStats_h
+#define IFCStats_h
+
+#include <stdint.h>
+#include <wtf/Compiler.h>
+#include <wtf/Platform.h>
+#include <wtf/text/WTFString.h>
+
+#include "JSExportMacros.h"
+#include "Options.h"
+
+namespace JSC {
+
+    class CodeBlock;
+
+    class IFCStats {
+    public:
+        // Kept in sync with the column names in IFCStats.cpp
+        enum Counter {
+            PCPush,
+            PCJoin,
+            PCPop,
+            NSUCheck,
+            NSUFailure,
+            LabelRegisters,
+            RegistersLabeled,   // registers written by labelRegisters
+            GetIFC,
+            PutIFC,
+            LabeledHostCall,
+            HostArgumentLabels, // argument labels passed to host functions
+            LabelFree,          // label-free instructions run without labels
+            LabelFreeMiss,      // ... that found a register not labelled with the pc
+            NumberOfCounters
+        };
+
+        struct Entry {
+            uint64_t counts[NumberOfCounters];
+        };
+
+        static ALWAYS_INLINE bool isEnabled()
+        {
+#if ENABLE(IFC_STATS)
+            return Options::ifcStats();
+#else
+            return false;
+#endif
+        }
+
+        JS_EXPORT_PRIVATE static void count(CodeBlock*, Counter, unsigned amount = 1);
+        JS_EXPORT_PRIVATE static const char* counterName(Counter);
+        JS_EXPORT_PRIVATE static uint64_t cost(const Entry&);
+
+        // Sorted by cost, most expensive first.
+        JS_EXPORT_PRIVATE static String dump();
+        // Summed over every site
+        JS_EXPORT_PRIVATE static uint64_t total(Counter);
+        JS_EXPORT_PRIVATE static void reset();
+    };
+
+}
+
+#if ENABLE(IFC_STATS)
+#define IFC_COUNT_N(codeBlock, counter, amount) do { \
+    if (UNLIKELY(JSC::IFCStats::isEnabled())) \
+        JSC::IFCStats::count(codeBlock, JSC::IFCStats::counter, amount); \
+} while (0)
+#else
+#define IFC_COUNT_N(codeBlock, counter, amount) do { } while (0)
+#endif
+
+#define IFC_COUNT(codeBlock, counter) IFC_COUNT_N(codeBlock, counter, 1)
+
+#endif // IFCStats_h
@@ -0,0 +1,296 @@
+/*
+ *  IFCTrace.cpp
+ *  JavaScriptCore
+ *
+ */
+
+#include "config.h"
+#include "IFCTrace.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <wtf/Atomics.h>
+#include <wtf/CurrentTime.h>
+#include <wtf/ThreadSpecific.h>
+#include <wtf/Threading.h>
+#include <wtf/Vector.h>
+
+namespace JSC {
+
+    namespace {
+
+        const unsigned ringSize = 4096; // records per thread, power of two
+        const size_t fileChunk = 1 << 20;
+        const double drainInterval = 0.05; // seconds
+        const uint32_t traceVersion = 1;
+        const uint32_t droppedKind = 0; // synthetic record, oldLabel holds the count
+
+        struct FileHeader {
+            char magic[8];
+            uint32_t version;
+            uint32_t recordSize;
+            uint64_t recordCount;
+        };
+
+        // Single producer (the owning thread), single consumer (the drain
+        // thread, or flush() under the trace lock).
+        struct Ring {
+            IFCTrace::Record records[ringSize];
+            volatile unsigned head;
+            volatile unsigned tail;
+            volatile unsigned dropped;
+            unsigned reportedDropped;
+            unsigned thread;
+        };
+
+        struct RingPointer {
+            RingPointer() : ring(0) { }
+            Ring* ring;
+        };
+
+        inline void publishFence()
+        {
+#if COMPILER(GCC) || COMPILER(CLANG)
+            asm volatile("" ::: "memory");
+#endif
+            WTF::memoryBarrierBeforeUnlock();
+        }
+
+        inline void acquireFence()
+        {
+            WTF::memoryBarrierAfterLock();
+#if COMPILER(GCC) || COMPILER(CLANG)
+            asm volatile("" ::: "memory");
+#endif
+        }
+
+        class TraceState {
+        public:
+            TraceState()
+                : m_currentRing(new WTF::ThreadSpecific<RingPointer>)
+                , m_fd(-1)
+                , m_mapping(0)
+                , m_mappedSize(0)
+                , m_failed(false)
+                , m_stopping(false)
+            {
+                m_thread = createThread(drainThreadMain, this, "JavaScriptCore::IFCTrace");
+                atexit(stopAtExit);
+            }
+
+            Ring* currentRing()
+            {
+                RingPointer& pointer = **m_currentRing;
+                if (UNLIKELY(!pointer.ring)) {
+                    Ring* ring = static_cast<Ring*>(fastZeroedMalloc(sizeof(Ring)));
+                    MutexLocker locker(m_lock);
+                    ring->thread = m_rings.size();
+                    m_rings.append(ring);
+                    pointer.ring = ring;
+                }
+                return pointer.ring;
+            }
+
+            void flush()
+            {
+                MutexLocker locker(m_lock);
+                drainLocked();
+            }
+
+            // Joins the drain thread and writes out what it had not reached
+            // yet. Records appended afterwards are dropped.
+            void stop()
+            {
+                {
+                    MutexLocker locker(m_lock);
+                    if (m_stopping)
+                        return;
+                    m_stopping = true;
+                    m_wake.signal();
+                }
+                waitForThreadCompletion(m_thread);
+
+                MutexLocker locker(m_lock);
+                drainLocked();
+                if (m_mapping) {
+                    msync(m_mapping, m_mappedSize, MS_SYNC);
+                    munmap(m_mapping, m_mappedSize);
+                    m_mapping = 0;
+                    m_mappedSize = 0;
+                }
+                if (m_fd >= 0)
+                    close(m_fd);
+                m_fd = -1;
+                m_failed = true; // never reopen (and truncate) the file
+            }
+
+        private:
+            static void drainThreadMain(void* state)
+            {
+                static_cast<TraceState*>(state)->drainLoop();
+            }
+
+            static void stopAtExit();
+
+            void drainLoop()
+            {
+                MutexLocker locker(m_lock);
+                while (!m_stopping) {
+                    m_wake.timedWait(m_lock, currentTime() + drainInterval);
+                    drainLocked();
+                }
+            }
+
+            bool ensureFile(size_t bytes)
+            {
+                if (m_failed)
+                    return false;
+                if (m_fd < 0) {
+                    const char* path = getenv("JSC_IFC_TRACE_FILE");
+                    char defaultPath[64];
+                    if (!path) {
+                        snprintf(defaultPath, sizeof(defaultPath), "/tmp/jsc-ifc-trace.%d", static_cast<int>(getpid()));
+                        path = defaultPath;
+                    }
+                    m_fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+                    if (m_fd < 0) {
+                        fprintf(stderr, "IFCTrace: cannot open %s\n", path);
+                        m_failed = true;
+                        return false;
+                    }
+                    if (!remap(fileChunk))
+                        return false;
+                    FileHeader* header = static_cast<FileHeader*>(m_mapping);
+                    memcpy(header->magic, "IFCTRACE", 8);
+                    header->version = traceVersion;
+                    header->recordSize = sizeof(IFCTrace::Record);
+                    header->recordCount = 0;
+                }
+                if (bytes <= m_mappedSize)
+                    return true;
+                size_t size = m_mappedSize;
+                while (size < bytes)
+                    size += fileChunk;
+                return remap(size);
+            }
+
+            bool remap(size_t size)
+            {
+                if (m_mapping)
+                    munmap(m_mapping, m_mappedSize);
+                m_mapping = 0;
+                m_mappedSize = 0;
+                if (ftruncate(m_fd, size)) {
+                    m_failed = true;
+                    return false;
+                }
+                void* mapping = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+                if (mapping == MAP_FAILED) {
+                    m_failed = true;
+                    return false;
+                }
+                m_mapping = mapping;
+                m_mappedSize = size;
+                return true;
+            }
+
+            void append(const IFCTrace::Record& record)
+            {
+                // A failed grow leaves no mapping to read the header from.
+                if (!ensureFile(sizeof(FileHeader)))
+                    return;
+                FileHeader* header = static_cast<FileHeader*>(m_mapping);
+                size_t offset = sizeof(FileHeader) + header->recordCount * sizeof(IFCTrace::Record);
+                if (!ensureFile(offset + sizeof(IFCTrace::Record)))
+                    return;
+                header = static_cast<FileHeader*>(m_mapping);
+                memcpy(static_cast<char*>(m_mapping) + offset, &record, sizeof(record));
+                header->recordCount++;
+            }
+
+            // NOTE: caller holds m_lock
+            void drainLocked()
+            {
+                for (size_t i = 0; i < m_rings.size(); i++) {
+                    Ring* ring = m_rings[i];
+                    unsigned head = ring->head;
+                    unsigned dropped = ring->dropped;
+                    acquireFence();
+                    unsigned tail = ring->tail;
+                    if (tail == head && dropped == ring->reportedDropped)
+                        continue;
+                    if (!ensureFile(sizeof(FileHeader)))
+                        return;
+                    for (; tail != head; tail++)
+                        append(ring->records[tail & (ringSize - 1)]);
+                    publishFence();
+                    ring->tail = tail;
+                    if (dropped != ring->reportedDropped) {
+                        IFCTrace::Record record;
+                        memset(&record, 0, sizeof(record));
+                        record.kind = droppedKind;
+                        record.thread = ring->thread;
+                        record.oldLabel = dropped - ring->reportedDropped;
+                        append(record);
+                        ring->reportedDropped = dropped;
+                    }
+                }
+                if (m_mapping)
+                    msync(m_mapping, sizeof(FileHeader), MS_ASYNC);
+            }
+
+            WTF::ThreadSpecific<RingPointer>* m_currentRing;
+            Mutex m_lock;
+            ThreadCondition m_wake;
+            Vector<Ring*> m_rings; // rings are never freed; threads may exit with records pending
+            int m_fd;
+            void* m_mapping;
+            size_t m_mappedSize;
+            bool m_failed;
+            bool m_stopping;
+            ThreadIdentifier m_thread;
+        };
+
+        TraceState& traceState()
+        {
+            AtomicallyInitializedStatic(TraceState&, state = *new TraceState);
+            return state;
+        }
+
+        // Registered by the TraceState constructor, so the state exists
+        void TraceState::stopAtExit()
+        {
+            traceState().stop();
+        }
+
+    }
+
+    void IFCTrace::record(Kind kind, const void* codeBlock, unsigned bytecodeOffset, uint64_t oldLabel, uint64_t newLabel, unsigned lineNumber) {
+        Ring* ring = traceState().currentRing();
+        unsigned head = ring->head;
+        if (head - ring->tail >= ringSize) {
+            // The drain thread is behind; count the loss rather than block.
+            ring->dropped = ring->dropped + 1;
+            return;
+        }
+        Record& record = ring->records[head & (ringSize - 1)];
+        record.kind = kind;
+        record.bytecodeOffset = bytecodeOffset;
+        record.lineNumber = lineNumber;
+        record.thread = ring->thread;
+        record.codeBlock = reinterpret_cast<uintptr_t>(codeBlock);
+        record.oldLabel = oldLabel;
+        record.newLabel = newLabel;
+        publishFence();
+        ring->head = head + 1;
+    }
+
+    void IFCTrace::flush() {
+        traceState().flush();
+    }
+
+}
@@ -0,0 +1,84 @@
+/*
+ *  IFCTrace.h
+ *  JavaScriptCore
+ *
+ *  Low-overhead binary trace of IFC events. Each thread appends fixed-size
+ *  records to its own lock-free ring buffer; a background thread drains the
+ *  rings into a memory-mapped file that Tools/Scripts/decode-ifc-trace
+ *  turns back into text. Nothing is printed on the interpreter's hot path.
+ *  At exit the drain thread is joined and the rings are written out once
+ *  more, so the last records are not lost.
+ *
+ *  How much is recorded is set by Options::ifcTraceLevel() (JSC_ifcTraceLevel
+ *  in the environment, --ifcTraceLevel=<n> in jsc):
+ *    0 - off
+ *    1 - violations and aborts (default)
+ *    2 - also sensitive upgrades
+ *  The file is JSC_IFC_TRACE_FILE, or /tmp/jsc-ifc-trace.<pid> by default.
+ *
+ */
+
+#ifndef IFCTrace_h
+#define IFCTrace_h
+
+#include <stdint.h>
+#include <wtf/Compiler.h>
+
+#include "JSExportMacros.h"
+#include "Options.h"
+
+namespace JSC {
+
+    class IFCTrace {
+    public:
+        enum Level {
+            LevelOff = 0,
+            LevelViolations = 1,
+            LevelUpgrades = 2
+        };
+
+        // Kept in sync with Tools/Scripts/decode-ifc-trace
+        enum Kind {
+            Violation = 1,           // ABORT_TRANSACTION
+            ResolveAbort = 2,        // abort while resolving a name under a high pc
+            StarredCall = 3,         // call through a function value carrying a star
+            SensitiveUpgrade = 4,    // NSU failure, the written register gets a star
+            LabelFreeMismatch = 5    // a label-free instruction met a register not labelled with the pc
+        };
+
+        struct Record {
+            uint32_t kind;
+            uint32_t bytecodeOffset;
+            uint32_t lineNumber;     // only for Violation, 0 otherwise
+            uint32_t thread;
+            uint64_t codeBlock;
+            uint64_t oldLabel;
+            uint64_t newLabel;
+        };
+
+        static ALWAYS_INLINE bool isEnabled(Kind kind)
+        {
+            return Options::ifcTraceLevel() >= levelFor(kind);
+        }
+
+        JS_EXPORT_PRIVATE static void record(Kind, const void* codeBlock, unsigned bytecodeOffset, uint64_t oldLabel, uint64_t newLabel, unsigned lineNumber = 0);
+
+        // Blocks until every record appended so far is in the file.
+        JS_EXPORT_PRIVATE static void flush();
+
+    private:
+        static ALWAYS_INLINE unsigned levelFor(Kind kind)
+        {
+            return kind == SensitiveUpgrade ? LevelUpgrades : LevelViolations;
+        }
+    };
+
+}
+
+// The label arguments are only evaluated when the event is enabled.
+#define IFC_TRACE(kind, codeBlock, bytecodeOffset, oldLabel, newLabel) do { \
+    if (UNLIKELY(JSC::IFCTrace::isEnabled(JSC::IFCTrace::kind))) \
+        JSC::IFCTrace::record(JSC::IFCTrace::kind, codeBlock, bytecodeOffset, oldLabel, newLabel); \
+} while (0)
+
+#endif // IFCTrace_h
@@ -12,15 +12,14 @@
 
 #include <stdint.h>
 #include "JSExportMacros.h"
+#include "JSLabelTable.h"
 
 namespace JSC {
 	
 	class JSLabel {
-		uint64_t label; // label's value
-        // uint64_t iLabel;
-        
-        bool star; // for deferred no-sensitive upgrade check
-                    // and property user defined. Will make it union later, if it works
+        // Interned (bits, star) lattice element; see JSLabelTable. The star is
+        // for the deferred no-sensitive upgrade check and property user defined.
+		LabelID m_id;
 	public:
         typedef struct pair{
             uint64_t clabel;
@@ -30,48 +29,47 @@ namespace JSC {
         
         // uint64_t pLabel;
         
-		JS_EXPORT_PRIVATE JSLabel();                  // constructor
-		JS_EXPORT_PRIVATE JSLabel(uint64_t);          // overload
-        JS_EXPORT_PRIVATE JSLabel(pair);          // overload
-        JS_EXPORT_PRIVATE uint64_t Val() const;       // return label value
+		JSLabel() : m_id(JSLabelTable::bottomID) { }                                                  // constructor
+		JSLabel(uint64_t l) : m_id(JSLabelTable::labelTable().internBits(l, false)) { }              // overload
+        JSLabel(pair l) : m_id(JSLabelTable::labelTable().internBits(l.clabel, false)) { }          // overload
+        static JSLabel fromID(LabelID id) { JSLabel l; l.m_id = id; return l; }
+        LabelID id() const { return m_id; }           // interned label ID
+        uint64_t Val() const { return JSLabelTable::labelTable().bits(m_id); }   // return label value
         // JS_EXPORT_PRIVATE uint64_t iVal() const;       // return label value
-        JS_EXPORT_PRIVATE pair getPair() const;       // return label value
-        JS_EXPORT_PRIVATE JSLabel Join(JSLabel);      // join labels
+        pair getPair() const { pair temp; temp.clabel = Val(); return temp; }
+        // IFC4BC - For DNSU -- the star is joined along with the lattice element
+        JSLabel Join(JSLabel l) { return fromID(JSLabelTable::labelTable().join(m_id, l.m_id)); }
         JS_EXPORT_PRIVATE void vJoin(JSLabel);        // void join
-        JS_EXPORT_PRIVATE void setVal(uint64_t);
+        void setVal(uint64_t l) { m_id = JSLabelTable::labelTable().withElement(m_id, IFCLattice::fromBits(l)); }
         // JS_EXPORT_PRIVATE void setiVal(uint64_t);
         // IFC4BC --- for DNSU
-        JS_EXPORT_PRIVATE bool Star() const;          // return the star for DNSU
-        JS_EXPORT_PRIVATE void setStar(bool);         // set the star for DNSU
+        bool Star() const { return JSLabelTable::labelTable().star(m_id); }          // return the star for DNSU
+        void setStar(bool s) { m_id = JSLabelTable::labelTable().withStar(m_id, s); } // set the star for DNSU
         // IFC4BC ------------ */
-        JS_EXPORT_PRIVATE bool operator ==(const JSLabel&);
-        JS_EXPORT_PRIVATE bool operator !=(const JSLabel&);
-        
-        JS_EXPORT_PRIVATE bool operator >(const JSLabel&);
-        JS_EXPORT_PRIVATE bool operator <(const JSLabel&);
+        // Interning makes equal (element, star) pairs share an ID
+        bool operator ==(const JSLabel& rhs) { return m_id == rhs.m_id; }
+        bool operator !=(const JSLabel& rhs) { return m_id != rhs.m_id; }
         
-        JS_EXPORT_PRIVATE bool operator >=(const JSLabel&);
-        JS_EXPORT_PRIVATE bool operator <=(const JSLabel&);
+        // Ordering compares lattice elements only; the star is ignored
+        bool operator >(const JSLabel& rhs) { return m_id != rhs.m_id && JSLabelTable::labelTable().leq(rhs.m_id, m_id); }
+        bool operator <(const JSLabel& rhs) { return m_id != rhs.m_id && JSLabelTable::labelTable().leq(m_id, rhs.m_id); }
         
-        JS_EXPORT_PRIVATE JSLabel& operator |=(const JSLabel&);
-        JS_EXPORT_PRIVATE const JSLabel operator |(const JSLabel&) const;
-        JS_EXPORT_PRIVATE JSLabel& operator =(const JSLabel&);
-        JS_EXPORT_PRIVATE JSLabel& operator =(const pair);
-        JS_EXPORT_PRIVATE bool NSU(JSLabel label);
+        // Use this check
+        // i.e. if vo >= pc execute
+        bool operator >=(const JSLabel& rhs) { return JSLabelTable::labelTable().leq(rhs.m_id, m_id); }
+        bool operator <=(const JSLabel& rhs) { return JSLabelTable::labelTable().leq(m_id, rhs.m_id); }
         
-        // Static members
-        JS_EXPORT_PRIVATE static pair pcGlobalLabel;
-        JS_EXPORT_PRIVATE static pair returnLabel;
-        JS_EXPORT_PRIVATE static pair eventNodeLabel;
-        JS_EXPORT_PRIVATE static pair argLabel[1000];
-        JS_EXPORT_PRIVATE static pair eventContextLabel;
-        
-        JS_EXPORT_PRIVATE static bool ABORT_FLAG;
-        JS_EXPORT_PRIVATE static bool BRANCH_FLAG;
+        JSLabel& operator |=(const JSLabel& rhs) { m_id = JSLabelTable::labelTable().join(m_id, rhs.m_id); return *this; }
+        const JSLabel operator |(const JSLabel& other) const { return fromID(JSLabelTable::labelTable().join(m_id, other.m_id)); }
+        JSLabel& operator =(const JSLabel& rhs) { m_id = rhs.m_id; return *this; }
+        JSLabel& operator =(const pair rhs) { m_id = JSLabelTable::labelTable().internBits(rhs.clabel, false); return *this; }
+        // No-sensitive-upgrade check with this as the pc; see IFCContext.h
+        bool NSU(JSLabel label);
     };
-    
-    
 	
 }
 
+// The pc and argument labels live in the running VM's IFCContext
+#include "IFCContext.h"
+
 #endif // JSLabel_h
@@ -6,55 +6,81 @@
 //
 //
 
-#include "JSLabelMap.h"
 #include "config.h"
+#include "JSLabelMap.h"
+
+#include <wtf/Threading.h>
 
 namespace JSC {
 	
-	JSLabelMap* JSLabelMap::s_map = NULL;
-    
 	JSLabelMap::JSLabelMap() {
-		map = new JSLabelEntry*[LABEL_MAP_SIZE];
-		for (int i = 0; i < LABEL_MAP_SIZE; i++) {
-			map[i] = NULL;
-		};
-		idx = 0; 
+		words = 0;
 	}
 	
 	JSLabelMap& JSLabelMap::labelMap() {
-		if (s_map == NULL) {
-			s_map = new JSLabelMap();
+		AtomicallyInitializedStatic(JSLabelMap&, map = *new JSLabelMap);
+		return map;
+	}
+	
+	int JSLabelMap::indexOf(uint64_t label) {
+		IndexMap::iterator it = indices.find(label);
+		if (it == indices.end())
+			return -1;
+		return it->second;
+	}
+	
+	unsigned JSLabelMap::addIndex(uint64_t label) {
+		unsigned index = indices.size();
+		indices.add(label, index);
+		if (index / 64 >= words) {
+			words++;
+			for (size_t i = 0; i < closure.size(); i++)
+				closure[i].append(0);
 		}
-		return *s_map;
+		closure.append(Vector<uint64_t>());
+		closure.last().fill(0, words);
+		return index;
 	}
 	
 	bool JSLabelMap::isOrdered(uint64_t top, uint64_t bottom) {
-		for (int i = (idx - 1); i >= 0; i--) {
-			if (map[i]->getTopValue() == top) {
-                if (map[i]->getBottomValue() == bottom) {
-                    return true;
-                }
-			}
-		}
-		return false;
+		if (indices.isEmpty()) // no policy has declared an order
+			return false;
+		int t = indexOf(top);
+		if (t < 0)
+			return false;
+		int b = indexOf(bottom);
+		if (b < 0)
+			return false;
+		return ordered(t, b);
 	}
     	
 	void JSLabelMap::append(uint64_t top, uint64_t bottom) {
-		if (!isOrdered(top, bottom)) {
-			if (capacity()) {
-                map[idx] = new JSLabelEntry(top, bottom);
-                idx++;
-			} else { 
-                printf("Map full in JSLabelMap.cpp?\n");
-            }
-		} 
+		if (isOrdered(top, bottom))
+			return;
+		int t = indexOf(top);
+		int b = indexOf(bottom);
+		if ((t < 0 || b < 0) && !capacity()) {
+			printf("Map full in JSLabelMap.cpp?\n");
+			return;
+		}
+		if (t < 0)
+			t = addIndex(top);
+		if (b < 0)
+			b = addIndex(bottom);
+		
+		// Everything at or above top is now above bottom and everything below it
+		Vector<uint64_t> below = closure[b];
+		below[b / 64] |= static_cast<uint64_t>(1) << (b % 64);
+		for (size_t x = 0; x < closure.size(); x++) {
+			if (static_cast<int>(x) != t && !ordered(x, t))
+				continue;
+			Vector<uint64_t>& row = closure[x];
+			for (unsigned w = 0; w < words; w++)
+				row[w] |= below[w];
+		}
 	}
 		
 	JSLabelMap::~JSLabelMap() {
-		for (int i = idx; i >= 0; i--) {
-			delete map[i];
-		}
-		delete[] map; 
 	}
 
 }
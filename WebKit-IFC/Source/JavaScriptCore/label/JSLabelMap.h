@@ -10,20 +10,33 @@
 #define JSLabelMap_h
 
 #include <stdio.h>
+#include <stdint.h>
+#include <wtf/HashMap.h>
+#include <wtf/Vector.h>
 
-#include "JSLabelEntry.h"
 #include "JSExportMacros.h"
 
 namespace JSC {
 	
-	const int LABEL_MAP_SIZE = 4096; // map size
+	const int LABEL_MAP_SIZE = 4096; // map size, in distinct label values
+
+	// Declassification order declared by the policy. Every label value that
+	// appears in an ordering gets a dense index; row i of the matrix has bit j
+	// set when i is ordered above j, directly or through a chain of declared
+	// orderings. Queries are two hash lookups and a bit test.
 	class JSLabelMap {
 		
 	private:
-		JSLabelEntry **map;
-		int idx;
-		static JSLabelMap* s_map;
-        inline bool capacity() { return (idx < LABEL_MAP_SIZE); };
+		typedef HashMap<uint64_t, unsigned, IntHash<uint64_t>, WTF::UnsignedWithZeroKeyHashTraits<uint64_t> > IndexMap;
+
+		IndexMap indices;
+		Vector<Vector<uint64_t> > closure; // closure[i] is a bit row over dense indices
+		unsigned words; // words per row
+        inline bool capacity() { return (indices.size() < static_cast<unsigned>(LABEL_MAP_SIZE)); };
+
+		int indexOf(uint64_t);
+		unsigned addIndex(uint64_t);
+		bool ordered(unsigned top, unsigned bottom) { return closure[top][bottom / 64] & (static_cast<uint64_t>(1) << (bottom % 64)); }
 		
 	public:
 		JSLabelMap();
@@ -0,0 +1,163 @@
+/*
+ *  JSLabelTable.cpp
+ *  JavaScriptCore
+ *
+ */
+
+#include "config.h"
+#include "JSLabelTable.h"
+
+#include <wtf/Atomics.h>
+#include <wtf/HashFunctions.h>
+
+namespace JSC {
+
+    JSLabelTable* JSLabelTable::s_table = NULL;
+
+    JSLabelTable::JSLabelTable()
+        : m_size(0)
+        , m_internMemo(new WTF::ThreadSpecific<InternMemo>())
+    {
+        memset(m_segments, 0, sizeof(m_segments));
+        memset(m_joinCache, 0, sizeof(m_joinCache));
+        m_index.fill(0, 64);
+        add(IFCLattice::bottom(), false); // bottomID
+    }
+
+    void JSLabelTable::createTable() {
+        // VMs on different threads can get here first at the same time
+        AtomicallyInitializedStatic(JSLabelTable&, table = *new JSLabelTable);
+        WTF::memoryBarrierBeforeUnlock();
+        s_table = &table;
+    }
+
+    // -----------Private----------- //
+
+    unsigned JSLabelTable::hash(const Element& element, bool star) {
+        return IFCLattice::hash(element) ^ (star ? 0x9e3779b9U : 0);
+    }
+
+    LabelID JSLabelTable::find(const Element& element, bool star) const {
+        unsigned mask = m_index.size() - 1;
+        for (unsigned i = hash(element, star) & mask; ; i = (i + 1) & mask) {
+            LabelID slot = m_index[i];
+            if (!slot)
+                return UINT32_MAX;
+            const Entry& e = entry(slot - 1);
+            if (e.star == star && IFCLattice::equal(e.element, element))
+                return slot - 1;
+        }
+    }
+
+    LabelID JSLabelTable::add(const Element& element, bool star) {
+        // NOTE: caller holds m_lock (or is the constructor)
+        LabelID id = m_size;
+        unsigned segment = id >> segmentShift;
+        if (segment >= maxSegments)
+            CRASH();
+        if (!m_segments[segment])
+            m_segments[segment] = new Entry[segmentSize];
+        Entry& e = m_segments[segment][id & (segmentSize - 1)];
+        e.element = element;
+        e.star = star;
+
+        if ((m_size + 1) * 2 > m_index.size())
+            grow();
+        unsigned mask = m_index.size() - 1;
+        unsigned i = hash(element, star) & mask;
+        while (m_index[i])
+            i = (i + 1) & mask;
+        m_index[i] = id + 1;
+
+        // Publish the entry before the ID can be handed out.
+        WTF::memoryBarrierBeforeUnlock();
+        m_size++;
+        return id;
+    }
+
+    void JSLabelTable::grow() {
+        Vector<LabelID> index;
+        index.fill(0, m_index.size() * 2);
+        unsigned mask = index.size() - 1;
+        for (LabelID id = 0; id < m_size; id++) {
+            const Entry& e = entry(id);
+            unsigned i = hash(e.element, e.star) & mask;
+            while (index[i])
+                i = (i + 1) & mask;
+            index[i] = id + 1;
+        }
+        m_index.swap(index);
+    }
+
+    // -----------Public----------- //
+
+    LabelID JSLabelTable::intern(const Element& element, bool star) {
+        if (!star && IFCLattice::equal(element, IFCLattice::bottom()))
+            return bottomID;
+
+        InternMemo& memo = **m_internMemo;
+        unsigned slot = hash(element, star) & (InternMemo::memoSize - 1);
+        Entry& last = memo.entries[slot];
+        if (memo.ids[slot] && last.star == star && IFCLattice::equal(last.element, element))
+            return memo.ids[slot] - 1;
+
+        LabelID id;
+        {
+            MutexLocker locker(m_lock);
+            id = find(element, star);
+            if (id == UINT32_MAX)
+                id = add(element, star);
+        }
+        last.element = element;
+        last.star = star;
+        memo.ids[slot] = id + 1;
+        return id;
+    }
+
+    LabelID JSLabelTable::joinSlowCase(LabelID a, LabelID b) {
+        const Entry& ea = entry(a);
+        const Entry& eb = entry(b);
+        bool star = ea.star || eb.star;
+        // One side already subsumes the other; no lookup needed.
+        if (star == ea.star && IFCLattice::leq(eb.element, ea.element))
+            return a;
+        if (star == eb.star && IFCLattice::leq(ea.element, eb.element))
+            return b;
+        Element element = IFCLattice::join(ea.element, eb.element);
+
+        if (a > b) {
+            LabelID t = a;
+            a = b;
+            b = t;
+        }
+        if (b >= cachedIDLimit)
+            return intern(element, star);
+
+        uint64_t key = static_cast<uint64_t>(a) | (static_cast<uint64_t>(b) << cachedIDBits);
+        uint64_t& slot = m_joinCache[WTF::intHash(key) & (joinCacheSize - 1)];
+        uint64_t cached = slot;
+        uint64_t keyMask = (static_cast<uint64_t>(1) << (2 * cachedIDBits)) - 1;
+        if (cached && (cached & keyMask) == key)
+            return static_cast<LabelID>(cached >> (2 * cachedIDBits)) - 1;
+
+        LabelID result = intern(element, star);
+        if (result + 1 < (static_cast<LabelID>(1) << (64 - 2 * cachedIDBits)))
+            slot = key | (static_cast<uint64_t>(result + 1) << (2 * cachedIDBits));
+        return result;
+    }
+
+    LabelID JSLabelTable::withStar(LabelID id, bool star) {
+        const Entry& e = entry(id);
+        if (e.star == star)
+            return id;
+        return intern(e.element, star);
+    }
+
+    LabelID JSLabelTable::withElement(LabelID id, const Element& element) {
+        const Entry& e = entry(id);
+        if (IFCLattice::equal(e.element, element))
+            return id;
+        return intern(element, e.star);
+    }
+
+}
@@ -0,0 +1,121 @@
+/*
+ *  JSLabelTable.h
+ *  JavaScriptCore
+ *
+ *  Interning table for label lattice elements. Every distinct (element, star)
+ *  pair is stored once and referred to by a dense 32-bit ID, so that values,
+ *  registers, cells and DOM nodes only carry the ID. ID 0 is always the
+ *  bottom label (no bits, no star), which keeps zero-filled memory labelled
+ *  as public.
+ *
+ */
+
+#ifndef JSLabelTable_h
+#define JSLabelTable_h
+
+#include <stdint.h>
+#include <wtf/Noncopyable.h>
+#include <wtf/ThreadSpecific.h>
+#include <wtf/Threading.h>
+#include <wtf/Vector.h>
+
+#include "JSExportMacros.h"
+#include "LabelLattice.h"
+
+namespace JSC {
+
+    typedef uint32_t LabelID;
+
+    class JSLabelTable {
+        WTF_MAKE_NONCOPYABLE(JSLabelTable);
+    public:
+        typedef IFCLattice::Element Element;
+
+    private:
+        struct Entry {
+            Element element;
+            bool star;
+        };
+
+        // Entries live in fixed-size segments that are never moved, so readers
+        // can index them without taking the lock.
+        static const unsigned segmentShift = 10;
+        static const unsigned segmentSize = 1 << segmentShift;
+        static const unsigned maxSegments = 4096;
+
+        // Direct-mapped memo for joins. Each slot packs both operands and the
+        // result into one word so that a racing reader sees either a whole
+        // entry or a miss, never a torn one.
+        static const unsigned joinCacheBits = 12;
+        static const unsigned joinCacheSize = 1 << joinCacheBits;
+        static const unsigned cachedIDBits = 21;
+        static const LabelID cachedIDLimit = 1 << cachedIDBits;
+
+        // Per-thread memo of recent intern() results, checked before the
+        // locked lookup. Entries are never removed, so a hit cannot go stale.
+        struct InternMemo {
+            static const unsigned memoBits = 6;
+            static const unsigned memoSize = 1 << memoBits;
+            InternMemo() { memset(ids, 0, sizeof(ids)); }
+            Entry entries[memoSize];
+            LabelID ids[memoSize]; // id + 1, 0 is empty
+        };
+
+        Entry* m_segments[maxSegments];
+        unsigned m_size;
+        Vector<LabelID> m_index; // open addressing, stores id + 1, 0 is empty
+        uint64_t m_joinCache[joinCacheSize];
+        WTF::ThreadSpecific<InternMemo>* m_internMemo;
+        Mutex m_lock;
+
+        JS_EXPORT_PRIVATE static JSLabelTable* s_table;
+
+        JSLabelTable();
+
+        const Entry& entry(LabelID id) const { return m_segments[id >> segmentShift][id & (segmentSize - 1)]; }
+        static unsigned hash(const Element&, bool);
+        LabelID find(const Element&, bool) const;
+        LabelID add(const Element&, bool);
+        void grow();
+
+        JS_EXPORT_PRIVATE static void createTable();
+        JS_EXPORT_PRIVATE LabelID joinSlowCase(LabelID, LabelID);
+
+    public:
+        static const LabelID bottomID = 0;
+
+        static ALWAYS_INLINE JSLabelTable& labelTable()
+        {
+            if (UNLIKELY(!s_table))
+                createTable();
+            return *s_table;
+        }
+
+        JS_EXPORT_PRIVATE LabelID intern(const Element&, bool star);
+        LabelID internBits(uint64_t bits, bool star) { return intern(IFCLattice::fromBits(bits), star); }
+        const Element& element(LabelID id) const { return entry(id).element; }
+        uint64_t bits(LabelID id) const { return IFCLattice::toBits(entry(id).element); }
+        bool star(LabelID id) const { return entry(id).star; }
+        unsigned size() const { return m_size; }
+
+        ALWAYS_INLINE LabelID join(LabelID a, LabelID b)
+        {
+            if (a == b || b == bottomID)
+                return a;
+            if (a == bottomID)
+                return b;
+            return joinSlowCase(a, b);
+        }
+        ALWAYS_INLINE bool leq(LabelID a, LabelID b) const
+        {
+            return a == b || IFCLattice::leq(element(a), element(b));
+        }
+        ALWAYS_INLINE bool isPolicy(LabelID id) const { return IFCLattice::isPolicy(element(id)); }
+
+        JS_EXPORT_PRIVATE LabelID withStar(LabelID, bool);
+        JS_EXPORT_PRIVATE LabelID withElement(LabelID, const Element&);
+    };
+
+}
+
+#endif // JSLabelTable_h
@@ -0,0 +1,216 @@
+/*
+ *  LabelLattice.h
+ *  JavaScriptCore
+ *
+ *  Lattice traits for the IFC label algebra. JSLabelTable stores
+ *  IFCLattice::Element values and JSLabel's join/compare operations inline
+ *  straight into the trait, so the lattice is fixed at compile time by
+ *  IFC_LATTICE below.
+ *
+ *  Every trait provides:
+ *    Element                 - the element representation
+ *    bottom()                - least element (public)
+ *    top()                   - every origin, used when origins run out
+ *    fromBits(uint64_t)      - element for a URLMap/policy bit set
+ *    toBits(Element)         - low 64 bits, what JSLabel::Val() returns
+ *    singleton(unsigned)     - element for a single origin index
+ *    join(a, b), leq(a, b)   - lattice operations
+ *    equal(a, b), hash(a)    - for interning
+ *    isPolicy(a)             - true for the policy label (bit 0 only)
+ *
+ */
+
+#ifndef LabelLattice_h
+#define LabelLattice_h
+
+#include <stdint.h>
+#include <string.h>
+#include <wtf/AlwaysInline.h>
+#include <wtf/HashFunctions.h>
+
+#include "OriginSetTable.h"
+
+// Lattice the engine is built against
+#define IFC_LATTICE_POWERSET    1   // one bit per origin, 64 origins
+#define IFC_LATTICE_TWO_POINT   2   // low/high only, for cheap deployments
+#define IFC_LATTICE_WIDE        3   // one bit per origin, IFC_WIDE_LATTICE_WORDS * 64 origins
+#define IFC_LATTICE_HYBRID      4   // 63 inline origins, the rest spilled to OriginSetTable
+
+#ifndef IFC_LATTICE
+#define IFC_LATTICE IFC_LATTICE_HYBRID
+#endif
+
+#ifndef IFC_WIDE_LATTICE_WORDS
+#define IFC_WIDE_LATTICE_WORDS 4
+#endif
+
+namespace JSC {
+
+    static const uint64_t policyLabelBits = 1;
+
+    // Powerset of up to 64 origins. Bit 0 is the policy label.
+    struct PowersetLattice {
+        typedef uint64_t Element;
+
+        static ALWAYS_INLINE Element bottom() { return 0; }
+        static ALWAYS_INLINE Element top() { return ~policyLabelBits; }
+        static ALWAYS_INLINE Element fromBits(uint64_t bits) { return bits; }
+        static ALWAYS_INLINE uint64_t toBits(Element e) { return e; }
+        static ALWAYS_INLINE Element singleton(unsigned origin) { return origin < 64 ? static_cast<uint64_t>(1) << origin : top(); }
+        static ALWAYS_INLINE Element join(Element a, Element b) { return a | b; }
+        static ALWAYS_INLINE bool leq(Element a, Element b) { return (a | b) == b; }
+        static ALWAYS_INLINE bool equal(Element a, Element b) { return a == b; }
+        static ALWAYS_INLINE unsigned hash(Element e) { return WTF::intHash(e); }
+        static ALWAYS_INLINE bool isPolicy(Element e) { return e == policyLabelBits; }
+    };
+
+    // Two-point low/high lattice. All origins collapse to one high point;
+    // the policy bit is kept apart because the interpreter treats it specially.
+    struct TwoPointLattice {
+        typedef uint64_t Element;
+        static const uint64_t highBit = 2;
+
+        static ALWAYS_INLINE Element bottom() { return 0; }
+        static ALWAYS_INLINE Element top() { return highBit; }
+        static ALWAYS_INLINE Element fromBits(uint64_t bits) { return (bits & policyLabelBits) | ((bits & ~policyLabelBits) ? highBit : 0); }
+        static ALWAYS_INLINE uint64_t toBits(Element e) { return e; }
+        static ALWAYS_INLINE Element singleton(unsigned origin) { return origin ? highBit : policyLabelBits; }
+        static ALWAYS_INLINE Element join(Element a, Element b) { return a | b; }
+        static ALWAYS_INLINE bool leq(Element a, Element b) { return (a | b) == b; }
+        static ALWAYS_INLINE bool equal(Element a, Element b) { return a == b; }
+        static ALWAYS_INLINE unsigned hash(Element e) { return WTF::intHash(e); }
+        static ALWAYS_INLINE bool isPolicy(Element e) { return e == policyLabelBits; }
+    };
+
+    // Powerset of Words * 64 origins, stored inline.
+    template<unsigned Words>
+    struct WidePowersetLattice {
+        struct Element {
+            uint64_t words[Words];
+        };
+
+        static ALWAYS_INLINE Element bottom()
+        {
+            Element e;
+            memset(e.words, 0, sizeof(e.words));
+            return e;
+        }
+        static ALWAYS_INLINE Element top()
+        {
+            Element e;
+            memset(e.words, 0xff, sizeof(e.words));
+            e.words[0] &= ~policyLabelBits;
+            return e;
+        }
+        static ALWAYS_INLINE Element fromBits(uint64_t bits)
+        {
+            Element e = bottom();
+            e.words[0] = bits;
+            return e;
+        }
+        static ALWAYS_INLINE uint64_t toBits(const Element& e) { return e.words[0]; }
+        static ALWAYS_INLINE Element singleton(unsigned origin)
+        {
+            if (origin >= Words * 64)
+                return top();
+            Element e = bottom();
+            e.words[origin / 64] = static_cast<uint64_t>(1) << (origin % 64);
+            return e;
+        }
+        static ALWAYS_INLINE Element join(const Element& a, const Element& b)
+        {
+            Element e;
+            for (unsigned i = 0; i < Words; i++)
+                e.words[i] = a.words[i] | b.words[i];
+            return e;
+        }
+        static ALWAYS_INLINE bool leq(const Element& a, const Element& b)
+        {
+            for (unsigned i = 0; i < Words; i++) {
+                if ((a.words[i] | b.words[i]) != b.words[i])
+                    return false;
+            }
+            return true;
+        }
+        static ALWAYS_INLINE bool equal(const Element& a, const Element& b) { return !memcmp(a.words, b.words, sizeof(a.words)); }
+        static ALWAYS_INLINE unsigned hash(const Element& e)
+        {
+            unsigned h = 0;
+            for (unsigned i = 0; i < Words; i++)
+                h = WTF::intHash((static_cast<uint64_t>(h) << 32) | WTF::intHash(e.words[i]));
+            return h;
+        }
+        static ALWAYS_INLINE bool isPolicy(const Element& e)
+        {
+            if (e.words[0] != policyLabelBits)
+                return false;
+            for (unsigned i = 1; i < Words; i++) {
+                if (e.words[i])
+                    return false;
+            }
+            return true;
+        }
+    };
+
+    // Powerset of any number of origins. Origins 0..62 live inline in one
+    // word, so small labels join and compare with plain bit operations.
+    // Larger origins spill to an interned sorted array in OriginSetTable and
+    // set overflowBit in the inline word. A bare 64-bit value that carries
+    // overflowBit (e.g. one round-tripped through JSLabel::pair) comes back
+    // as "every spilled origin", which over-approximates and stays sound.
+    struct HybridLattice {
+        struct Element {
+            uint64_t bits;
+            SpillID spill;
+        };
+        static const unsigned inlineOrigins = 63;
+        static const uint64_t overflowBit = static_cast<uint64_t>(1) << inlineOrigins;
+
+        static ALWAYS_INLINE Element make(uint64_t bits, SpillID spill)
+        {
+            Element e;
+            e.bits = spill ? bits | overflowBit : bits & ~overflowBit;
+            e.spill = spill;
+            return e;
+        }
+        static ALWAYS_INLINE Element bottom() { return make(0, OriginSetTable::emptySpill); }
+        static ALWAYS_INLINE Element top() { return make(~policyLabelBits, OriginSetTable::topSpill); }
+        static ALWAYS_INLINE Element fromBits(uint64_t bits) { return make(bits, (bits & overflowBit) ? OriginSetTable::topSpill : OriginSetTable::emptySpill); }
+        static ALWAYS_INLINE uint64_t toBits(const Element& e) { return e.bits; }
+        static ALWAYS_INLINE Element singleton(unsigned origin)
+        {
+            if (origin < inlineOrigins)
+                return make(static_cast<uint64_t>(1) << origin, OriginSetTable::emptySpill);
+            return make(0, OriginSetTable::originSetTable().singleton(origin));
+        }
+        static ALWAYS_INLINE Element join(const Element& a, const Element& b)
+        {
+            Element e;
+            e.bits = a.bits | b.bits;
+            e.spill = (a.spill == b.spill || !b.spill) ? a.spill : !a.spill ? b.spill : OriginSetTable::originSetTable().join(a.spill, b.spill);
+            return e;
+        }
+        static ALWAYS_INLINE bool leq(const Element& a, const Element& b)
+        {
+            if ((a.bits | b.bits) != b.bits)
+                return false;
+            return a.spill == b.spill || !a.spill || OriginSetTable::originSetTable().subset(a.spill, b.spill);
+        }
+        static ALWAYS_INLINE bool equal(const Element& a, const Element& b) { return a.bits == b.bits && a.spill == b.spill; }
+        static ALWAYS_INLINE unsigned hash(const Element& e) { return WTF::intHash(e.bits) ^ WTF::intHash(e.spill); }
+        static ALWAYS_INLINE bool isPolicy(const Element& e) { return e.bits == policyLabelBits; }
+    };
+
+#if IFC_LATTICE == IFC_LATTICE_TWO_POINT
+    typedef TwoPointLattice IFCLattice;
+#elif IFC_LATTICE == IFC_LATTICE_WIDE
+    typedef WidePowersetLattice<IFC_WIDE_LATTICE_WORDS> IFCLattice;
+#elif IFC_LATTICE == IFC_LATTICE_HYBRID
+    typedef HybridLattice IFCLattice;
+#else
+    typedef PowersetLattice IFCLattice;
+#endif
+
+}
+
+#endif // LabelLattice_h
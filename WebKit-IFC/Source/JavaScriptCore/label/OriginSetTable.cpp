@@ -0,0 +1,143 @@
+/*
+ *  OriginSetTable.cpp
+ *  JavaScriptCore
+ *
+ */
+
+#include "config.h"
+#include "OriginSetTable.h"
+
+#include <wtf/HashFunctions.h>
+
+namespace JSC {
+
+    OriginSetTable::OriginSetTable() {
+        m_sets.append(new OriginSet()); // emptySpill
+        m_sets.append(new OriginSet()); // topSpill, never looked up by contents
+        m_index.fill(0, 64);
+    }
+
+    OriginSetTable& OriginSetTable::originSetTable() {
+        // VMs on different threads can get here first at the same time
+        AtomicallyInitializedStatic(OriginSetTable&, table = *new OriginSetTable);
+        return table;
+    }
+
+    // -----------Private----------- //
+
+    unsigned OriginSetTable::hash(const OriginSet& set) {
+        unsigned h = set.size();
+        for (size_t i = 0; i < set.size(); i++)
+            h = WTF::intHash((static_cast<uint64_t>(h) << 32) | set[i]);
+        return h;
+    }
+
+    SpillID OriginSetTable::find(const OriginSet& set) const {
+        unsigned mask = m_index.size() - 1;
+        for (unsigned i = hash(set) & mask; ; i = (i + 1) & mask) {
+            SpillID id = m_index[i];
+            if (!id)
+                return emptySpill;
+            const OriginSet& other = *m_sets[id];
+            if (other.size() == set.size() && !memcmp(other.data(), set.data(), set.size() * sizeof(unsigned)))
+                return id;
+        }
+    }
+
+    SpillID OriginSetTable::add(const OriginSet& set) {
+        // NOTE: caller holds m_lock
+        SpillID id = m_sets.size();
+        m_sets.append(new OriginSet(set));
+        if (m_sets.size() * 2 > m_index.size())
+            grow();
+        unsigned mask = m_index.size() - 1;
+        unsigned i = hash(set) & mask;
+        while (m_index[i])
+            i = (i + 1) & mask;
+        m_index[i] = id;
+        return id;
+    }
+
+    void OriginSetTable::grow() {
+        Vector<SpillID> index;
+        index.fill(0, m_index.size() * 2);
+        unsigned mask = index.size() - 1;
+        for (SpillID id = topSpill + 1; id < m_sets.size(); id++) {
+            unsigned i = hash(*m_sets[id]) & mask;
+            while (index[i])
+                i = (i + 1) & mask;
+            index[i] = id;
+        }
+        m_index.swap(index);
+    }
+
+    SpillID OriginSetTable::intern(const OriginSet& set) {
+        // NOTE: caller holds m_lock
+        if (set.isEmpty())
+            return emptySpill;
+        SpillID id = find(set);
+        if (id != emptySpill)
+            return id;
+        return add(set);
+    }
+
+    // -----------Public----------- //
+
+    SpillID OriginSetTable::singleton(unsigned origin) {
+        MutexLocker locker(m_lock);
+        OriginSet set;
+        set.append(origin);
+        return intern(set);
+    }
+
+    SpillID OriginSetTable::join(SpillID a, SpillID b) {
+        if (a == b || b == emptySpill)
+            return a;
+        if (a == emptySpill)
+            return b;
+        if (a == topSpill || b == topSpill)
+            return topSpill;
+
+        MutexLocker locker(m_lock);
+        const OriginSet& sa = *m_sets[a];
+        const OriginSet& sb = *m_sets[b];
+        OriginSet set;
+        set.reserveInitialCapacity(sa.size() + sb.size());
+        size_t i = 0, j = 0;
+        while (i < sa.size() && j < sb.size()) {
+            if (sa[i] < sb[j])
+                set.append(sa[i++]);
+            else if (sb[j] < sa[i])
+                set.append(sb[j++]);
+            else {
+                set.append(sa[i++]);
+                j++;
+            }
+        }
+        set.append(sa.data() + i, sa.size() - i);
+        set.append(sb.data() + j, sb.size() - j);
+        return intern(set);
+    }
+
+    bool OriginSetTable::subset(SpillID a, SpillID b) {
+        if (a == b || a == emptySpill || b == topSpill)
+            return true;
+        if (a == topSpill || b == emptySpill)
+            return false;
+
+        MutexLocker locker(m_lock);
+        const OriginSet& sa = *m_sets[a];
+        const OriginSet& sb = *m_sets[b];
+        if (sa.size() > sb.size())
+            return false;
+        size_t j = 0;
+        for (size_t i = 0; i < sa.size(); i++) {
+            while (j < sb.size() && sb[j] < sa[i])
+                j++;
+            if (j == sb.size() || sb[j] != sa[i])
+                return false;
+        }
+        return true;
+    }
+
+}
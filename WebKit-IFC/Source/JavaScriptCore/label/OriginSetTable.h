@@ -0,0 +1,56 @@
+/*
+ *  OriginSetTable.h
+ *  JavaScriptCore
+ *
+ *  Spill storage for the hybrid label lattice. Origins that do not fit in
+ *  the inline 64-bit word are kept as sorted origin arrays, interned here
+ *  and referred to by a 32-bit SpillID. Only labels that mention such an
+ *  origin ever touch this table; the common small-label path never does.
+ *
+ */
+
+#ifndef OriginSetTable_h
+#define OriginSetTable_h
+
+#include <stdint.h>
+#include <wtf/Noncopyable.h>
+#include <wtf/Threading.h>
+#include <wtf/Vector.h>
+
+#include "JSExportMacros.h"
+
+namespace JSC {
+
+    typedef uint32_t SpillID;
+
+    class OriginSetTable {
+        WTF_MAKE_NONCOPYABLE(OriginSetTable);
+
+        typedef Vector<unsigned> OriginSet;
+
+        Vector<OriginSet*> m_sets;  // indexed by SpillID, sorted ascending
+        Vector<SpillID> m_index;    // open addressing, 0 is empty
+        Mutex m_lock;
+
+        OriginSetTable();
+
+        static unsigned hash(const OriginSet&);
+        SpillID find(const OriginSet&) const;
+        SpillID add(const OriginSet&);
+        void grow();
+        SpillID intern(const OriginSet&);
+
+    public:
+        static const SpillID emptySpill = 0;
+        static const SpillID topSpill = 1; // every origin past the inline word
+
+        JS_EXPORT_PRIVATE static OriginSetTable& originSetTable();
+
+        JS_EXPORT_PRIVATE SpillID singleton(unsigned origin);
+        JS_EXPORT_PRIVATE SpillID join(SpillID, SpillID);
+        JS_EXPORT_PRIVATE bool subset(SpillID, SpillID);
+    };
+
+}
+
+#endif // OriginSetTable_h
@@ -15,16 +15,20 @@
 namespace JSC {
 	class Register;
 
+	// One record of the program-counter stack. Records live by value in
+	// ProgramCounter's array; the one below is simply the previous slot.
 	class PCNode {
-		PCNode *node; // pointer to previous node
 		JSLabel value; // node value
 		int ipdloc;
         
 	public:
-		PCNode(PCNode*, JSLabel, int, Register*, bool, bool, bool, bool); // constructor
-		PCNode* Next(); // next node (for pop)
-		JSLabel Val(); // return value
-		int IPDLoc();
+		PCNode(JSLabel l, int i, Register* r, bool eH, bool fH, bool branch, bool iL)
+			: value(l), ipdloc(i), reg(r), handler(fH), excFlag(eH), branchFlag(branch), isLoop(iL)
+		{
+		}
+		JSLabel Val() const { return value; } // return value
+		void Join(JSLabel l) { value |= l; } // join into the value in place
+		int IPDLoc() const { return ipdloc; }
 		Register* reg;
         
         bool handler; // Abhi -- exception details
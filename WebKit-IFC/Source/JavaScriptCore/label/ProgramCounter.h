@@ -13,32 +13,72 @@
 #include "config.h"
 #include "JSLabel.h"
 #include "PCNode.h"
+#include <wtf/Vector.h>
 
 namespace JSC {
 	class Register;
 	
+	// The pc stack is a contiguous array of PCNode records. Slot 0 is the
+	// sentinel and is never popped; push, pop and join touch only the top
+	// slot and do not allocate once the array has grown to the nesting depth.
 	class ProgramCounter {
-		PCNode *node; // current node
+		Vector<PCNode, 32> stack;
 		int len;
+
+		PCNode& top() { return stack.last(); }
 	public:
 		ProgramCounter(); // constructor
-		void Push(JSLabel, int, Register*, bool = false, bool = false, bool = false); // push node to stack
-		void Pop(); // remove and return head
-		JSLabel Head(); // return head
-		int Loc();
-		int Len();
+		// push node to stack
+		void Push(JSLabel l, int i, Register* r, bool eF = false, bool h = false, bool b = false)
+		{
+			// Abhi -- Added h, eF for exceptions
+			PCNode node(Head().Join(l), i, r, eF, h, b, getLoop());
+			stack.append(node);
+			len++;
+		}
+		// remove head
+		void Pop()
+		{
+			if (len > 0) {
+				stack.removeLast();
+				len--;
+			}
+		}
+		JSLabel Head() { return top().Val(); } // return head
+		int Loc() { return top().IPDLoc(); }
+		int Len() { return len; }
+
+		// Unwinding support: drops every record above the sentinel in one step
+		void Clear()
+		{
+			stack.shrink(1);
+			len = 0;
+		}
         
-		void Join(JSLabel);
-		Register* Reg();
+		void Join(JSLabel label) { top().Join(label); }
+		Register* Reg() { return top().reg; }
         
-        bool funHandler(); // Abhi -- Exception Handling
-        bool excHandler(); // Abhi -- Global exception handler
-        bool branchFlag(); // Abhi -- Global exception handler
-        void Join(JSLabel, bool, bool); // Abhi -- Join for function calls
-        void Join(JSLabel, bool); // Abhi -- Join for branch calls
+        bool funHandler() { return top().handler; } // Abhi -- Exception Handling
+        bool excHandler() { return top().excFlag; } // Abhi -- Global exception handler
+        bool branchFlag() { return top().branchFlag; } // Abhi -- Global exception handler
+        // Abhi -- Join for function calls
+        void Join(JSLabel label, bool funHandler, bool excHandler)
+        {
+            PCNode& node = top();
+            node.Join(label);
+            node.handler = funHandler;
+            node.excFlag = excHandler;
+        }
+        // Abhi -- Join for branch calls
+        void Join(JSLabel label, bool branch)
+        {
+            PCNode& node = top();
+            node.Join(label);
+            node.branchFlag = branch;
+        }
         
-        void setLoop(bool);
-        bool getLoop();
+        void setLoop(bool loop) { top().isLoop = loop; }
+        bool getLoop() { return top().isLoop; }
     };
 }
 
@@ -19,6 +19,11 @@ namespace JSC {
         // printf("URLEntry label %llu\n", this->value.Val());
 	}
 	
+	URLEntry::URLEntry(const char* src, JSLabel value) {
+		url = strdup(src);
+		this->value = value;
+	}
+	
 	const char* URLEntry::getURL() const {
 		//printf("URLEntry is returning url %s\n", url);
 		return url;
@@ -25,6 +25,7 @@ namespace JSC {
 		
 	public:
 		URLEntry(const char*, uint64_t value);  // takes url string and generated binary
+		URLEntry(const char*, JSLabel value);   // takes url string and an origin label
 		const char* getURL() const;             // returns key of self
         JSLabel getValue();                    // returns value of self
 	};
@@ -7,25 +7,86 @@
  *
  */
 
-#include "URLMap.h"
 #include "config.h"
+#include "URLMap.h"
+
 #include <stdio.h>
+#include <strings.h>
+#include <wtf/StringHasher.h>
 
 namespace JSC {
 	
+	// -----------URLIndex----------- //
+	
+	URLIndex::URLIndex() {
+		table.fill(0, 64);
+	}
+	
+	URLIndex::~URLIndex() {
+		for (size_t i = 0; i < keys.size(); i++)
+			fastFree(keys[i]);
+	}
+	
+	unsigned URLIndex::hash(const char* key, size_t length) {
+		return StringHasher::computeHash<LChar>(reinterpret_cast<const LChar*>(key), length);
+	}
+	
+	int URLIndex::find(const char* key, size_t length) const {
+		unsigned mask = table.size() - 1;
+		for (unsigned i = hash(key, length) & mask; ; i = (i + 1) & mask) {
+			int slot = table[i];
+			if (!slot)
+				return OUT_OF_BOUNDS;
+			if (lengths[slot - 1] == length && !memcmp(keys[slot - 1], key, length))
+				return values[slot - 1];
+		}
+	}
+	
+	void URLIndex::add(const char* key, size_t length, int value) {
+		// NOTE: any call to add should check find() first
+		char* copy = static_cast<char*>(fastMalloc(length + 1));
+		memcpy(copy, key, length);
+		copy[length] = '\0';
+		keys.append(copy);
+		lengths.append(length);
+		values.append(value);
+		if (keys.size() * 2 > table.size())
+			grow();
+		unsigned mask = table.size() - 1;
+		unsigned i = hash(key, length) & mask;
+		while (table[i])
+			i = (i + 1) & mask;
+		table[i] = keys.size();
+	}
+	
+	void URLIndex::grow() {
+		Vector<int> newTable;
+		newTable.fill(0, table.size() * 2);
+		unsigned mask = newTable.size() - 1;
+		for (size_t k = 0; k < keys.size(); k++) {
+			unsigned i = hash(keys[k], lengths[k]) & mask;
+			while (newTable[i])
+				i = (i + 1) & mask;
+			newTable[i] = k + 1;
+		}
+		table.swap(newTable);
+	}
+	
+	// -----------URLMap----------- //
+	
 	URLMap* URLMap::s_map = NULL; // initialize pointer
+	unsigned URLMap::s_generation = 1; // zero marks an empty cache
 	    
 	URLMap::URLMap() {
-		map = new URLEntry*[MAP_SIZE]; // create our "map"
-        policyArray = new char*[100];
-		for (int i = 0; i < MAP_SIZE; i++) { // initialize map
-			map[i] = NULL;
-		};
+		map.fill(NULL, 3); // create our "map"; it grows as origins are appended
 		idx = 2; // initialize the current index
+		lastLookup = new WTF::ThreadSpecific<LastLookup>();
 		// these are put manually for quick initialization and to avoid filter exceptions
 		map[0] = new URLEntry("policy", 1); // fallback given when map is full
 		map[1] = new URLEntry("NULL", 0); // create generic value for NULL urls
         map[2] = new URLEntry("secret", 2); // User-taint - label is 2 and pLabel is 0
+		for (int i = 0; i <= idx; i++)
+			origins.add(map[i]->getURL(), strlen(map[i]->getURL()), i);
 		lastIdx = 0;
 		setLast(2); // initialize the last label
 	}
@@ -39,53 +100,41 @@ namespace JSC {
 	
 	// -----------Private----------- //
 	
-	void URLMap::append(const char* url, bool isPolicy) { // append url to map
-		// NOTE: any call to append should check capacity() first
+	void URLMap::append(const char* url, size_t length, bool isPolicy) { // append url to map
+		// NOTE: caller holds lock
 		if(isPolicy)
         {
-            policyArray[policyCount] = strdup(url);
-            policyCount++;
+            policies.add(url, length, 0);
+            // urls already looked up as ordinary scripts now map to the policy label
+            s_generation++;
         }
         else{
             // append url to map
             // NOTE: any call to append should check capacity() first
             idx++; // move current map lcoation
-            map[idx] = new URLEntry(url, (uint64_t)1<<(idx-1)/*, (uint64_t)1<<(idx-1)*/); // set map head to new URLEntry
+            map.append(new URLEntry(url, originLabel(idx))); // set map head to new URLEntry
+            origins.add(url, length, idx);
             setLast(idx);
         }
 	}
 	
-	int URLMap::search(const char* url) { // is the url already in the map?
-		for (int i = idx; i >= 0; i--) { // iterate from current index backwards
-            int index = strcmp(map[i]->getURL(), url);
-			if (index == 0) { // is it this one?
-				return i; // return url index
-			}
-            else if (index < 0) {
-                int length = strlen(map[i]->getURL());
-                int urlLength = strlen(url);
-                if (length > urlLength) {
-                    char* str = new char[length];
-                    strncpy(str, url, length);
-                    if (strcmp(map[i]->getURL(), url) == 0)
-                        return i;
-                }
-            }
-		}
-		return OUT_OF_BOUNDS; // if the url isn't in the map
+	int URLMap::search(const OriginKey& key) { // is the url already in the map?
+		return origins.find(key.data(), key.size());
+	}
+	
+	JSLabel URLMap::originLabel(int i) {
+		// Map index i owns origin i - 1, i.e. bit 1<<(i-1) while it fits inline
+		JSLabelTable& table = JSLabelTable::labelTable();
+		return JSLabel::fromID(table.intern(IFCLattice::singleton(i - 1), false));
 	}
 	
 	const char* URLMap::filter(const char* url) { // not implemented, for later use
-		char str[5]; // create temporary string
-        char str1[3];
-		strncpy(str, url, 4); // set the string
-		str[4] = '\0';
-        strncpy(str1, url, 2);
-		if (strcmp(str, "file") == 0 || strcmp(str, "http") == 0 || strcmp(str, "Inte") == 0 ||
-            strcmp(str, "read") == 0 || strcmp(str, "unkn") == 0 || strcmp(str1, "//") == 0) { // what's the urls origin?
+		// what's the urls origin?
+		if (!strncmp(url, "file", 4) || !strncmp(url, "http", 4) || !strncmp(url, "Inte", 4) ||
+            !strncmp(url, "read", 4) || !strncmp(url, "unkn", 4) || !strncmp(url, "//", 2)) {
 			return url;
 		}
-        else if (strcmp(str, "NULL") == 0 || strcmp(str, "") == 0 || strcmp(str, "abou") == 0){
+        else if (!strncmp(url, "NULL", 4) || !*url || !strncmp(url, "abou", 4)){
             return "NULL";
         }
 		else { // this could potentially become recursive
@@ -95,12 +144,75 @@ namespace JSC {
 		}
 	}
 	
+	static inline char toLowerASCII(char c) {
+		return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+	}
+	
+	static inline bool isOriginEnd(char c) {
+		return !c || c == '/' || c == '?' || c == '#';
+	}
+	
+	// Reduces a url to the key it is labelled by. Hierarchical http(s) and
+	// scheme-relative urls become scheme://host[:port] with the scheme and
+	// host lowercased, userinfo dropped and the default port elided, the way
+	// SecurityOrigin sees them. Other urls (file:, internal scripts, the
+	// "secret" taint) keep their full text, as SecurityOrigin gives file urls
+	// a unique origin each.
+	void URLMap::normalize(const char* url, OriginKey& key) {
+		key.shrink(0);
+		if (strncmp(url, "secret", 6) != 0)
+			url = filter(url);
+
+		size_t schemeLength = 0;
+		const char* authority = NULL;
+		if (!strncasecmp(url, "http://", 7)) {
+			schemeLength = 4;
+			authority = url + 7;
+		} else if (!strncasecmp(url, "https://", 8)) {
+			schemeLength = 5;
+			authority = url + 8;
+		} else if (!strncmp(url, "//", 2))
+			authority = url + 2;
+
+		if (!authority) {
+			key.append(url, strlen(url));
+			return;
+		}
+
+		for (size_t i = 0; i < schemeLength; i++)
+			key.append(toLowerASCII(url[i]));
+		if (schemeLength)
+			key.append(':');
+		key.append("//", 2);
+
+		const char* hostEnd = authority;
+		while (!isOriginEnd(*hostEnd))
+			hostEnd++;
+		for (const char* p = authority; p < hostEnd; p++) {
+			if (*p == '@')
+				authority = p + 1;
+		}
+		const char* port = NULL;
+		for (const char* p = authority; p < hostEnd; p++) {
+			if (*p == ':')
+				port = p;
+		}
+		for (const char* p = authority; p < (port ? port : hostEnd); p++)
+			key.append(toLowerASCII(*p));
+		if (port) {
+			size_t portLength = hostEnd - port - 1;
+			bool isDefault = (schemeLength == 4 && portLength == 2 && !strncmp(port + 1, "80", 2))
+				|| (schemeLength == 5 && portLength == 3 && !strncmp(port + 1, "443", 3));
+			if (portLength && !isDefault)
+				key.append(port, hostEnd - port);
+		}
+	}
+	
 	void URLMap::setLast(int i) {
 		if (lastIdx != i) {
 			lastIdx = i;
-			uint64_t temp = map[lastIdx]->getValue().Val();
-            // uint64_t temp1 = map[lastIdx]->getValue().pLabel;
-			lastLabel = JSLabel(temp);
+			// Copy the label itself; its bits alone drop spilled origins
+			lastLabel = map[lastIdx]->getValue();
 		}
 	}
 	
@@ -108,54 +220,20 @@ namespace JSC {
 	
 	void URLMap::put(const char* url, bool isPolicy) { // put url on map
         //readPolicy();
-        bool isPresent = false;
+        MutexLocker locker(lock);
         if (isPolicy) {
-            for (int i = 0; i < policyCount; i++) {
-                // printf("fdsgdgd %s\n", policyArray[i]);
-                if (strcmp(policyArray[i], url) == 0) {
-                    isPresent = true;
-                    break;
-                }
-            }
-            if (!isPresent) {
-                append(url, isPolicy);
+            size_t length = strlen(url);
+            if (policies.find(url, length) == OUT_OF_BOUNDS) {
+                append(url, length, isPolicy);
             }
         }
         else {
-            if (strncmp(url, "secret", 6) != 0)
-                url = strdup(filter(url));
-            // Extract the domain from the URL
-            char* domain = new char[strlen(url)];
-            
-            if (strncmp(url, "http:", 5) == 0) {
-                sscanf(url, "http://%[^/]", domain);
-            }
-            else if (strncmp(url, "https", 5) == 0) {
-                sscanf(url, "https://%[^/]", domain);
-            }
-            else if (strncmp(url, "//", 2) == 0) {
-                sscanf(url, "//%[^/]", domain);
-            }
-            else {
-                strcpy(domain, url);
-            }
-            strcpy(domain, url);
-            // ---------------------------------
-//            int i = 0;
-//            if (strcmp(domain, "ssl.bbc.co.uk") == 0 ||
-//                strcmp(domain, "static.bbc.co.uk") == 0 || strcmp(domain, "fig.bbc.co.uk") == 0 ||
-//                strcmp(domain, "sa.bbc.co.uk") == 0 || strcmp(domain, "ssa.bbc.com") == 0)
-//            {
-//                i = search("ssl.bbc.com");
-//            }
-//            else {
-//                i = search(domain);
-//            }
-            int loc = search(domain);
-            //
+            OriginKey key;
+            normalize(url, key);
+            int loc = search(key);
             if (loc == OUT_OF_BOUNDS) { // if the url's not in the map add it
                 if (capacity()) { // is the map full?
-                    append(domain, isPolicy);
+                    append(key.data(), key.size(), isPolicy);
                 } else { //TODO: remove this or comment after debug
                     printf("Map full in URLMap.cpp?\n");
                 }
@@ -188,53 +266,40 @@ namespace JSC {
     }
 	
 	JSLabel URLMap::getLabel(const char* url) { // get label for given url
-		
-        for (int i = 0; i < policyCount; i++)
-        {
-            if (strcmp(policyArray[i], url) == 0) 
-                return map[0]->getValue();
-        }
+		LastLookup& last = **lastLookup;
+		size_t length = strlen(url);
+		if (last.generation == s_generation && last.length == length && !memcmp(last.url, url, length))
+			return last.label;
 
-        if(strncmp(url, "secret", 6) != 0)
-            url = strdup(filter(url));
-        // Extract the domain from the URL
-        char* domain = new char[strlen(url)];
-        if (strstr(url, "review") != NULL) {
-            strcpy(domain, url);
-        }
-        else if (strncmp(url, "http:", 5) == 0)
-        {
-            sscanf(url, "http://%[^/]", domain);
-        }
-        else if (strncmp(url, "https", 5) == 0)
-        {
-            sscanf(url, "https://%[^/]", domain);
-        }
-        else if (strncmp(url, "//", 2) == 0) {
-            sscanf(url, "//%[^/]", domain);
-        }
-        else
-        {
-            strcpy(domain, url);
-        }
-        strcpy(domain, url);
-        // ---------------------------------
-//        int i = 0;
-//        if (strcmp(domain, "ssl.bbc.co.uk") == 0 || strcmp(domain, "static.bbc.co.uk") == 0 || strcmp(domain, "fig.bbc.co.uk") == 0 ||
-//            strcmp(domain, "sa.bbc.co.uk") == 0 || strcmp(domain, "ssa.bbc.com") == 0)
-//        {
-//            i = search("ssl.bbc.com");
-//        }
-//        else {
-//            i = search(domain);
-//        }
-        int i = search(domain);
+		JSLabel label = lookup(url);
+		if (length < sizeof(last.url)) {
+			memcpy(last.url, url, length + 1);
+			last.length = length;
+			last.label = label;
+			last.generation = s_generation;
+		}
+		return label;
+	}
+	
+	void URLMap::invalidateLabels() {
+		MutexLocker locker(lock);
+		s_generation++;
+	}
+	
+	JSLabel URLMap::lookup(const char* url) {
+		MutexLocker locker(lock);
+		if (policies.find(url, strlen(url)) != OUT_OF_BOUNDS)
+			return map[0]->getValue();
+
+		OriginKey key;
+		normalize(url, key);
+		int i = search(key);
 		if (i == OUT_OF_BOUNDS) { // add to map and return value
 			if (capacity()) { // is the map full?
-				append(domain, false);
+				append(key.data(), key.size(), false);
 				return head();
-			} else { // return the fallback value
-				return map[1]->getValue(); 
+			} else { // out of origins; every origin is the only sound fallback
+				return JSLabel::fromID(JSLabelTable::labelTable().intern(IFCLattice::top(), false));
 			}
 		} else { // return value from list
 			return map[i]->getValue();
@@ -263,7 +328,7 @@ namespace JSC {
 		for (int i = idx; i >= 0; i--) { // delete non null entries
 			delete map[i];
 		}
-		delete[] map; // delete the map :(
+		// lastLookup is intentionally leaked; ThreadSpecific cannot be destroyed
 	}
 	
 }
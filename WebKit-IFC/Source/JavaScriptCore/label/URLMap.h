@@ -15,40 +15,85 @@
 
 #include <string.h>
 #include <stdio.h>
+#include <wtf/ThreadSpecific.h>
+#include <wtf/Threading.h>
+#include <wtf/Vector.h>
 
 #include "JSExportMacros.h"
 
 namespace JSC {
-	
-	const int OUT_OF_BOUNDS = 100; // return instead of null
-	const int MAP_SIZE = 64; // map size
-	
+
+	const int OUT_OF_BOUNDS = -1; // return instead of null; never a map index
+	const int MAP_SIZE = 1 << 16; // map size; origins past the inline label word spill (see LabelLattice.h)
+
+	// Hashed string -> int index. Keys are copied once on add; lookups take a
+	// (pointer, length) pair and never allocate.
+	class URLIndex {
+		Vector<char*> keys;
+		Vector<size_t> lengths;
+		Vector<int> values;
+		Vector<int> table; // open addressing, stores key index + 1, 0 is empty
+
+		static unsigned hash(const char*, size_t);
+		void grow();
+
+	public:
+		URLIndex();
+		~URLIndex();
+		int find(const char*, size_t) const; // returns OUT_OF_BOUNDS if absent
+		void add(const char*, size_t, int);
+		size_t size() const { return keys.size(); }
+	};
+
 	class URLMap {
-		
+
 	private:
-		URLEntry **map; // the map!
+		typedef Vector<char, 256> OriginKey; // inline buffer; only very long urls hit the heap
+
+		// Per-thread memo of the last getLabel() call. Scripts and label
+		// checks tend to ask for the same url many times in a row.
+		struct LastLookup {
+			LastLookup() : generation(0), length(0) { url[0] = '\0'; }
+			unsigned generation;
+			size_t length;
+			char url[256];
+			JSLabel label;
+		};
+
+		Vector<URLEntry*> map; // the map!
 		int idx; // current postition in map
 		static URLMap* s_map; // member pointer to intself
-        char** policyArray; 
-        int policyCount = 0;
-		
-		void append(const char*, bool isPolicy); // appends url onto map
-		int search(const char*); // searches for url in the map and returns its index
+		URLIndex origins; // normalized origin -> map index
+		URLIndex policies; // raw policy script url
+		WTF::ThreadSpecific<LastLookup>* lastLookup;
+		Mutex lock;
+
+		void append(const char*, size_t, bool isPolicy); // appends url onto map
+		JSLabel originLabel(int); // label for the origin at a map index
+		int search(const OriginKey&); // searches for url in the map and returns its index
 		const char* filter(const char*); // filter urls
+		void normalize(const char*, OriginKey&); // filtered, normalized origin for a url
+		JSLabel lookup(const char*); // getLabel without the per-thread memo
 		inline bool capacity() { return (idx+1 < MAP_SIZE); }; // checks if the map is full
-		
+
 		JSLabel lastLabel;
 		int lastIdx;
 		void setLast(int);
-		
+
 	public: // puts/gets will be fed with program->sourceURL().utf8().data() from the interpretor (subject to change for functions and evals)
-		        
+
 		// ctor, copy-ctor, and assignment opperators
 		URLMap(); // map constructor
 		URLMap(URLMap const&);
 		URLMap& operator = (URLMap const&);
 		JS_EXPORT_PRIVATE static URLMap& urlmap(); // validate member pointer
 		
+		// Bumped whenever a url's label may change (policy registration,
+		// setContext). Labels cached against an older generation are stale.
+		JS_EXPORT_PRIVATE static unsigned s_generation;
+		static unsigned labelGeneration() { return s_generation; }
+		JS_EXPORT_PRIVATE void invalidateLabels();
+
 		JS_EXPORT_PRIVATE JSLabel getLabel(const char*); // takes script url as string and finds value
 		JS_EXPORT_PRIVATE void put(const char*, bool isPolicy); // puts script url string in map and generates a value
         JS_EXPORT_PRIVATE void readPolicy();
@@ -58,7 +103,7 @@ namespace JSC {
 		JS_EXPORT_PRIVATE uint64_t lastAsVal();
 		~URLMap(); // destructor
 	};
-	
+
 }
 
 #endif //URLMap
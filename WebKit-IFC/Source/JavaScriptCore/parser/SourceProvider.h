@@ -30,10 +30,12 @@
 #define SourceProvider_h
 
 #include "SourceProviderCache.h"
+#include "URLMap.h"
 #include "UString.h"
 #include <wtf/PassOwnPtr.h>
 #include <wtf/RefCounted.h>
 #include <wtf/UnusedParam.h>
+#include <wtf/text/CString.h>
 #include <wtf/text/TextPosition.h>
 
 namespace JSC {
@@ -48,6 +50,7 @@ namespace JSC {
             , m_validated(false)
             , m_cache(cache ? cache : new SourceProviderCache)
             , m_cacheOwned(!cache)
+            , m_sourceLabelGeneration(0)
         {
             turnOffVerifier();
         }
@@ -76,6 +79,17 @@ namespace JSC {
 
         SourceProviderCache* cache() const { return m_cache; }
         void notifyCacheSizeChanged(int delta) { if (!m_cacheOwned) cacheSizeChanged(delta); }
+
+        // IFC4BC - label of the script's url, resolved once per URLMap generation
+        JSLabel sourceLabel()
+        {
+            if (m_sourceLabelGeneration != URLMap::labelGeneration()) {
+                unsigned generation = URLMap::labelGeneration();
+                m_sourceLabel = URLMap::urlmap().getLabel(m_url.utf8().data());
+                m_sourceLabelGeneration = generation;
+            }
+            return m_sourceLabel;
+        }
         
     private:
         virtual void cacheSizeChanged(int delta) { UNUSED_PARAM(delta); }
@@ -85,6 +99,8 @@ namespace JSC {
         bool m_validated;
         SourceProviderCache* m_cache;
         bool m_cacheOwned;
+        JSLabel m_sourceLabel;
+        unsigned m_sourceLabelGeneration;
     };
 
     class UStringSourceProvider : public SourceProvider {
@@ -409,8 +409,12 @@ void Arguments::tearOff(CallFrame* callFrame)
     d->registers = d->registerArray.get() + CallFrame::offsetFor(d->numArguments + 1);
 
     if (!callFrame->isInlineCallFrame()) {
-        for (size_t i = 0; i < d->numArguments; ++i)
-            argument(i).set(callFrame->globalData(), this, callFrame->argument(i));
+        for (size_t i = 0; i < d->numArguments; ++i) {
+            // IFC4BC - With the label the frame reads the argument with
+            JSValue value = callFrame->argument(i);
+            value.setValueLabel(callFrame->uncheckedRegLabel(CallFrame::argumentOffset(i)));
+            argument(i).set(callFrame->globalData(), this, value);
+        }
         return;
     }
 
@@ -400,7 +400,7 @@ JSValue JSC_HOST_CALL arrayProtoFuncJoin(ExecState* exec)
     StringRecursionChecker checker(exec, thisObj);
     if (JSValue earlyReturnValue = checker.earlyReturnValue()) {
         ret = (earlyReturnValue);
-        ret.setValueLabel(thisObj->joinObjectLabel(JSLabel(JSLabel::argLabel[0])));
+        ret.setValueLabel(thisObj->joinObjectLabel(exec->thisLabel()));
         return ret;
     }
 
@@ -437,7 +437,7 @@ JSValue JSC_HOST_CALL arrayProtoFuncJoin(ExecState* exec)
             stringJoiner.append(UString());
     }
 
-    JSLabel retLabel = thisObj->joinObjectLabel(JSLabel(JSLabel::argLabel[0]).Join(JSLabel(JSLabel::argLabel[1])).Join(eLabel));
+    JSLabel retLabel = thisObj->joinObjectLabel(exec->thisLabel().Join(exec->argumentLabel(0)).Join(eLabel));
     ret = (stringJoiner.build(exec));
     ret.setValueLabel(retLabel);
     return ret;
@@ -487,15 +487,15 @@ JSValue JSC_HOST_CALL arrayProtoFuncPop(ExecState* exec)
 {
     // IFC4BC
     JSValue thisValue = exec->hostThisValue();
-    if (!JSLabel(JSLabel::pcGlobalLabel).NSU(asObject(thisValue)->getObjectLabel()))
+    if (!JSLabel(exec->ifcContext().pcGlobalLabel).NSU(asObject(thisValue)->getObjectLabel()))
     {
         // printf("IFC check in array-Pop failed\n");
-        JSLabel::ABORT_FLAG = true;
+        exec->ifcContext().abortFlag = true;
         // return jsUndefined();
     }
     
     JSValue result=jsUndefined(); 
-    result.setValueLabel(JSLabel(JSLabel::argLabel[0]));
+    result.setValueLabel(exec->thisLabel());
 
     if (isJSArray(thisValue))
         return (asArray(thisValue)->pop(exec));
@@ -512,7 +512,7 @@ JSValue JSC_HOST_CALL arrayProtoFuncPop(ExecState* exec)
         result = jsUndefined();
     } else {
         result = thisObj->get(exec, length - 1);
-        result.setValueLabel(result.joinValueLabel(JSLabel(JSLabel::argLabel[0])));
+        result.setValueLabel(result.joinValueLabel(exec->thisLabel()));
         if (exec->hadException())
             return (result);
         if (!thisObj->methodTable()->deletePropertyByIndex(thisObj, exec, length - 1)) {
@@ -528,14 +528,14 @@ JSValue JSC_HOST_CALL arrayProtoFuncPush(ExecState* exec)
 {
     // IFC4BC
     JSValue thisValue = exec->hostThisValue();
-    if (!JSLabel(JSLabel::pcGlobalLabel).NSU(asObject(thisValue)->getObjectLabel()))
+    if (!JSLabel(exec->ifcContext().pcGlobalLabel).NSU(asObject(thisValue)->getObjectLabel()))
     {
         // printf("IFC check in array-Push failed\n");
-        JSLabel::ABORT_FLAG = true;
+        exec->ifcContext().abortFlag = true;
         // return jsUndefined();
     }
     JSValue retLength = jsUndefined();
-    JSLabel retLabel = JSLabel(JSLabel::argLabel[0]).Join(JSLabel(JSLabel::argLabel[1]));
+    JSLabel retLabel = exec->thisLabel().Join(exec->argumentLabel(0));
     retLength.setValueLabel(retLabel);
 
     if (isJSArray(thisValue) && exec->argumentCount() == 1) {
@@ -579,7 +579,7 @@ JSValue JSC_HOST_CALL arrayProtoFuncReverse(ExecState* exec)
     JSObject* thisObj = exec->hostThisValue().toObject(exec);
 
     JSValue retLength = jsUndefined();
-    JSLabel retLabel = JSLabel(JSLabel::argLabel[0]).Join(JSLabel::argLabel[1]);
+    JSLabel retLabel = exec->thisLabel().Join(exec->argumentLabel(0));
     retLength.setValueLabel(retLabel);
 
     unsigned length = thisObj->get(exec, exec->propertyNames().length).toUInt32(exec);
@@ -624,15 +624,15 @@ JSValue JSC_HOST_CALL arrayProtoFuncShift(ExecState* exec)
 {
     // IFC4BC
     JSObject* thisObj = exec->hostThisValue().toObject(exec);
-    if (!JSLabel(JSLabel::pcGlobalLabel).NSU(thisObj->getObjectLabel()))
+    if (!JSLabel(exec->ifcContext().pcGlobalLabel).NSU(thisObj->getObjectLabel()))
     {
         // printf("IFC check in array-Shift failed\n");
-        JSLabel::ABORT_FLAG = true;
+        exec->ifcContext().abortFlag = true;
         // return jsUndefined();
     }
     
     JSValue result=jsUndefined(); 
-    result.setValueLabel(JSLabel(JSLabel::argLabel[0]));
+    result.setValueLabel(exec->thisLabel());
     
     unsigned length = thisObj->get(exec, exec->propertyNames().length).toUInt32(exec);
     if (exec->hadException())
@@ -641,10 +641,10 @@ JSValue JSC_HOST_CALL arrayProtoFuncShift(ExecState* exec)
     if (length == 0) {
         putProperty(exec, thisObj, exec->propertyNames().length, jsNumber(length));
         result = jsUndefined();
-        result.setValueLabel(JSLabel(JSLabel::argLabel[0]));
+        result.setValueLabel(exec->thisLabel());
     } else {
         result = thisObj->get(exec, 0);
-        result.setValueLabel(result.joinValueLabel(JSLabel(JSLabel::argLabel[0])));
+        result.setValueLabel(result.joinValueLabel(exec->thisLabel()));
         shift(exec, thisObj, 0, 1, 0, length);
         if (exec->hadException())
             return (result);
@@ -664,7 +664,7 @@ JSValue JSC_HOST_CALL arrayProtoFuncSlice(ExecState* exec)
     // We return a new array
     JSArray* resObj = constructEmptyArray(exec);
     JSValue result = resObj;
-    JSLabel resLabel = JSLabel(JSLabel::argLabel[0]).Join(JSLabel::argLabel[1]).Join(JSLabel::argLabel[2]);
+    JSLabel resLabel = exec->thisLabel().Join(exec->argumentLabel(0)).Join(exec->argumentLabel(1));
     
     unsigned begin = argumentClampedIndexFromStartOrEnd(exec, 0, length);
     unsigned end = argumentClampedIndexFromStartOrEnd(exec, 1, length, length);
@@ -695,7 +695,7 @@ JSValue JSC_HOST_CALL arrayProtoFuncSort(ExecState* exec)
         return (thisObj);
 
     JSValue function = exec->argument(0);
-    JSLabel resLabel = JSLabel(JSLabel::argLabel[0]);
+    JSLabel resLabel = exec->thisLabel();
     JSValue result = jsUndefined();
 
     CallData callData;
@@ -766,10 +766,10 @@ JSValue JSC_HOST_CALL arrayProtoFuncSplice(ExecState* exec)
     // 15.4.4.12
     // IFC4BC
     JSObject* thisObj = exec->hostThisValue().toObject(exec);
-    if (!JSLabel(JSLabel::pcGlobalLabel).NSU(thisObj->getObjectLabel()))
+    if (!JSLabel(exec->ifcContext().pcGlobalLabel).NSU(thisObj->getObjectLabel()))
     {
         // printf("IFC check in array-Splice failed\n");
-        JSLabel::ABORT_FLAG = true;
+        exec->ifcContext().abortFlag = true;
         // return jsUndefined();
     }
     unsigned length = thisObj->get(exec, exec->propertyNames().length).toUInt32(exec);
@@ -831,10 +831,10 @@ JSValue JSC_HOST_CALL arrayProtoFuncUnShift(ExecState* exec)
     // 15.4.4.13
     // IFC4BC
     JSObject* thisObj = exec->hostThisValue().toObject(exec);
-    if (!JSLabel(JSLabel::pcGlobalLabel).NSU(thisObj->getObjectLabel()))
+    if (!JSLabel(exec->ifcContext().pcGlobalLabel).NSU(thisObj->getObjectLabel()))
     {
         // printf("IFC check in array-UnShift failed\n");
-        JSLabel::ABORT_FLAG = true;
+        exec->ifcContext().abortFlag = true;
         // return jsUndefined();
     }
     unsigned length = thisObj->get(exec, exec->propertyNames().length).toUInt32(exec);
@@ -1317,13 +1317,13 @@ JSValue JSC_HOST_CALL arrayProtoFuncIndexOf(ExecState* exec)
             continue;
         if (JSValue::strictEqual(exec, searchElement, e)) {
             ret = (jsNumber(index));
-            ret.setValueLabel(searchElement.joinValueLabel(JSLabel::argLabel[0]).Join(eLabel));
+            ret.setValueLabel(searchElement.joinValueLabel(exec->thisLabel()).Join(eLabel));
             return ret;
         }
     }
 
     ret = (jsNumber(-1));
-    ret.setValueLabel(searchElement.joinValueLabel(JSLabel::argLabel[0]).Join(eLabel));
+    ret.setValueLabel(searchElement.joinValueLabel(exec->thisLabel()).Join(eLabel));
     return ret;
 }
 
@@ -1336,7 +1336,7 @@ JSValue JSC_HOST_CALL arrayProtoFuncLastIndexOf(ExecState* exec)
     JSValue ret;
     if (!length) {
         ret = (jsNumber(-1));
-        ret.setValueLabel(JSLabel(JSLabel::argLabel[0]).Join(JSLabel(JSLabel::argLabel[1]).Join(JSLabel::argLabel[2])));
+        ret.setValueLabel(exec->thisLabel().Join(exec->argumentLabel(0).Join(exec->argumentLabel(1))));
         return ret;
     }
 
@@ -1348,7 +1348,7 @@ JSValue JSC_HOST_CALL arrayProtoFuncLastIndexOf(ExecState* exec)
             fromDouble += length;
             if (fromDouble < 0) {
                 ret = (jsNumber(-1));
-                ret.setValueLabel(JSLabel(JSLabel::argLabel[0]).Join(JSLabel(JSLabel::argLabel[1]).Join(JSLabel::argLabel[2])));
+                ret.setValueLabel(exec->thisLabel().Join(exec->argumentLabel(0).Join(exec->argumentLabel(1))));
                 return ret;
             }
         }
@@ -1367,13 +1367,13 @@ JSValue JSC_HOST_CALL arrayProtoFuncLastIndexOf(ExecState* exec)
             continue;
         if (JSValue::strictEqual(exec, searchElement, e)) {
             ret = (jsNumber(index));
-            ret.setValueLabel(JSLabel(JSLabel::argLabel[0]).Join(JSLabel(JSLabel::argLabel[1]).Join(JSLabel::argLabel[2])).Join(eLabel));
+            ret.setValueLabel(exec->thisLabel().Join(exec->argumentLabel(0).Join(exec->argumentLabel(1))).Join(eLabel));
             return ret;
         }
     } while (index--);
 
     ret = (jsNumber(-1));
-    ret.setValueLabel(JSLabel(JSLabel::argLabel[0]).Join(JSLabel(JSLabel::argLabel[1]).Join(JSLabel::argLabel[2])).Join(eLabel));
+    ret.setValueLabel(exec->thisLabel().Join(exec->argumentLabel(0).Join(exec->argumentLabel(1))).Join(eLabel));
     thisObj->setObjectLabel(thisObj->joinObjectLabel(ret.getValueLabel()));
     return ret;
 }
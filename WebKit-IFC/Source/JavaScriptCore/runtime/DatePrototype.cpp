@@ -491,7 +491,7 @@ JSValue JSC_HOST_CALL dateProtoFuncToString(ExecState* exec)
 
     const GregorianDateTime* gregorianDateTime = thisDateObj->gregorianDateTime(exec);
     result = (jsNontrivialString(exec, "Invalid Date"));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     if (!gregorianDateTime)
         return result;
     DateConversionBuffer date;
@@ -499,7 +499,7 @@ JSValue JSC_HOST_CALL dateProtoFuncToString(ExecState* exec)
     formatDate(*gregorianDateTime, date);
     formatTime(*gregorianDateTime, time);
     result = (jsMakeNontrivialString(exec, date, " ", time));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 }
 
@@ -515,7 +515,7 @@ JSValue JSC_HOST_CALL dateProtoFuncToUTCString(ExecState* exec)
 
     const GregorianDateTime* gregorianDateTime = thisDateObj->gregorianDateTimeUTC(exec);
     result = (jsNontrivialString(exec, "Invalid Date"));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     if (!gregorianDateTime)
         return result;
     DateConversionBuffer date;
@@ -523,7 +523,7 @@ JSValue JSC_HOST_CALL dateProtoFuncToUTCString(ExecState* exec)
     formatDateUTCVariant(*gregorianDateTime, date);
     formatTimeUTC(*gregorianDateTime, time);
     result =  (jsMakeNontrivialString(exec, date, " ", time));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 }
 
@@ -537,13 +537,13 @@ JSValue JSC_HOST_CALL dateProtoFuncToISOString(ExecState* exec)
     
     DateInstance* thisDateObj = asDateInstance(thisValue); 
     result = throwVMError(exec, createRangeError(exec, "Invalid Date"));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     if (!isfinite(thisDateObj->internalNumber()))
         return result;
 
     const GregorianDateTime* gregorianDateTime = thisDateObj->gregorianDateTimeUTC(exec);
     result = (jsNontrivialString(exec, "Invalid Date"));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     if (!gregorianDateTime)
         return result;
     // Maximum amount of space we need in buffer: 7 (max. digits in year) + 2 * 5 (2 characters each for month, day, hour, minute, second) + 4 (. + 3 digits for milliseconds)
@@ -559,7 +559,7 @@ JSValue JSC_HOST_CALL dateProtoFuncToISOString(ExecState* exec)
         snprintf(buffer, sizeof(buffer) - 1, "%04d-%02d-%02dT%02d:%02d:%02d.%03dZ", 1900 + gregorianDateTime->year, gregorianDateTime->month + 1, gregorianDateTime->monthDay, gregorianDateTime->hour, gregorianDateTime->minute, gregorianDateTime->second, ms);
     buffer[sizeof(buffer) - 1] = 0;
     result = (jsNontrivialString(exec, buffer));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 }
 
@@ -575,13 +575,13 @@ JSValue JSC_HOST_CALL dateProtoFuncToDateString(ExecState* exec)
 
     const GregorianDateTime* gregorianDateTime = thisDateObj->gregorianDateTime(exec);
     result = (jsNontrivialString(exec, "Invalid Date"));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     if (!gregorianDateTime)
         return result;
     DateConversionBuffer date;
     formatDate(*gregorianDateTime, date);
     result = (jsNontrivialString(exec, date));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 }
 
@@ -601,7 +601,7 @@ JSValue JSC_HOST_CALL dateProtoFuncToTimeString(ExecState* exec)
     DateConversionBuffer time;
     formatTime(*gregorianDateTime, time);
     result = (jsNontrivialString(exec, time));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 }
 
@@ -615,7 +615,7 @@ JSValue JSC_HOST_CALL dateProtoFuncToLocaleString(ExecState* exec)
 
     DateInstance* thisDateObj = asDateInstance(thisValue); 
     result = (formatLocaleDate(exec, thisDateObj, thisDateObj->internalNumber(), LocaleDateAndTime));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 
 }
@@ -630,7 +630,7 @@ JSValue JSC_HOST_CALL dateProtoFuncToLocaleDateString(ExecState* exec)
 
     DateInstance* thisDateObj = asDateInstance(thisValue); 
     result = (formatLocaleDate(exec, thisDateObj, thisDateObj->internalNumber(), LocaleDate));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 }
 
@@ -644,7 +644,7 @@ JSValue JSC_HOST_CALL dateProtoFuncToLocaleTimeString(ExecState* exec)
 
     DateInstance* thisDateObj = asDateInstance(thisValue); 
     result = (formatLocaleDate(exec, thisDateObj, thisDateObj->internalNumber(), LocaleTime));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 }
 
@@ -657,7 +657,7 @@ JSValue JSC_HOST_CALL dateProtoFuncGetTime(ExecState* exec)
         return throwVMTypeError(exec);
 
     result = (asDateInstance(thisValue)->internalValue());
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 }
 
@@ -676,7 +676,7 @@ JSValue JSC_HOST_CALL dateProtoFuncGetFullYear(ExecState* exec)
         result = (jsNaN());
     else
         result = (jsNumber(1900 + gregorianDateTime->year));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 }
 
@@ -695,7 +695,7 @@ JSValue JSC_HOST_CALL dateProtoFuncGetUTCFullYear(ExecState* exec)
         result = (jsNaN());
     else
         result = (jsNumber(1900 + gregorianDateTime->year));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 }
 
@@ -711,7 +711,7 @@ JSValue JSC_HOST_CALL dateProtoFuncToGMTString(ExecState* exec)
 
     const GregorianDateTime* gregorianDateTime = thisDateObj->gregorianDateTimeUTC(exec);
     result = (jsNontrivialString(exec, "Invalid Date"));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     if (!gregorianDateTime)
         return result;
     DateConversionBuffer date;
@@ -719,7 +719,7 @@ JSValue JSC_HOST_CALL dateProtoFuncToGMTString(ExecState* exec)
     formatDateUTCVariant(*gregorianDateTime, date);
     formatTimeUTC(*gregorianDateTime, time);
     result = (jsMakeNontrivialString(exec, date, " ", time));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 }
 
@@ -738,7 +738,7 @@ JSValue JSC_HOST_CALL dateProtoFuncGetMonth(ExecState* exec)
         result = (jsNaN());
     else
         result = (jsNumber(gregorianDateTime->month));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 }
 
@@ -757,7 +757,7 @@ JSValue JSC_HOST_CALL dateProtoFuncGetUTCMonth(ExecState* exec)
         result = (jsNaN());
     else
         result = (jsNumber(gregorianDateTime->month));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 }
 
@@ -776,7 +776,7 @@ JSValue JSC_HOST_CALL dateProtoFuncGetDate(ExecState* exec)
         result = (jsNaN());
     else
         result = (jsNumber(gregorianDateTime->monthDay));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 
 }
@@ -796,7 +796,7 @@ JSValue JSC_HOST_CALL dateProtoFuncGetUTCDate(ExecState* exec)
         result = (jsNaN());
     else
         result = (jsNumber(gregorianDateTime->monthDay));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 
 }
@@ -816,7 +816,7 @@ JSValue JSC_HOST_CALL dateProtoFuncGetDay(ExecState* exec)
         result = (jsNaN());
     else
         result = (jsNumber(gregorianDateTime->weekDay));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 
 }
@@ -836,7 +836,7 @@ JSValue JSC_HOST_CALL dateProtoFuncGetUTCDay(ExecState* exec)
         result = (jsNaN());
     else
         result = (jsNumber(gregorianDateTime->weekDay));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 }
 
@@ -855,7 +855,7 @@ JSValue JSC_HOST_CALL dateProtoFuncGetHours(ExecState* exec)
         result = (jsNaN());
     else
         result = (jsNumber(gregorianDateTime->hour));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 }
 
@@ -874,7 +874,7 @@ JSValue JSC_HOST_CALL dateProtoFuncGetUTCHours(ExecState* exec)
         result = (jsNaN());
     else
         result = (jsNumber(gregorianDateTime->hour));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 }
 
@@ -893,7 +893,7 @@ JSValue JSC_HOST_CALL dateProtoFuncGetMinutes(ExecState* exec)
         result = (jsNaN());
     else
         result = (jsNumber(gregorianDateTime->minute));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 }
 
@@ -912,7 +912,7 @@ JSValue JSC_HOST_CALL dateProtoFuncGetUTCMinutes(ExecState* exec)
         result = (jsNaN());
     else
         result = (jsNumber(gregorianDateTime->minute));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 }
 
@@ -931,7 +931,7 @@ JSValue JSC_HOST_CALL dateProtoFuncGetSeconds(ExecState* exec)
         result = (jsNaN());
     else
         result = (jsNumber(gregorianDateTime->second));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 }
 
@@ -950,7 +950,7 @@ JSValue JSC_HOST_CALL dateProtoFuncGetUTCSeconds(ExecState* exec)
         result = (jsNaN());
     else
         result = (jsNumber(gregorianDateTime->second));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 }
 
@@ -971,7 +971,7 @@ JSValue JSC_HOST_CALL dateProtoFuncGetMilliSeconds(ExecState* exec)
         double ms = milli - secs * msPerSecond;
         result = (jsNumber(ms));
     }
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 }
 
@@ -993,7 +993,7 @@ JSValue JSC_HOST_CALL dateProtoFuncGetUTCMilliseconds(ExecState* exec)
         double ms = milli - secs * msPerSecond;
         result = (jsNumber(ms));
     }
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 }
 
@@ -1012,7 +1012,7 @@ JSValue JSC_HOST_CALL dateProtoFuncGetTimezoneOffset(ExecState* exec)
         result = (jsNaN());
     else
         result = (jsNumber(-gregorianDateTime->utcOffset / minutesPerHour));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 }
 
@@ -1029,7 +1029,7 @@ JSValue JSC_HOST_CALL dateProtoFuncSetTime(ExecState* exec)
     double milli = timeClip(exec->argument(0).toNumber(exec));
     result = jsNumber(milli);
     thisDateObj->setInternalValue(exec->globalData(), result);
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return (result);
 }
 
@@ -1042,7 +1042,7 @@ static JSValue setNewValueFromTimeArgs(ExecState* exec, int numArgsToUse, bool i
         JSValue a =  exec->argument(i);
         retLabel = retLabel.Join(a.getValueLabel());
     }
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     if (!thisValue.inherits(&DateInstance::s_info))
         return result;
 
@@ -1050,7 +1050,7 @@ static JSValue setNewValueFromTimeArgs(ExecState* exec, int numArgsToUse, bool i
     double milli = thisDateObj->internalNumber();
     
     result = jsNaN();
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
 
     if (!exec->argumentCount() || isnan(milli)) {
         thisDateObj->setInternalValue(exec->globalData(), result);
@@ -1074,7 +1074,7 @@ static JSValue setNewValueFromTimeArgs(ExecState* exec, int numArgsToUse, bool i
     } 
     
     result = jsNumber(gregorianDateTimeToMS(exec, gregorianDateTime, ms, inputIsUTC));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     thisDateObj->setInternalValue(exec->globalData(), result);
     return (result);
 }
@@ -1088,13 +1088,13 @@ static JSValue setNewValueFromDateArgs(ExecState* exec, int numArgsToUse, bool i
         JSValue a =  exec->argument(i);
         retLabel = retLabel.Join(a.getValueLabel());
     }
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     if (!thisValue.inherits(&DateInstance::s_info))
         return result;
 
     DateInstance* thisDateObj = asDateInstance(thisValue);
     result = jsNaN();
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     if (!exec->argumentCount()) {
         thisDateObj->setInternalValue(exec->globalData(), result);
         return (result);
@@ -1122,7 +1122,7 @@ static JSValue setNewValueFromDateArgs(ExecState* exec, int numArgsToUse, bool i
     } 
            
     result = jsNumber(gregorianDateTimeToMS(exec, gregorianDateTime, ms, inputIsUTC));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     thisDateObj->setInternalValue(exec->globalData(), result);
     return (result);
 }
@@ -1220,7 +1220,7 @@ JSValue JSC_HOST_CALL dateProtoFuncSetYear(ExecState* exec)
         return throwVMTypeError(exec);
 
     result = jsNaN();
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
 
     DateInstance* thisDateObj = asDateInstance(thisValue);     
     if (!exec->argumentCount()) { 
@@ -1252,7 +1252,7 @@ JSValue JSC_HOST_CALL dateProtoFuncSetYear(ExecState* exec)
     gregorianDateTime.year = toInt32((year > 99 || year < 0) ? year - 1900 : year);
     result = jsNumber(gregorianDateTimeToMS(exec, gregorianDateTime, ms, false));
     thisDateObj->setInternalValue(exec->globalData(), result);
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return (result);
 }
 
@@ -1271,7 +1271,7 @@ JSValue JSC_HOST_CALL dateProtoFuncGetYear(ExecState* exec)
         result = (jsNaN());
     else
         result = (jsNumber(gregorianDateTime->year));
-    result.setValueLabel(retLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+    result.setValueLabel(retLabel.Join(JSLabel(exec->ifcContext().pcGlobalLabel)));
     return result;
 
     // NOTE: IE returns the full year even in getYear.
@@ -26,14 +26,19 @@
 #include "config.h"
 #include "Executable.h"
 
+#include "AnalysisQueue.h"
 #include "BytecodeGenerator.h"
 #include "CodeBlock.h"
 #include "DFGDriver.h"
 #include "ExecutionHarness.h"
+#include "Interpreter.h"
 #include "JIT.h"
 #include "JITDriver.h"
+#include "JSFunction.h"
+#include "Options.h"
 #include "Parser.h"
 #include "UStringBuilder.h"
+#include <wtf/HashSet.h>
 #include <wtf/Vector.h>
 
 namespace JSC {
@@ -319,6 +324,84 @@ bool ProgramExecutable::jitCompile(ExecState* exec)
 }
 #endif
 
+// IFC4BC - Whole-script analysis. Compiles the functions a script declares
+// as it loads, so the AnalysisQueue workers can start on them before they
+// are first called. Only top-level declarations are known to close over the
+// scope chain the script is compiled in.
+
+static FunctionExecutable* declaredFunction(JSValue value, const HashSet<FunctionExecutable*>& declared)
+{
+    JSFunction* function = jsDynamicCast<JSFunction*>(value);
+    if (!function || function->isHostFunction() || !declared.contains(function->jsExecutable()))
+        return 0;
+    return function->jsExecutable();
+}
+
+// Appends the declared functions codeBlock names, through a global resolve
+// or a global variable read, that are not in referenced yet.
+static void addReferencedFunctions(CodeBlock* codeBlock, JSGlobalObject* globalObject, const HashSet<FunctionExecutable*>& declared, HashSet<FunctionExecutable*>& referenced, Vector<FunctionExecutable*>& order)
+{
+    for (size_t i = 0; i < codeBlock->numberOfIdentifiers(); ++i) {
+        SymbolTableEntry entry = globalObject->symbolTable().get(codeBlock->identifier(i).impl());
+        if (entry.isNull())
+            continue;
+        FunctionExecutable* executable = declaredFunction(globalObject->registerAt(entry.getIndex()).get(), declared);
+        if (executable && referenced.add(executable).isNewEntry)
+            order.append(executable);
+    }
+
+    Interpreter* interpreter = codeBlock->globalData()->interpreter;
+    Instruction* begin = codeBlock->instructions().begin();
+    size_t count = codeBlock->instructions().size();
+    for (size_t pos = 0; pos < count; ) {
+        OpcodeID opcode = interpreter->getOpcodeID(begin[pos].u.opcode);
+        if (opcode == op_get_global_var || opcode == op_get_global_var_watchable) {
+            FunctionExecutable* executable = declaredFunction(begin[pos + 2].u.registerPointer->get(), declared);
+            if (executable && referenced.add(executable).isNewEntry)
+                order.append(executable);
+        }
+        pos += opcodeLengths[opcode];
+    }
+}
+
+static void compileDeclaredFunctions(ExecState* exec, ScopeChainNode* scopeChainNode, ProgramNode* programNode, CodeBlock* programCodeBlock)
+{
+    JSGlobalObject* globalObject = scopeChainNode->globalObject.get();
+    const DeclarationStacks::FunctionStack& functionStack = programNode->functionStack();
+    HashSet<FunctionExecutable*> declared;
+    Vector<FunctionExecutable*> declarationOrder;
+    for (size_t i = 0; i < functionStack.size(); ++i) {
+        SymbolTableEntry entry = globalObject->symbolTable().get(functionStack[i]->ident().impl());
+        if (entry.isNull())
+            continue;
+        JSFunction* function = jsDynamicCast<JSFunction*>(globalObject->registerAt(entry.getIndex()).get());
+        if (function && !function->isHostFunction() && declared.add(function->jsExecutable()).isNewEntry)
+            declarationOrder.append(function->jsExecutable());
+    }
+    if (declared.isEmpty())
+        return;
+
+    // Breadth first from the top-level code, so the functions it calls
+    // directly are queued before the ones they call.
+    HashSet<FunctionExecutable*> referenced;
+    Vector<FunctionExecutable*> order;
+    addReferencedFunctions(programCodeBlock, globalObject, declared, referenced, order);
+    for (size_t i = 0; i < order.size(); ++i) {
+        // A function that fails to compile reports it when it is called.
+        if (order[i]->compileForCall(exec, scopeChainNode))
+            continue;
+        CodeBlock* codeBlock = &order[i]->generatedBytecodeForCall();
+        AnalysisQueue::enqueue(codeBlock, AnalysisQueue::Referenced);
+        addReferencedFunctions(codeBlock, globalObject, declared, referenced, order);
+    }
+
+    for (size_t i = 0; i < declarationOrder.size(); ++i) {
+        if (referenced.contains(declarationOrder[i]) || declarationOrder[i]->compileForCall(exec, scopeChainNode))
+            continue;
+        AnalysisQueue::enqueue(&declarationOrder[i]->generatedBytecodeForCall(), AnalysisQueue::Unreferenced);
+    }
+}
+
 JSObject* ProgramExecutable::compileInternal(ExecState* exec, ScopeChainNode* scopeChainNode, JITCode::JITType jitType)
 {
     SamplingRegion samplingRegion(samplingDescription(jitType));
@@ -372,6 +455,8 @@ JSObject* ProgramExecutable::compileInternal(ExecState* exec, ScopeChainNode* sc
 //        }
          
         // --------------------------------------- 
+        if (AnalysisQueue::isEnabled() && Options::ifcAnalyzeWholeScript())
+            compileDeclaredFunctions(exec, scopeChainNode, programNode.get(), m_programCodeBlock.get());
         programNode->destroyData();
         m_programCodeBlock->copyPostParseDataFromAlternative();
     }
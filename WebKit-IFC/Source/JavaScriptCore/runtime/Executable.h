@@ -297,6 +297,7 @@ namespace JSC {
         const SourceCode& source() { return m_source; }
         intptr_t sourceID() const { return m_source.providerID(); }
         const UString& sourceURL() const { return m_source.provider()->url(); }
+        JSLabel sourceLabel() const { return m_source.provider()->sourceLabel(); }
         int lineNo() const { return m_firstLine; }
         int lastLine() const { return m_lastLine; }
 
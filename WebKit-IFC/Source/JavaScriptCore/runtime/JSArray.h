@@ -240,7 +240,7 @@ namespace JSC {
             ASSERT(i < storage->m_numValuesInVector);
             
             // IFC4BC - Set the value's label to the current pc
-            v.setValueLabel(v.joinValueLabel(JSLabel(JSLabel::pcGlobalLabel)));
+            v.setValueLabel(v.joinValueLabel(JSLabel(globalData.ifcContext->pcGlobalLabel)));
             storage->m_vector[i].set(globalData, this, v);
         }
 
@@ -393,7 +393,7 @@ namespace JSC {
         JSGlobalData& globalData = exec->globalData();
         unsigned length = values.size();
         JSArray* array = JSArray::tryCreateUninitialized(globalData, arrayStructure, length);
-        JSLabel arrayLabel = JSLabel(JSLabel::pcGlobalLabel);
+        JSLabel arrayLabel = JSLabel(globalData.ifcContext->pcGlobalLabel);
 
         // FIXME: we should probably throw an out of memory error here, but
         // when making this change we should check that all clients of this
@@ -415,7 +415,7 @@ namespace JSC {
     {
         JSGlobalData& globalData = exec->globalData();
         JSArray* array = JSArray::tryCreateUninitialized(globalData, arrayStructure, length);
-        JSLabel arrayLabel = JSLabel(JSLabel::pcGlobalLabel);
+        JSLabel arrayLabel = JSLabel(globalData.ifcContext->pcGlobalLabel);
 
         // FIXME: we should probably throw an out of memory error here, but
         // when making this change we should check that all clients of this
@@ -209,10 +209,10 @@ namespace JSC {
         ASSERT(m_structure);
         
         // IFC4BC -- Initializing the label to global pc label
-        if (JSLabel::pcGlobalLabel.clabel == 1)
+        if (globalData.ifcContext->pcGlobalLabel.clabel == 1)
             structureLabel = JSLabel();
         else
-            structureLabel = JSLabel(JSLabel::pcGlobalLabel) ;
+            structureLabel = JSLabel(globalData.ifcContext->pcGlobalLabel) ;
     }
 
     // IFC4BC -----------Vineet - Instrumentation----------- //
@@ -37,6 +37,7 @@
 #include "GCActivityCallback.h"
 #include "GetterSetter.h"
 #include "HostCallReturnValue.h"
+#include "IFCContext.h"
 #include "IncrementalSweeper.h"
 #include "Interpreter.h"
 #include "JSActivation.h"
@@ -143,6 +144,7 @@ JSGlobalData::JSGlobalData(GlobalDataType globalDataType, ThreadStackType thread
     , stringTable(fastNew<HashTable>(JSC::stringTable))
     , stringConstructorTable(fastNew<HashTable>(JSC::stringConstructorTable))
     , identifierTable(globalDataType == Default ? wtfThreadData().currentIdentifierTable() : createIdentifierTable())
+    , ifcContext(globalDataType == Default ? &IFCContext::threadDefault() : new IFCContext)
     , propertyNames(new CommonIdentifiers(this))
     , emptyList(new MarkedArgumentBuffer)
 #if ENABLE(ASSEMBLER)
@@ -277,8 +279,10 @@ JSGlobalData::~JSGlobalData()
     delete emptyList;
 
     delete propertyNames;
-    if (globalDataType != Default)
+    if (globalDataType != Default) {
         deleteIdentifierTable(identifierTable);
+        delete ifcContext;
+    }
 
     delete clientData;
     delete m_regExpCache;
@@ -63,6 +63,7 @@ namespace JSC {
     class CodeBlock;
     class CommonIdentifiers;
     class HandleStack;
+    class IFCContext;
     class IdentifierTable;
     class Interpreter;
     class JSGlobalObject;
@@ -233,6 +234,7 @@ namespace JSC {
         Strong<Structure> structureChainStructure;
 
         IdentifierTable* identifierTable;
+        IFCContext* ifcContext; // IFC4BC - the pc and argument labels; shared like identifierTable
         CommonIdentifiers* propertyNames;
         const MarkedArgumentBuffer* emptyList; // Lists are supposed to be allocated on the stack to have their elements properly marked, which is not the case here - but this list has nothing to mark.
         SmallStrings smallStrings;
@@ -939,12 +939,12 @@ inline bool JSObject::putDirectInternalIFC(JSGlobalData& globalData, PropertyNam
 
             // IFC4BC - This check is already done before coming here, but done here for direct cases
             
-            if (!(JSLabel(JSLabel::pcGlobalLabel)).NSU(this->getObjectLabel())) {
+            if (!(JSLabel(globalData.ifcContext->pcGlobalLabel)).NSU(this->getObjectLabel())) {
                 *abortRun = true;
                 // return true;
             }
             JSLabel valLabel = value.getValueLabel();
-            value.setValueLabel(valLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+            value.setValueLabel(valLabel.Join(JSLabel(globalData.ifcContext->pcGlobalLabel)));
             
             putDirectOffset(globalData, offset, value);
             // At this point, the objects structure only has a specific value set if previously there
@@ -1027,12 +1027,12 @@ inline bool JSObject::putDirectInternalIFC(JSGlobalData& globalData, PropertyNam
         
         // IFC4BC - If the existing property contains a label, then keep this, else make it zero.
         
-        if (!(JSLabel(JSLabel::pcGlobalLabel)).NSU(this->getObjectLabel())) {
+        if (!(JSLabel(globalData.ifcContext->pcGlobalLabel)).NSU(this->getObjectLabel())) {
             *abortRun = true;
             // return true;
         }
         JSLabel valLabel = value.getValueLabel();
-        value.setValueLabel(valLabel.Join(JSLabel(JSLabel::pcGlobalLabel)));
+        value.setValueLabel(valLabel.Join(JSLabel(globalData.ifcContext->pcGlobalLabel)));
 
         if (currentSpecificFunction) {
             // case (1) Do the put, then return leaving the slot uncachable.
@@ -123,7 +123,7 @@ JSValue JSC_HOST_CALL mathProtoFuncAbs(ExecState* exec)
     JSValue thisValue = exec->hostThisValue();
     JSValue a0 = exec->argument(0);
     JSValue ret = (jsNumber(fabs(a0.toNumber(exec))));
-    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel().Join(JSLabel(JSLabel::pcGlobalLabel) )));
+    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel().Join(JSLabel(exec->ifcContext().pcGlobalLabel) )));
     return ret;
 }
 
@@ -132,7 +132,7 @@ JSValue JSC_HOST_CALL mathProtoFuncACos(ExecState* exec)
     JSValue thisValue = exec->hostThisValue();
     JSValue a0 = exec->argument(0);
     JSValue ret = (jsDoubleNumber(acos(a0.toNumber(exec))));
-    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel().Join(JSLabel(JSLabel::pcGlobalLabel) )));
+    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel().Join(JSLabel(exec->ifcContext().pcGlobalLabel) )));
     return ret;
 }
 
@@ -141,7 +141,7 @@ JSValue JSC_HOST_CALL mathProtoFuncASin(ExecState* exec)
     JSValue thisValue = exec->hostThisValue();
     JSValue a0 = exec->argument(0);
     JSValue ret = (jsDoubleNumber(asin(a0.toNumber(exec))));
-    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel().Join(JSLabel(JSLabel::pcGlobalLabel) )));
+    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel().Join(JSLabel(exec->ifcContext().pcGlobalLabel) )));
     return ret;
 }
 
@@ -150,7 +150,7 @@ JSValue JSC_HOST_CALL mathProtoFuncATan(ExecState* exec)
     JSValue thisValue = exec->hostThisValue();
     JSValue a0 = exec->argument(0);
     JSValue ret = (jsDoubleNumber(atan(a0.toNumber(exec))));
-    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel().Join(JSLabel(JSLabel::pcGlobalLabel) )));
+    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel().Join(JSLabel(exec->ifcContext().pcGlobalLabel) )));
     return ret;
 }
 
@@ -171,7 +171,7 @@ JSValue JSC_HOST_CALL mathProtoFuncCeil(ExecState* exec)
     JSValue thisValue = exec->hostThisValue();
     JSValue a0 = exec->argument(0);
     JSValue ret = (jsNumber(ceil(a0.toNumber(exec))));
-    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel().Join(JSLabel(JSLabel::pcGlobalLabel) )));
+    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel().Join(JSLabel(exec->ifcContext().pcGlobalLabel) )));
     return ret;
 }
 
@@ -180,7 +180,7 @@ JSValue JSC_HOST_CALL mathProtoFuncCos(ExecState* exec)
     JSValue thisValue = exec->hostThisValue();
     JSValue a0 = exec->argument(0);
     JSValue ret = (jsDoubleNumber(cos(a0.toNumber(exec))));
-    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel().Join(JSLabel(JSLabel::pcGlobalLabel) )));
+    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel().Join(JSLabel(exec->ifcContext().pcGlobalLabel) )));
     return ret;
 }
 
@@ -189,7 +189,7 @@ JSValue JSC_HOST_CALL mathProtoFuncExp(ExecState* exec)
     JSValue thisValue = exec->hostThisValue();
     JSValue a0 = exec->argument(0);
     JSValue ret = (jsDoubleNumber(exp(a0.toNumber(exec))));
-    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel().Join(JSLabel(JSLabel::pcGlobalLabel))));
+    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel().Join(JSLabel(exec->ifcContext().pcGlobalLabel))));
     return ret;
 }
 
@@ -198,7 +198,7 @@ JSValue JSC_HOST_CALL mathProtoFuncFloor(ExecState* exec)
     JSValue thisValue = exec->hostThisValue();
     JSValue a0 = exec->argument(0);
     JSValue ret = (jsNumber(floor(a0.toNumber(exec))));
-    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel().Join(JSLabel(JSLabel::pcGlobalLabel) )));
+    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel().Join(JSLabel(exec->ifcContext().pcGlobalLabel) )));
     return ret;
 }
 
@@ -207,7 +207,7 @@ JSValue JSC_HOST_CALL mathProtoFuncLog(ExecState* exec)
     JSValue thisValue = exec->hostThisValue();
     JSValue a0 = exec->argument(0);
     JSValue ret = (jsDoubleNumber(log(a0.toNumber(exec))));
-    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel().Join(JSLabel(JSLabel::pcGlobalLabel) )));
+    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel().Join(JSLabel(exec->ifcContext().pcGlobalLabel) )));
     return ret;
 }
 
@@ -229,7 +229,7 @@ JSValue JSC_HOST_CALL mathProtoFuncMax(ExecState* exec)
             result = val;
     }
     JSValue res = (jsNumber(result));
-    res.setValueLabel(thisValue.joinValueLabel(retLabel).Join(JSLabel(JSLabel::pcGlobalLabel) ));
+    res.setValueLabel(thisValue.joinValueLabel(retLabel).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
     return res;
 }
 
@@ -251,7 +251,7 @@ JSValue JSC_HOST_CALL mathProtoFuncMin(ExecState* exec)
             result = val;
     }
     JSValue res = (jsNumber(result));
-    res.setValueLabel(thisValue.joinValueLabel(retLabel).Join(JSLabel(JSLabel::pcGlobalLabel) ));
+    res.setValueLabel(thisValue.joinValueLabel(retLabel).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
     return res;
 }
 
@@ -299,7 +299,7 @@ JSValue JSC_HOST_CALL mathProtoFuncPow(ExecState* exec)
     JSValue a0 = exec->argument(0);
     JSValue a1 = exec->argument(1);
     JSValue result =  jsNaN();
-    JSLabel retLabel = thisValue.joinValueLabel(a0.joinValueLabel(a1.getValueLabel()).Join(JSLabel(JSLabel::pcGlobalLabel) ));
+    JSLabel retLabel = thisValue.joinValueLabel(a0.joinValueLabel(a1.getValueLabel()).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
     result.setValueLabel(retLabel);
     
     double arg = a0.toNumber(exec);
@@ -318,7 +318,7 @@ JSValue JSC_HOST_CALL mathProtoFuncRandom(ExecState* exec)
 {
     JSValue thisValue = exec->hostThisValue();
     JSValue result = (jsDoubleNumber(exec->lexicalGlobalObject()->weakRandomNumber()));
-    result.setValueLabel(thisValue.getValueLabel().Join(JSLabel(JSLabel::pcGlobalLabel) ));
+    result.setValueLabel(thisValue.getValueLabel().Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
     return result;
 }
 
@@ -329,7 +329,7 @@ JSValue JSC_HOST_CALL mathProtoFuncRound(ExecState* exec)
     double arg = a0.toNumber(exec);
     double integer = ceil(arg);
     JSValue ret = (jsNumber(integer - (integer - arg > 0.5)));
-    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel().Join(JSLabel(JSLabel::pcGlobalLabel) )));
+    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel().Join(JSLabel(exec->ifcContext().pcGlobalLabel) )));
     return ret;
 }
 
@@ -338,7 +338,7 @@ JSValue JSC_HOST_CALL mathProtoFuncSin(ExecState* exec)
     JSValue thisValue = exec->hostThisValue();
     JSValue a0 = exec->argument(0);
     JSValue ret = (exec->globalData().cachedSin(a0.toNumber(exec)));
-    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel().Join(JSLabel(JSLabel::pcGlobalLabel) )));
+    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel().Join(JSLabel(exec->ifcContext().pcGlobalLabel) )));
     return ret;
 }
 
@@ -347,7 +347,7 @@ JSValue JSC_HOST_CALL mathProtoFuncSqrt(ExecState* exec)
     JSValue thisValue = exec->hostThisValue();
     JSValue a0 = exec->argument(0);
     JSValue ret = (jsDoubleNumber(sqrt(a0.toNumber(exec))));
-    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel().Join(JSLabel(JSLabel::pcGlobalLabel) )));
+    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel().Join(JSLabel(exec->ifcContext().pcGlobalLabel) )));
     return ret;
 }
 
@@ -356,7 +356,7 @@ JSValue JSC_HOST_CALL mathProtoFuncTan(ExecState* exec)
     JSValue thisValue = exec->hostThisValue();
     JSValue a0 = exec->argument(0);
     JSValue ret = (jsDoubleNumber(tan(a0.toNumber(exec))));
-    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel().Join(JSLabel(JSLabel::pcGlobalLabel) )));
+    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel().Join(JSLabel(exec->ifcContext().pcGlobalLabel) )));
     return ret;
 }
 
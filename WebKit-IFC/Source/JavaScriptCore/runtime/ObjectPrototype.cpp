@@ -285,10 +285,10 @@ JSValue JSC_HOST_CALL objectProtoFuncSetLabel(ExecState* exec)
     JSValue temp = exec->argument(0);
     JSLabel setLabel;
     // JSLabel funcLabel = asObject(thisValue)->getObjectLabel();
-    if (JSLabel::pcGlobalLabel.clabel==1)
+    if (exec->ifcContext().pcGlobalLabel.clabel==1)
     {
         if (strcmp(temp.toUString(exec).utf8().data(), "HOST") == 0)
-            setLabel = JSLabel(URLMap::urlmap().getLabel(exec->codeBlock()->source()->url().utf8().data()));
+            setLabel = exec->codeBlock()->source()->sourceLabel();
         else
             setLabel = JSLabel(URLMap::urlmap().getLabel(temp.toUString(exec).utf8().data()));
         // printf("This is policy. Setting label\n");
@@ -329,14 +329,14 @@ JSValue JSC_HOST_CALL objectProtoFuncSetLabel(ExecState* exec)
 JSValue JSC_HOST_CALL objectProtoFuncUpgrade(ExecState* exec)
 {
     JSValue thisValue = exec->hostThisValue();
-    if (!JSLabel(JSLabel::pcGlobalLabel).NSU(thisValue.getValueLabel())) {
+    if (!JSLabel(exec->ifcContext().pcGlobalLabel).NSU(thisValue.getValueLabel())) {
         printf("IFC: Value upgrade in high context\n");
-        JSLabel::ABORT_FLAG = true;
+        exec->ifcContext().abortFlag = true;
         return jsUndefined();
     }
     
     // Use the source from the codeblock to get the label
-    JSLabel funcLabel = JSLabel(URLMap::urlmap().getLabel(exec->codeBlock()->source()->url().utf8().data())) ;
+    JSLabel funcLabel = exec->codeBlock()->source()->sourceLabel();
     // funcLabel.pLabel = thisValue.getValueLabel().pLabel;
     // funcLabel.setiVal(thisValue.getValueLabel().iVal());
     thisValue.setValueLabel(funcLabel);
@@ -350,7 +350,7 @@ JSValue JSC_HOST_CALL objectProtoFuncUpgrade(ExecState* exec)
 // TODO - Add the functionality
 JSValue JSC_HOST_CALL objectProtoFuncSetContext(ExecState* exec)
 {
-    if (JSLabel::pcGlobalLabel.clabel == 1)
+    if (exec->ifcContext().pcGlobalLabel.clabel == 1)
     {
         JSLabel labelVal;
         size_t argCount = exec->argumentCount();
@@ -360,13 +360,13 @@ JSValue JSC_HOST_CALL objectProtoFuncSetContext(ExecState* exec)
             labelVal = JSLabel(URLMap::urlmap().getLabel(curArg.toUString(exec).utf8().data()));
             // If null is set then ignore other contexts.
             if (labelVal.Val() == 0) {
-                JSLabel::eventContextLabel.clabel = 0;
+                exec->ifcContext().eventContextLabel.clabel = 0;
                 break;
             }
-            if (JSLabel::eventContextLabel.clabel == 1)
-                JSLabel::eventContextLabel.clabel = labelVal.Val();
+            if (exec->ifcContext().eventContextLabel.clabel == 1)
+                exec->ifcContext().eventContextLabel.clabel = labelVal.Val();
             else
-                JSLabel::eventContextLabel.clabel |= labelVal.Val();
+                exec->ifcContext().eventContextLabel.clabel |= labelVal.Val();
             if (++i == argCount) {
                 break;
             }
@@ -116,7 +116,25 @@ namespace JSC {
     v(unsigned, opaqueRootMergeThreshold, 1000) \
     \
     v(bool, forceWeakRandomSeed, false) \
-    v(unsigned, forcedWeakRandomSeed, 0)
+    v(unsigned, forcedWeakRandomSeed, 0) \
+    \
+    /* IFC event trace verbosity; see label/IFCTrace.h. */ \
+    v(unsigned, ifcTraceLevel, 1) \
+    /* Per-CodeBlock IFC counters; see label/IFCStats.h. */ \
+    v(bool, ifcStats, false) \
+    /* Post-dominator engine for the IFC analysis; see analysis/PostDominators.h. */ \
+    v(unsigned, ifcPostDominators, 1) \
+    v(bool, ifcCheckPostDominators, false) \
+    /* Check the containsLoop bits from the prefix counts against a scan; see FlowGraph::checkLoop. */ \
+    v(bool, ifcCheckLoops, false) \
+    /* Megabytes for the JSC_IFC_ANALYSIS_CACHE file; see analysis/AnalysisCache.h. */ \
+    v(unsigned, ifcAnalysisCacheSize, 64) \
+    /* Worker threads for the IFC static analysis; see analysis/AnalysisQueue.h. */ \
+    v(unsigned, ifcAnalysisThreads, 2) \
+    /* Compile a script's declared functions as it loads and queue them for analysis; off, so unlabelled code pays nothing. */ \
+    v(bool, ifcAnalyzeWholeScript, false) \
+    /* Track labels in full and trace label-free mispredictions; see analysis/LabelFreeAnalysis.h. */ \
+    v(bool, ifcCheckLabelFree, false)
 
 
 class Options {
@@ -678,16 +678,16 @@ JSValue JSC_HOST_CALL stringProtoFuncReplace(ExecState* exec)
 
     if (searchValue.inherits(&RegExpObject::s_info)) {
         ret = replaceUsingRegExpSearch(exec, string, searchValue);
-        ret.setValueLabel(thisValue.joinValueLabel(searchValue.joinValueLabel(JSLabel(JSLabel::argLabel[2])).Join(JSLabel(JSLabel::pcGlobalLabel) )));
+        ret.setValueLabel(thisValue.joinValueLabel(searchValue.joinValueLabel(exec->argumentLabel(1)).Join(JSLabel(exec->ifcContext().pcGlobalLabel) )));
         // Set the object label of the cell contained in ret to the same value.
         if (ret.isCell())
-            ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel(JSLabel::pcGlobalLabel) ));
+            ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel(exec->ifcContext().pcGlobalLabel) ));
         return ret;
     }
     ret = replaceUsingStringSearch(exec, string, searchValue);
-    ret.setValueLabel(thisValue.joinValueLabel(searchValue.joinValueLabel(JSLabel(JSLabel::argLabel[2])).Join(JSLabel(JSLabel::pcGlobalLabel))));
+    ret.setValueLabel(thisValue.joinValueLabel(searchValue.joinValueLabel(exec->argumentLabel(1)).Join(JSLabel(exec->ifcContext().pcGlobalLabel))));
     if (ret.isCell())
-        ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel(JSLabel::pcGlobalLabel) ));
+        ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel(exec->ifcContext().pcGlobalLabel) ));
     return ret;
 }
 
@@ -701,7 +701,7 @@ JSValue JSC_HOST_CALL stringProtoFuncToString(ExecState* exec)
 
     if (thisValue.inherits(&StringObject::s_info)) {
         JSValue ret = (asStringObject(thisValue)->internalValue());
-        ret.setValueLabel(thisValue.getValueLabel().Join(JSLabel(JSLabel::pcGlobalLabel) ));
+        ret.setValueLabel(thisValue.getValueLabel().Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
         return ret;
     }
 
@@ -721,21 +721,21 @@ JSValue JSC_HOST_CALL stringProtoFuncCharAt(ExecState* exec)
         uint32_t i = a0.asUInt32();
         if (i < len) {
             ret = (jsSingleCharacterSubstring(exec, s, i));
-            ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel(JSLabel::pcGlobalLabel) ));
+            ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
             return ret;
         }
         ret = (jsEmptyString(exec));
-        ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel(JSLabel::pcGlobalLabel) ));
+        ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
         return ret;
     }
     double dpos = a0.toInteger(exec);
     if (dpos >= 0 && dpos < len) {
         ret = (jsSingleCharacterSubstring(exec, s, static_cast<unsigned>(dpos)));
-        ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel(JSLabel::pcGlobalLabel) ));
+        ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
         return ret;
     }
     ret = (jsEmptyString(exec));
-    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel(JSLabel::pcGlobalLabel) ));
+    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
     return ret;
 }
 
@@ -753,25 +753,25 @@ JSValue JSC_HOST_CALL stringProtoFuncCharCodeAt(ExecState* exec)
         if (i < len) {
             if (s.is8Bit()) {
                 ret = (jsNumber(s.characters8()[i]));
-                ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel(JSLabel::pcGlobalLabel) ));
+                ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
                 return ret;
             }
             ret = (jsNumber(s.characters16()[i]));
-            ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel(JSLabel::pcGlobalLabel) ));
+            ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
             return ret;
         }
         ret = (jsNaN());
-        ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel(JSLabel::pcGlobalLabel) ));
+        ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
         return ret;
     }
     double dpos = a0.toInteger(exec);
     if (dpos >= 0 && dpos < len) {
         ret = (jsNumber(s[static_cast<int>(dpos)]));
-        ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel(JSLabel::pcGlobalLabel) ));
+        ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
         return ret;
     }
     ret = (jsNaN());
-    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel(JSLabel::pcGlobalLabel) ));
+    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
     return ret;
 }
 
@@ -781,14 +781,14 @@ JSValue JSC_HOST_CALL stringProtoFuncConcat(ExecState* exec)
     JSValue ret;
     if (thisValue.isString() && (exec->argumentCount() == 1)) {
         ret = (jsString(exec, asString(thisValue), exec->argument(0).toString(exec)));
-        ret.setValueLabel(thisValue.joinValueLabel(JSLabel(JSLabel::argLabel[1])).Join(JSLabel(JSLabel::pcGlobalLabel) ));
+        ret.setValueLabel(thisValue.joinValueLabel(exec->argumentLabel(0)).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
         return ret;
     }
 
     if (thisValue.isUndefinedOrNull()) // CheckObjectCoercible
         return throwVMTypeError(exec);
     ret = (jsStringFromArguments(exec, thisValue));
-    ret.setValueLabel(thisValue.joinValueLabel(JSLabel(JSLabel::argLabel[1])).Join(JSLabel(JSLabel::pcGlobalLabel) ));
+    ret.setValueLabel(thisValue.joinValueLabel(exec->argumentLabel(0)).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
     return ret;
 }
 
@@ -825,11 +825,11 @@ JSValue JSC_HOST_CALL stringProtoFuncIndexOf(ExecState* exec)
     JSValue ret;
     if (result == notFound) {
         ret = (jsNumber(-1));
-        ret.setValueLabel(thisValue.joinValueLabel(a0.joinValueLabel(a1.getValueLabel())).Join(JSLabel(JSLabel::pcGlobalLabel) ));
+        ret.setValueLabel(thisValue.joinValueLabel(a0.joinValueLabel(a1.getValueLabel())).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
         return ret;
     }
     ret = (jsNumber(result));
-    ret.setValueLabel(thisValue.joinValueLabel(a0.joinValueLabel(a1.getValueLabel())).Join(JSLabel(JSLabel::pcGlobalLabel) ));
+    ret.setValueLabel(thisValue.joinValueLabel(a0.joinValueLabel(a1.getValueLabel())).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
     return ret;
 }
 
@@ -855,11 +855,11 @@ JSValue JSC_HOST_CALL stringProtoFuncLastIndexOf(ExecState* exec)
     JSValue ret;
     if (result == notFound) {
         ret = (jsNumber(-1));
-        ret.setValueLabel(thisValue.joinValueLabel(a0.joinValueLabel(a1.getValueLabel())).Join(JSLabel(JSLabel::pcGlobalLabel) ));
+        ret.setValueLabel(thisValue.joinValueLabel(a0.joinValueLabel(a1.getValueLabel())).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
         return ret;
     }
     ret = (jsNumber(result));
-    ret.setValueLabel(thisValue.joinValueLabel(a0.joinValueLabel(a1.getValueLabel())).Join(JSLabel(JSLabel::pcGlobalLabel) ));
+    ret.setValueLabel(thisValue.joinValueLabel(a0.joinValueLabel(a1.getValueLabel())).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
     return ret;
 }
 
@@ -905,8 +905,8 @@ JSValue JSC_HOST_CALL stringProtoFuncMatch(ExecState* exec)
     // case without 'g' flag is handled like RegExp.prototype.exec
     if (!global) {
         ret = (result ? RegExpMatchesArray::create(exec, string, regExp, result) : jsNull());
-        ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel(JSLabel::pcGlobalLabel) ));
-        if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel(JSLabel::pcGlobalLabel) ));
+        ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
+        if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel(exec->ifcContext().pcGlobalLabel) ));
         return ret;
     }
 
@@ -925,13 +925,13 @@ JSValue JSC_HOST_CALL stringProtoFuncMatch(ExecState* exec)
         // Null instead of an empty array, because this matches
         // other browsers and because Null is a false value.
         ret = (jsNull());
-        ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel(JSLabel::pcGlobalLabel) ));
+        ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
         return ret;
     }
 
     ret = (constructArray(exec, list));
-    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel(JSLabel::pcGlobalLabel) ));
-    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel(JSLabel::pcGlobalLabel) ));
+    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
+    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel(exec->ifcContext().pcGlobalLabel) ));
     return ret;
 }
 
@@ -963,7 +963,7 @@ JSValue JSC_HOST_CALL stringProtoFuncSearch(ExecState* exec)
     RegExpConstructor* regExpConstructor = exec->lexicalGlobalObject()->regExpConstructor();
     MatchResult result = regExpConstructor->performMatch(*globalData, reg, string, s, 0);
     JSValue ret = (result ? jsNumber(result.start) : jsNumber(-1));
-    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel(JSLabel::pcGlobalLabel) ));
+    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
     return ret;
 }
 
@@ -989,14 +989,14 @@ JSValue JSC_HOST_CALL stringProtoFuncSlice(ExecState* exec)
         if (to > len)
             to = len;
         ret = (jsSubstring(exec, s, static_cast<unsigned>(from), static_cast<unsigned>(to) - static_cast<unsigned>(from)));
-        ret.setValueLabel(thisValue.joinValueLabel(a0.joinValueLabel(a1.getValueLabel())).Join(JSLabel(JSLabel::pcGlobalLabel) ));
-        if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel(JSLabel::pcGlobalLabel) ));
+        ret.setValueLabel(thisValue.joinValueLabel(a0.joinValueLabel(a1.getValueLabel())).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
+        if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel(exec->ifcContext().pcGlobalLabel) ));
         return ret;
     }
 
     ret = (jsEmptyString(exec));
-    ret.setValueLabel(thisValue.joinValueLabel(a0.joinValueLabel(a1.getValueLabel())).Join(JSLabel(JSLabel::pcGlobalLabel) ));
-    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel(JSLabel::pcGlobalLabel) ));
+    ret.setValueLabel(thisValue.joinValueLabel(a0.joinValueLabel(a1.getValueLabel())).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
+    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel(exec->ifcContext().pcGlobalLabel) ));
     return ret;
 }
 
@@ -1067,8 +1067,8 @@ JSValue JSC_HOST_CALL stringProtoFuncSplit(ExecState* exec)
         // 9. If lim == 0, return A.
         if (!limit) {
             ret = result;
-            ret.setValueLabel(thisValue.joinValueLabel(separatorValue.joinValueLabel(limitValue.getValueLabel())).Join(JSLabel(JSLabel::pcGlobalLabel) ));
-            if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel(JSLabel::pcGlobalLabel) ));
+            ret.setValueLabel(thisValue.joinValueLabel(separatorValue.joinValueLabel(limitValue.getValueLabel())).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
+            if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel(exec->ifcContext().pcGlobalLabel) ));
             return ret;
         }
 
@@ -1079,8 +1079,8 @@ JSValue JSC_HOST_CALL stringProtoFuncSplit(ExecState* exec)
             result->putDirectIndex(exec, 0, jsStringWithReuse(exec, thisValue, input), false);
             // b. Return A.
             ret = (result);
-            ret.setValueLabel(thisValue.joinValueLabel(separatorValue.joinValueLabel(limitValue.getValueLabel())).Join(JSLabel(JSLabel::pcGlobalLabel) ));
-            if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel(JSLabel::pcGlobalLabel) ));
+            ret.setValueLabel(thisValue.joinValueLabel(separatorValue.joinValueLabel(limitValue.getValueLabel())).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
+            if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel(exec->ifcContext().pcGlobalLabel) ));
             return ret;
         }
 
@@ -1094,8 +1094,8 @@ JSValue JSC_HOST_CALL stringProtoFuncSplit(ExecState* exec)
             if (!reg->match(*globalData, input, 0))
                 result->putDirectIndex(exec, 0, jsStringWithReuse(exec, thisValue, input), false);
             ret = (result);
-            ret.setValueLabel(thisValue.joinValueLabel(separatorValue.joinValueLabel(limitValue.getValueLabel())).Join(JSLabel(JSLabel::pcGlobalLabel) ));
-            if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel(JSLabel::pcGlobalLabel) ));
+            ret.setValueLabel(thisValue.joinValueLabel(separatorValue.joinValueLabel(limitValue.getValueLabel())).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
+            if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel(exec->ifcContext().pcGlobalLabel) ));
             return ret;
         }
 
@@ -1131,8 +1131,8 @@ JSValue JSC_HOST_CALL stringProtoFuncSplit(ExecState* exec)
             // 4. If lengthA == lim, return A.
             if (++resultLength == limit) {
                 ret = (result);
-                ret.setValueLabel(thisValue.joinValueLabel(separatorValue.joinValueLabel(limitValue.getValueLabel())).Join(JSLabel(JSLabel::pcGlobalLabel) ));
-                if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel(JSLabel::pcGlobalLabel) ));
+                ret.setValueLabel(thisValue.joinValueLabel(separatorValue.joinValueLabel(limitValue.getValueLabel())).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
+                if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel(exec->ifcContext().pcGlobalLabel) ));
                 return ret;
             }
 
@@ -1154,8 +1154,8 @@ JSValue JSC_HOST_CALL stringProtoFuncSplit(ExecState* exec)
                 // d If lengthA == lim, return A.
                 if (++resultLength == limit) {
                     ret = result;
-                    ret.setValueLabel(thisValue.joinValueLabel(separatorValue.joinValueLabel(limitValue.getValueLabel())).Join(JSLabel(JSLabel::pcGlobalLabel) ));
-                    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel(JSLabel::pcGlobalLabel) ));
+                    ret.setValueLabel(thisValue.joinValueLabel(separatorValue.joinValueLabel(limitValue.getValueLabel())).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
+                    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel(exec->ifcContext().pcGlobalLabel) ));
                     return ret;
                 }
             }
@@ -1166,8 +1166,8 @@ JSValue JSC_HOST_CALL stringProtoFuncSplit(ExecState* exec)
         // 9. If lim == 0, return A.
         if (!limit) {
             ret = result;
-            ret.setValueLabel(thisValue.joinValueLabel(separatorValue.joinValueLabel(limitValue.getValueLabel())).Join(JSLabel(JSLabel::pcGlobalLabel) ));
-            if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel(JSLabel::pcGlobalLabel) ));
+            ret.setValueLabel(thisValue.joinValueLabel(separatorValue.joinValueLabel(limitValue.getValueLabel())).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
+            if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel(exec->ifcContext().pcGlobalLabel) ));
             return ret;
         }
 
@@ -1179,8 +1179,8 @@ JSValue JSC_HOST_CALL stringProtoFuncSplit(ExecState* exec)
             result->putDirectIndex(exec, 0, jsStringWithReuse(exec, thisValue, input), false);
             // b.  Return A.
             ret = (result);
-            ret.setValueLabel(thisValue.joinValueLabel(separatorValue.joinValueLabel(limitValue.getValueLabel())).Join(JSLabel(JSLabel::pcGlobalLabel) ));
-            if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel(JSLabel::pcGlobalLabel) ));
+            ret.setValueLabel(thisValue.joinValueLabel(separatorValue.joinValueLabel(limitValue.getValueLabel())).Join(JSLabel(exec->ifcContext().pcGlobalLabel) ));
+            if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel(exec->ifcContext().pcGlobalLabel) ));
             return ret;
         }
 
@@ -1194,8 +1194,8 @@ JSValue JSC_HOST_CALL stringProtoFuncSplit(ExecState* exec)
             if (!separator.isEmpty())
                 result->putDirectIndex(exec, 0, jsStringWithReuse(exec, thisValue, input), false);
             ret = (result);
-            ret.setValueLabel(thisValue.joinValueLabel(separatorValue.joinValueLabel(limitValue.getValueLabel())).Join(JSLabel::pcGlobalLabel));
-            if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+            ret.setValueLabel(thisValue.joinValueLabel(separatorValue.joinValueLabel(limitValue.getValueLabel())).Join(exec->ifcContext().pcGlobalLabel));
+            if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
             return ret;
         }
 
@@ -1210,8 +1210,8 @@ JSValue JSC_HOST_CALL stringProtoFuncSplit(ExecState* exec)
             } while (++position < limit);
 
             ret = (result);
-            ret.setValueLabel(thisValue.joinValueLabel(separatorValue.joinValueLabel(limitValue.getValueLabel())).Join(JSLabel::pcGlobalLabel));
-            if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+            ret.setValueLabel(thisValue.joinValueLabel(separatorValue.joinValueLabel(limitValue.getValueLabel())).Join(exec->ifcContext().pcGlobalLabel));
+            if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
             return ret;
         }
 
@@ -1234,16 +1234,16 @@ JSValue JSC_HOST_CALL stringProtoFuncSplit(ExecState* exec)
                 if (splitStringByOneCharacterImpl<LChar>(exec, result, input, stringImpl, separatorCharacter, position, resultLength, limit))
                 {
                     ret = (result);
-                    ret.setValueLabel(thisValue.joinValueLabel(separatorValue.joinValueLabel(limitValue.getValueLabel())).Join(JSLabel::pcGlobalLabel));
-                    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+                    ret.setValueLabel(thisValue.joinValueLabel(separatorValue.joinValueLabel(limitValue.getValueLabel())).Join(exec->ifcContext().pcGlobalLabel));
+                    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
                     return ret;
                 }
             } else {
                 if (splitStringByOneCharacterImpl<UChar>(exec, result, input, stringImpl, separatorCharacter, position, resultLength, limit))
                 {
                     ret = (result);
-                    ret.setValueLabel(thisValue.joinValueLabel(separatorValue.joinValueLabel(limitValue.getValueLabel())).Join(JSLabel::pcGlobalLabel));
-                    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+                    ret.setValueLabel(thisValue.joinValueLabel(separatorValue.joinValueLabel(limitValue.getValueLabel())).Join(exec->ifcContext().pcGlobalLabel));
+                    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
                     return ret;
                 }
             }
@@ -1265,8 +1265,8 @@ JSValue JSC_HOST_CALL stringProtoFuncSplit(ExecState* exec)
                 if (++resultLength == limit)
                 {
                     ret = (result);
-                    ret.setValueLabel(thisValue.joinValueLabel(separatorValue.joinValueLabel(limitValue.getValueLabel())).Join(JSLabel::pcGlobalLabel));
-                    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+                    ret.setValueLabel(thisValue.joinValueLabel(separatorValue.joinValueLabel(limitValue.getValueLabel())).Join(exec->ifcContext().pcGlobalLabel));
+                    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
                     return ret;
                 }
                 // 5. Let p = e.
@@ -1284,8 +1284,8 @@ JSValue JSC_HOST_CALL stringProtoFuncSplit(ExecState* exec)
 
     // 16. Return A.
     ret = (result);
-    ret.setValueLabel(thisValue.joinValueLabel(separatorValue.joinValueLabel(limitValue.getValueLabel())).Join(JSLabel::pcGlobalLabel));
-    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+    ret.setValueLabel(thisValue.joinValueLabel(separatorValue.joinValueLabel(limitValue.getValueLabel())).Join(exec->ifcContext().pcGlobalLabel));
+    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
     return ret;
 }
 
@@ -1308,7 +1308,7 @@ JSValue JSC_HOST_CALL stringProtoFuncSubstr(ExecState* exec)
         uString = thisValue.toString(exec)->value(exec);
         if (exec->hadException()) {
             ret = (jsUndefined());
-            ret.setValueLabel(thisValue.joinValueLabel(a0.joinValueLabel(a1.getValueLabel())).Join(JSLabel::pcGlobalLabel));
+            ret.setValueLabel(thisValue.joinValueLabel(a0.joinValueLabel(a1.getValueLabel())).Join(exec->ifcContext().pcGlobalLabel));
             return ret;
         }
         len = uString.length();
@@ -1321,8 +1321,8 @@ JSValue JSC_HOST_CALL stringProtoFuncSubstr(ExecState* exec)
     double length = a1.isUndefined() ? len : a1.toInteger(exec);
     if (start >= len || length <= 0) {
         ret = (jsEmptyString(exec));
-        ret.setValueLabel(thisValue.joinValueLabel(a0.joinValueLabel(a1.getValueLabel())).Join(JSLabel::pcGlobalLabel));
-        if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+        ret.setValueLabel(thisValue.joinValueLabel(a0.joinValueLabel(a1.getValueLabel())).Join(exec->ifcContext().pcGlobalLabel));
+        if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
         return ret;
     }
     if (start < 0) {
@@ -1336,13 +1336,13 @@ JSValue JSC_HOST_CALL stringProtoFuncSubstr(ExecState* exec)
     unsigned substringLength = static_cast<unsigned>(length);
     if (jsString) {
         ret = (jsSubstring(exec, jsString, substringStart, substringLength));
-        ret.setValueLabel(thisValue.joinValueLabel(a0.joinValueLabel(a1.getValueLabel())).Join(JSLabel::pcGlobalLabel));
-        if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+        ret.setValueLabel(thisValue.joinValueLabel(a0.joinValueLabel(a1.getValueLabel())).Join(exec->ifcContext().pcGlobalLabel));
+        if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
         return ret;
     }
     ret = (jsSubstring(exec, uString, substringStart, substringLength));
-    ret.setValueLabel(thisValue.joinValueLabel(a0.joinValueLabel(a1.getValueLabel())).Join(JSLabel::pcGlobalLabel));
-    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+    ret.setValueLabel(thisValue.joinValueLabel(a0.joinValueLabel(a1.getValueLabel())).Join(exec->ifcContext().pcGlobalLabel));
+    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
     return ret;
 }
 
@@ -1358,7 +1358,7 @@ JSValue JSC_HOST_CALL stringProtoFuncSubstring(ExecState* exec)
     JSString* jsString = thisValue.toString(exec);
     if (exec->hadException()) {
         ret = (jsUndefined());
-        ret.setValueLabel(thisValue.joinValueLabel(a0.joinValueLabel(a1.getValueLabel())).Join(JSLabel::pcGlobalLabel));
+        ret.setValueLabel(thisValue.joinValueLabel(a0.joinValueLabel(a1.getValueLabel())).Join(exec->ifcContext().pcGlobalLabel));
         return ret;
     }
 
@@ -1387,8 +1387,8 @@ JSValue JSC_HOST_CALL stringProtoFuncSubstring(ExecState* exec)
     unsigned substringStart = static_cast<unsigned>(start);
     unsigned substringLength = static_cast<unsigned>(end) - substringStart;
     ret = (jsSubstring(exec, jsString, substringStart, substringLength));
-    ret.setValueLabel(thisValue.joinValueLabel(a0.joinValueLabel(a1.getValueLabel())).Join(JSLabel::pcGlobalLabel));
-    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+    ret.setValueLabel(thisValue.joinValueLabel(a0.joinValueLabel(a1.getValueLabel())).Join(exec->ifcContext().pcGlobalLabel));
+    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
     return ret;
 }
 
@@ -1404,8 +1404,8 @@ JSValue JSC_HOST_CALL stringProtoFuncToLowerCase(ExecState* exec)
     int sSize = s.length();
     if (!sSize) {
         ret = (sVal);
-        ret.setValueLabel(thisValue.getValueLabel().Join(JSLabel::pcGlobalLabel));
-        if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+        ret.setValueLabel(thisValue.getValueLabel().Join(exec->ifcContext().pcGlobalLabel));
+        if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
         return ret;
     }
 
@@ -1413,13 +1413,13 @@ JSValue JSC_HOST_CALL stringProtoFuncToLowerCase(ExecState* exec)
     RefPtr<StringImpl> lower = ourImpl->lower();
     if (ourImpl == lower) {
         ret = (sVal);
-        ret.setValueLabel(thisValue.getValueLabel().Join(JSLabel::pcGlobalLabel));
-        if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+        ret.setValueLabel(thisValue.getValueLabel().Join(exec->ifcContext().pcGlobalLabel));
+        if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
         return ret;
     }
     ret = (jsString(exec, UString(lower.release())));
-    ret.setValueLabel(thisValue.getValueLabel().Join(JSLabel::pcGlobalLabel));
-    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+    ret.setValueLabel(thisValue.getValueLabel().Join(exec->ifcContext().pcGlobalLabel));
+    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
     return ret;
 }
 
@@ -1435,8 +1435,8 @@ JSValue JSC_HOST_CALL stringProtoFuncToUpperCase(ExecState* exec)
     int sSize = s.length();
     if (!sSize) {
         ret = (sVal);
-        ret.setValueLabel(thisValue.getValueLabel().Join(JSLabel::pcGlobalLabel));
-        if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+        ret.setValueLabel(thisValue.getValueLabel().Join(exec->ifcContext().pcGlobalLabel));
+        if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
         return ret;
     }
 
@@ -1444,14 +1444,14 @@ JSValue JSC_HOST_CALL stringProtoFuncToUpperCase(ExecState* exec)
     RefPtr<StringImpl> upper = sImpl->upper();
     if (sImpl == upper) {
         ret = (sVal);
-        ret.setValueLabel(thisValue.getValueLabel().Join(JSLabel::pcGlobalLabel));
-        if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+        ret.setValueLabel(thisValue.getValueLabel().Join(exec->ifcContext().pcGlobalLabel));
+        if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
         return ret;
     }
     ret = (jsString(exec, UString(upper.release())));
     // IFC4BC - Set the label of the return value
-    ret.setValueLabel(thisValue.getValueLabel().Join(JSLabel::pcGlobalLabel));
-    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+    ret.setValueLabel(thisValue.getValueLabel().Join(exec->ifcContext().pcGlobalLabel));
+    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
     return ret;
 }
 
@@ -1460,7 +1460,7 @@ JSValue JSC_HOST_CALL stringProtoFuncLocaleCompare(ExecState* exec)
     JSValue ret;
     if (exec->argumentCount() < 1) {
         ret = (jsNumber(0));
-        ret.setValueLabel(JSLabel(JSLabel::argLabel[0]).Join(JSLabel::pcGlobalLabel));
+        ret.setValueLabel(exec->thisLabel().Join(exec->ifcContext().pcGlobalLabel));
         return ret;
     }
 
@@ -1471,7 +1471,7 @@ JSValue JSC_HOST_CALL stringProtoFuncLocaleCompare(ExecState* exec)
 
     JSValue a0 = exec->argument(0);
     ret = (jsNumber(localeCompare(s, a0.toString(exec)->value(exec))));
-    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel::pcGlobalLabel));
+    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(exec->ifcContext().pcGlobalLabel));
     return ret;
 }
 
@@ -1482,8 +1482,8 @@ JSValue JSC_HOST_CALL stringProtoFuncBig(ExecState* exec)
         return throwVMTypeError(exec);
     UString s = thisValue.toString(exec)->value(exec);
     JSValue ret = (jsMakeNontrivialString(exec, "<big>", s, "</big>"));
-    ret.setValueLabel(thisValue.getValueLabel().Join(JSLabel::pcGlobalLabel));
-    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+    ret.setValueLabel(thisValue.getValueLabel().Join(exec->ifcContext().pcGlobalLabel));
+    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
     return ret;
 }
 
@@ -1494,8 +1494,8 @@ JSValue JSC_HOST_CALL stringProtoFuncSmall(ExecState* exec)
         return throwVMTypeError(exec);
     UString s = thisValue.toString(exec)->value(exec);
     JSValue ret = (jsMakeNontrivialString(exec, "<small>", s, "</small>"));
-    ret.setValueLabel(thisValue.getValueLabel().Join(JSLabel::pcGlobalLabel));
-    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+    ret.setValueLabel(thisValue.getValueLabel().Join(exec->ifcContext().pcGlobalLabel));
+    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
     return ret;
 }
 
@@ -1506,8 +1506,8 @@ JSValue JSC_HOST_CALL stringProtoFuncBlink(ExecState* exec)
         return throwVMTypeError(exec);
     UString s = thisValue.toString(exec)->value(exec);
     JSValue ret = (jsMakeNontrivialString(exec, "<blink>", s, "</blink>"));
-    ret.setValueLabel(thisValue.getValueLabel().Join(JSLabel::pcGlobalLabel));
-    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+    ret.setValueLabel(thisValue.getValueLabel().Join(exec->ifcContext().pcGlobalLabel));
+    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
     return ret;
 }
 
@@ -1518,8 +1518,8 @@ JSValue JSC_HOST_CALL stringProtoFuncBold(ExecState* exec)
         return throwVMTypeError(exec);
     UString s = thisValue.toString(exec)->value(exec);
     JSValue ret = (jsMakeNontrivialString(exec, "<b>", s, "</b>"));
-    ret.setValueLabel(thisValue.getValueLabel().Join(JSLabel::pcGlobalLabel));
-    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+    ret.setValueLabel(thisValue.getValueLabel().Join(exec->ifcContext().pcGlobalLabel));
+    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
     return ret;
 }
 
@@ -1530,8 +1530,8 @@ JSValue JSC_HOST_CALL stringProtoFuncFixed(ExecState* exec)
         return throwVMTypeError(exec);
     UString s = thisValue.toString(exec)->value(exec);
     JSValue ret = (jsMakeNontrivialString(exec, "<tt>", s, "</tt>"));
-    ret.setValueLabel(thisValue.getValueLabel().Join(JSLabel::pcGlobalLabel));
-    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+    ret.setValueLabel(thisValue.getValueLabel().Join(exec->ifcContext().pcGlobalLabel));
+    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
     return ret;
 }
 
@@ -1542,8 +1542,8 @@ JSValue JSC_HOST_CALL stringProtoFuncItalics(ExecState* exec)
         return throwVMTypeError(exec);
     UString s = thisValue.toString(exec)->value(exec);
     JSValue ret = (jsMakeNontrivialString(exec, "<i>", s, "</i>"));
-    ret.setValueLabel(thisValue.getValueLabel().Join(JSLabel::pcGlobalLabel));
-    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+    ret.setValueLabel(thisValue.getValueLabel().Join(exec->ifcContext().pcGlobalLabel));
+    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
     return ret;
 }
 
@@ -1554,8 +1554,8 @@ JSValue JSC_HOST_CALL stringProtoFuncStrike(ExecState* exec)
         return throwVMTypeError(exec);
     UString s = thisValue.toString(exec)->value(exec);
     JSValue ret = (jsMakeNontrivialString(exec, "<strike>", s, "</strike>"));
-    ret.setValueLabel(thisValue.getValueLabel().Join(JSLabel::pcGlobalLabel));
-    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+    ret.setValueLabel(thisValue.getValueLabel().Join(exec->ifcContext().pcGlobalLabel));
+    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
     return ret;
 }
 
@@ -1566,8 +1566,8 @@ JSValue JSC_HOST_CALL stringProtoFuncSub(ExecState* exec)
         return throwVMTypeError(exec);
     UString s = thisValue.toString(exec)->value(exec);
     JSValue ret = (jsMakeNontrivialString(exec, "<sub>", s, "</sub>"));
-    ret.setValueLabel(thisValue.getValueLabel().Join(JSLabel::pcGlobalLabel));
-    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+    ret.setValueLabel(thisValue.getValueLabel().Join(exec->ifcContext().pcGlobalLabel));
+    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
     return ret;
 }
 
@@ -1578,8 +1578,8 @@ JSValue JSC_HOST_CALL stringProtoFuncSup(ExecState* exec)
         return throwVMTypeError(exec);
     UString s = thisValue.toString(exec)->value(exec);
     JSValue ret = (jsMakeNontrivialString(exec, "<sup>", s, "</sup>"));
-    ret.setValueLabel(thisValue.getValueLabel().Join(JSLabel::pcGlobalLabel));
-    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+    ret.setValueLabel(thisValue.getValueLabel().Join(exec->ifcContext().pcGlobalLabel));
+    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
     return ret;
 }
 
@@ -1591,8 +1591,8 @@ JSValue JSC_HOST_CALL stringProtoFuncFontcolor(ExecState* exec)
     UString s = thisValue.toString(exec)->value(exec);
     JSValue a0 = exec->argument(0);
     JSValue ret = (jsMakeNontrivialString(exec, "<font color=\"", a0.toString(exec)->value(exec), "\">", s, "</font>"));
-    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel::pcGlobalLabel));
-    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(exec->ifcContext().pcGlobalLabel));
+    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
     return ret;
 }
 
@@ -1613,7 +1613,7 @@ JSValue JSC_HOST_CALL stringProtoFuncFontsize(ExecState* exec)
         PassRefPtr<StringImpl> impl = StringImpl::tryCreateUninitialized(bufferSize, buffer);
         if (!impl) {
             ret = (jsUndefined());
-            ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel::pcGlobalLabel));
+            ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(exec->ifcContext().pcGlobalLabel));
             return ret;
         }
         buffer[0] = '<';
@@ -1640,14 +1640,14 @@ JSValue JSC_HOST_CALL stringProtoFuncFontsize(ExecState* exec)
         buffer[20 + stringSize] = 't';
         buffer[21 + stringSize] = '>';
         ret = (jsNontrivialString(exec, impl));
-        ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel::pcGlobalLabel));
-        if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+        ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(exec->ifcContext().pcGlobalLabel));
+        if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
         return ret;
     }
 
     ret = (jsMakeNontrivialString(exec, "<font size=\"", a0.toString(exec)->value(exec), "\">", s, "</font>"));
-    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel::pcGlobalLabel));
-    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(exec->ifcContext().pcGlobalLabel));
+    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
     return ret;
 }
 
@@ -1659,8 +1659,8 @@ JSValue JSC_HOST_CALL stringProtoFuncAnchor(ExecState* exec)
     UString s = thisValue.toString(exec)->value(exec);
     JSValue a0 = exec->argument(0);
     JSValue ret = (jsMakeNontrivialString(exec, "<a name=\"", a0.toString(exec)->value(exec), "\">", s, "</a>"));
-    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel::pcGlobalLabel));
-    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(exec->ifcContext().pcGlobalLabel));
+    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
     return ret;
 }
 
@@ -1681,8 +1681,8 @@ JSValue JSC_HOST_CALL stringProtoFuncLink(ExecState* exec)
     PassRefPtr<StringImpl> impl = StringImpl::tryCreateUninitialized(bufferSize, buffer);
     if (!impl) {
         ret = (jsUndefined());
-        ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel::pcGlobalLabel));
-        if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+        ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(exec->ifcContext().pcGlobalLabel));
+        if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
         return ret;
     }
     buffer[0] = '<';
@@ -1703,8 +1703,8 @@ JSValue JSC_HOST_CALL stringProtoFuncLink(ExecState* exec)
     buffer[13 + linkTextSize + stringSize] = 'a';
     buffer[14 + linkTextSize + stringSize] = '>';
     ret = (jsNontrivialString(exec, impl));
-    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(JSLabel::pcGlobalLabel));
-    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+    ret.setValueLabel(thisValue.joinValueLabel(a0.getValueLabel()).Join(exec->ifcContext().pcGlobalLabel));
+    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
     return ret;
 }
 
@@ -1745,8 +1745,8 @@ JSValue JSC_HOST_CALL stringProtoFuncTrim(ExecState* exec)
 {
     JSValue thisValue = exec->hostThisValue();
     JSValue ret = (trimString(exec, thisValue, TrimLeft | TrimRight));
-    ret.setValueLabel(thisValue.getValueLabel().Join(JSLabel::pcGlobalLabel));
-    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+    ret.setValueLabel(thisValue.getValueLabel().Join(exec->ifcContext().pcGlobalLabel));
+    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
     return ret;
 }
 
@@ -1754,8 +1754,8 @@ JSValue JSC_HOST_CALL stringProtoFuncTrimLeft(ExecState* exec)
 {
     JSValue thisValue = exec->hostThisValue();
     JSValue ret = (trimString(exec, thisValue, TrimLeft));
-    ret.setValueLabel(thisValue.getValueLabel().Join(JSLabel::pcGlobalLabel));
-    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+    ret.setValueLabel(thisValue.getValueLabel().Join(exec->ifcContext().pcGlobalLabel));
+    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
     return ret;
 }
 
@@ -1763,8 +1763,8 @@ JSValue JSC_HOST_CALL stringProtoFuncTrimRight(ExecState* exec)
 {
     JSValue thisValue = exec->hostThisValue();
     JSValue ret = (trimString(exec, thisValue, TrimRight));
-    ret.setValueLabel(thisValue.getValueLabel().Join(JSLabel::pcGlobalLabel));
-    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(JSLabel::pcGlobalLabel));
+    ret.setValueLabel(thisValue.getValueLabel().Join(exec->ifcContext().pcGlobalLabel));
+    if (ret.isCell())   ret.asCell()->setObjectLabel(ret.joinValueLabel(exec->ifcContext().pcGlobalLabel));
     return ret;
 }
     
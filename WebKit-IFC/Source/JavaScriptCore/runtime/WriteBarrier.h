@@ -30,6 +30,7 @@
 #include "HandleTypes.h"
 #include "Heap.h"
 #include "SamplingCounter.h"
+#include <limits>
 #include <wtf/TypeTraits.h>
 
 namespace JSC {
@@ -155,6 +156,7 @@ public:
         Heap::writeBarrier(owner, value);
         //IFC4CBC instrumentation
         writerLabel = value.getValueLabel();
+        writerEpoch = std::numeric_limits<uint32_t>::max();
         //-----------------------
     }
 
@@ -163,6 +165,7 @@ public:
         m_value = JSValue::encode(value);
         //IFC4CBC instrumentation
         writerLabel = value.getValueLabel();
+        writerEpoch = std::numeric_limits<uint32_t>::max();
         //-----------------------
     }
 
@@ -206,6 +209,13 @@ private:
     
     // IFC4BC - This class needs to have label
     JSLabel writerLabel;
+    // Where this aliases a register of a frame, as an activation's or
+    // arguments object's storage does, its label epoch (see
+    // ExecState::uncheckedRegLabel). A write is stamped newest, so the frame
+    // reads the label written rather than its default label; the registers
+    // it can reach are otherwise kept relabeled eagerly (see
+    // Interpreter::labelRegisters), so reads need no epoch.
+    uint32_t writerEpoch;
     // IFC4BC -- Same size for register and writebarrier!!!
 };
 
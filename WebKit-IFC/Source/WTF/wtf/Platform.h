@@ -838,6 +838,11 @@
 #define ENABLE_SAMPLING_THREAD 1
 #endif
 
+/* Per-CodeBlock IFC counters; still off at runtime unless Options::ifcStats is set. */
+#if !defined(ENABLE_IFC_STATS)
+#define ENABLE_IFC_STATS 1
+#endif
+
 #if !defined(ENABLE_TEXT_CARET) && !PLATFORM(IOS)
 #define ENABLE_TEXT_CARET 1
 #endif
@@ -37,6 +37,7 @@ WTFThreadData::WTFThreadData()
 #if USE(JSC)
     , m_defaultIdentifierTable(new JSC::IdentifierTable())
     , m_currentIdentifierTable(m_defaultIdentifierTable)
+    , m_currentIFCContext(0)
     , m_stackBounds(StackBounds::currentThreadStackBounds())
 #endif
 {
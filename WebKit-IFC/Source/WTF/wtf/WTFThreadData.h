@@ -39,6 +39,8 @@
 // FIXME: This is a temporary layering violation while we move more string code to WTF.
 namespace JSC {
 
+class IFCContext;
+
 typedef HashMap<const char*, RefPtr<StringImpl>, PtrHash<const char*> > LiteralIdentifierTable;
 
 class IdentifierTable {
@@ -104,6 +106,19 @@ public:
         m_currentIdentifierTable = m_defaultIdentifierTable;
     }
 
+    // IFC4BC - 0 until the thread enters a VM; see JSC::IFCContext::current()
+    JSC::IFCContext* currentIFCContext()
+    {
+        return m_currentIFCContext;
+    }
+
+    JSC::IFCContext* setCurrentIFCContext(JSC::IFCContext* context)
+    {
+        JSC::IFCContext* oldContext = m_currentIFCContext;
+        m_currentIFCContext = context;
+        return oldContext;
+    }
+
     const StackBounds& stack() const
     {
         return m_stackBounds;
@@ -117,6 +132,7 @@ private:
 #if USE(JSC)
     JSC::IdentifierTable* m_defaultIdentifierTable;
     JSC::IdentifierTable* m_currentIdentifierTable;
+    JSC::IFCContext* m_currentIFCContext;
     StackBounds m_stackBounds;
 #endif
 
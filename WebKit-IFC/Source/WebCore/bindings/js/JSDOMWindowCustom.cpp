@@ -744,11 +744,11 @@ static JSValue handlePostMessage(DOMWindow* impl, ExecState* exec)
         return jsUndefined();
 
     // IFC4BC - Check here for postMessage sending data out
-    JSC::JSLabel msgLabel = JSC::JSLabel::argLabel[1]; // 1st argument is the message
+    JSC::JSLabel msgLabel = exec->argumentLabel(0); // 1st argument is the message
     JSC::JSLabel srcLabel = JSC::JSLabel(URLMap::urlmap().getLabel(targetOrigin.utf8().data()));
     if (!msgLabel.NSU(srcLabel))
     {
-        JSC::JSLabel::ABORT_FLAG = true;
+        JSC::IFCContext::current().abortFlag = true;
         // return jsUndefined();
     }
     
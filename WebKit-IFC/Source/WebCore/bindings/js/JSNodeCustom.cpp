@@ -298,7 +298,7 @@ JSValue JSNode::setLabel(ExecState* exec)
 {
     Node* imp = static_cast<Node*>(impl());
     if (imp->isElementNode()) {
-        // if (JSLabel::pcGlobalLabel.clabel == 1)
+        // if (JSC::IFCContext::current().pcGlobalLabel.clabel == 1)
         {
             String attr = static_cast<const Element*>(imp)->getAttribute("id");
             JSLabel labelVal;
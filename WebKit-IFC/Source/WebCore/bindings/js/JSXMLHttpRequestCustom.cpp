@@ -119,12 +119,12 @@ JSValue JSXMLHttpRequest::send(ExecState* exec)
         JSValue val = exec->argument(0);
         // IFC4BC - Intercept XHR sends on the network
         JSLabel sendUrlLabel = URLMap::urlmap().getLabel(impl()->url().string().utf8().data());
-        JSLabel valueLabel = JSLabel::argLabel[0];
-        JSLabel pcLabel = JSLabel(JSLabel::pcGlobalLabel);
+        JSLabel valueLabel = exec->thisLabel();
+        JSLabel pcLabel = JSLabel(JSC::IFCContext::current().pcGlobalLabel);
         if (!(pcLabel.NSU(sendUrlLabel)))
         {
             printf("IFC violation: Sending data on network in a high context\n");
-            // JSC::JSLabel::ABORT_FLAG = true;
+            // JSC::IFCContext::current().abortFlag = true;
         }
         else if (valueLabel.NSU(sendUrlLabel))
         {
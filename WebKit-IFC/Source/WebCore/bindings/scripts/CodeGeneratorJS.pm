@@ -2221,7 +2221,7 @@ sub GenerateImplementation
                             {
                                 push(@implContent, "    if (impl) {\n");
                                 push(@implContent, "        JSC::JSLabel nLabel = impl->getNodeLabel();\n");
-                                push(@implContent, "        if (!JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).NSU(nLabel)){\n");
+                                push(@implContent, "        if (!JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel).NSU(nLabel)){\n");
                                 push(@implContent, "            // IFC4BC - Set the label to partially leaked\n");
                                 push(@implContent, "            nLabel.setStar(true);\n");
                                 push(@implContent, "        }\n");
@@ -2229,7 +2229,7 @@ sub GenerateImplementation
                                 push(@implContent, "            // IFC4BC - Set the label to allowed upgrade\n");
                                 push(@implContent, "            nLabel.setStar(false);\n");
                                 push(@implContent, "        }\n");
-                                push(@implContent, "        impl->setNodeLabel(nLabel.Join(value.joinValueLabel(JSC::JSLabel::pcGlobalLabel)));\n");
+                                push(@implContent, "        impl->setNodeLabel(nLabel.Join(value.joinValueLabel(JSC::IFCContext::current().pcGlobalLabel)));\n");
                                 push(@implContent, "    }\n");
                             }
                             
@@ -3078,16 +3078,16 @@ sub GenerateImplementationFunctionCall()
             $implClassName eq "Text" ||
             $implClassName eq "Attr"){
                 push(@implContent, "    if (impl) {\n");
-                push(@implContent, "        if (!JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).NSU(impl->getNodeLabel())){\n");
-                push(@implContent, "            JSC::JSLabel::ABORT_FLAG = true;\n");
+                push(@implContent, "        if (!JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel).NSU(impl->getNodeLabel())){\n");
+                push(@implContent, "            JSC::IFCContext::current().abortFlag = true;\n");
                 push(@implContent, "            // return jsUndefined();\n");
                 push(@implContent, "        }\n");
                 push(@implContent, "    }\n");
             }
         if ($implClassName eq "NodeList"){
                 push(@implContent, "    if (impl) {\n");
-                push(@implContent, "        if (!JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).NSU(impl->getNodeListLabel())){\n");
-                push(@implContent, "            JSC::JSLabel::ABORT_FLAG = true;\n");
+                push(@implContent, "        if (!JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel).NSU(impl->getNodeListLabel())){\n");
+                push(@implContent, "            JSC::IFCContext::current().abortFlag = true;\n");
                 push(@implContent, "            // return jsUndefined();\n");
                 push(@implContent, "        }\n");
                 push(@implContent, "    }\n");
@@ -46,8 +46,8 @@ unsigned ChildNodeList::length() const
     {
         listLabel = getListLengthLabel();
         nodeListLabel = listLabel;
-//        if (!JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).NSU(listLabel)) {
-//            JSC::JSLabel::ABORT_FLAG = true;
+//        if (!JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel).NSU(listLabel)) {
+//            JSC::IFCContext::current().abortFlag = true;
 //            printf("Accessing child nodes list length in a different pc\n");
 //            // return -1;
 //        }
@@ -62,8 +62,8 @@ unsigned ChildNodeList::length() const
         listLabel = listLabel.Join(n->getNextSiblingLabel());
     }
 
-//    if (!JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).NSU(listLabel)) {
-//        JSC::JSLabel::ABORT_FLAG = true;
+//    if (!JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel).NSU(listLabel)) {
+//        JSC::IFCContext::current().abortFlag = true;
 //        printf("Accessing child nodes list length in a different pc\n");
 //        // return -1;
 //    }
@@ -87,8 +87,8 @@ Node* ChildNodeList::item(unsigned index) const
         if (index == cachedItemOffset())
         {
             // Do not need NSU checks here
-//            if (!JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).NSU(listLabel)) {
-//                JSC::JSLabel::ABORT_FLAG = true;
+//            if (!JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel).NSU(listLabel)) {
+//                JSC::IFCContext::current().abortFlag = true;
 //                printf("Accessing child node item in a different pc\n");
 //                // return 0;
 //            }
@@ -137,8 +137,8 @@ Node* ChildNodeList::item(unsigned index) const
         setItemCache(n, pos, listLabel);
         // We can return the label and copy it to the register
         // Do not need NSU check here
-//        if (!JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).NSU(listLabel)) {
-//            JSC::JSLabel::ABORT_FLAG = true;
+//        if (!JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel).NSU(listLabel)) {
+//            JSC::IFCContext::current().abortFlag = true;
 //            printf("Accessing node in a different pc\n");
 //            // return 0;
 //        }
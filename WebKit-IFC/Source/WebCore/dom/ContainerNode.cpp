@@ -198,15 +198,15 @@ namespace WebCore {
             prev->setNextSibling(newChild);
         } else {
             ASSERT(m_firstChild == nextChild);
-            if ((JSC::JSLabel(JSC::JSLabel::pcGlobalLabel)).NSU(getFCLabel()))
+            if ((JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel)).NSU(getFCLabel()))
             {
                 // IFC4BC - set the first child label of the parent
-                setFCLabel(JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).Join(JSC::JSLabel::argLabel[1]));
+                setFCLabel(JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel).Join(JSC::IFCContext::current().argumentLabel(0)));
             }
             else
             {
                 // printf("IFC check in insert-firstChild failed\n");
-                JSC::JSLabel::ABORT_FLAG = true;
+                JSC::IFCContext::current().abortFlag = true;
                 // return;
             }
             m_firstChild = newChild;
@@ -440,29 +440,29 @@ namespace WebCore {
             previousChild->setNextSibling(nextChild);
         }
         if (m_firstChild == oldChild) {
-            if ((JSC::JSLabel(JSC::JSLabel::pcGlobalLabel)).NSU(getFCLabel()))
+            if ((JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel)).NSU(getFCLabel()))
             {
                 // IFC4BC - set the first child label of the parent
-                setFCLabel(JSC::JSLabel::pcGlobalLabel);
+                setFCLabel(JSC::IFCContext::current().pcGlobalLabel);
             }
             else
             {
                 // printf("IFC check in remove-firstChild failed\n");
-                JSC::JSLabel::ABORT_FLAG = true;
+                JSC::IFCContext::current().abortFlag = true;
                 // return;
             }
             m_firstChild = nextChild;
         }
         if (m_lastChild == oldChild) {
-            if ((JSC::JSLabel(JSC::JSLabel::pcGlobalLabel)).NSU(getLCLabel()))
+            if ((JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel)).NSU(getLCLabel()))
             {
                 // IFC4BC - set the first child label of the parent
-                setLCLabel(JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).Join(JSC::JSLabel::argLabel[1]));
+                setLCLabel(JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel).Join(JSC::IFCContext::current().argumentLabel(0)));
             }
             else
             {
                 // printf("IFC check in remove-lastChild failed\n");
-                JSC::JSLabel::ABORT_FLAG = true;
+                JSC::IFCContext::current().abortFlag = true;
                 // return;
             }
             m_lastChild = previousChild;
@@ -516,11 +516,11 @@ namespace WebCore {
         Vector<RefPtr<Node>, 10> removedChildren;
         removedChildren.reserveInitialCapacity(childNodeCount());
         // IFC4BC - check for the first and last child labels
-        if (!(JSC::JSLabel(JSC::JSLabel::pcGlobalLabel)).NSU(getFCLabel()) ||
-            !(JSC::JSLabel(JSC::JSLabel::pcGlobalLabel)).NSU(getLCLabel()))
+        if (!(JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel)).NSU(getFCLabel()) ||
+            !(JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel)).NSU(getLCLabel()))
         {
             // printf("IFC check in removeChildren failed\n");
-            JSC::JSLabel::ABORT_FLAG = true;
+            JSC::IFCContext::current().abortFlag = true;
             // return;
         }
         while (RefPtr<Node> n = m_firstChild) {
@@ -132,30 +132,32 @@ protected:
     friend void Private::addChildNodesToDeletionQueue(GenericNode*& head, GenericNode*& tail, GenericNodeContainer*);
 
     void setFirstChild(Node* child) {
+        JSC::IFCContext& ifcContext = JSC::IFCContext::current();
         // IFC4BC - set the label of the child link
-        if (JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).NSU(getFCLabel()))
+        if (JSC::JSLabel(ifcContext.pcGlobalLabel).NSU(getFCLabel()))
         {
             // IFC4BC - set the first child label of the parent
-            setFCLabel(JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).Join(JSC::JSLabel::argLabel[1]));
+            setFCLabel(JSC::JSLabel(ifcContext.pcGlobalLabel).Join(ifcContext.argumentLabel(0)));
         }
         else
         {
             // printf("IFC check in setFirstChild failed\n");
-            JSC::JSLabel::ABORT_FLAG = true;
+            ifcContext.abortFlag = true;
             // return;
         }
         m_firstChild = child;
     }
     void setLastChild(Node* child) {
-        if (JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).NSU(getLCLabel()))
+        JSC::IFCContext& ifcContext = JSC::IFCContext::current();
+        if (JSC::JSLabel(ifcContext.pcGlobalLabel).NSU(getLCLabel()))
         {
             // IFC4BC - set the first child label of the parent
-            setLCLabel(JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).Join(JSC::JSLabel::argLabel[1]));
+            setLCLabel(JSC::JSLabel(ifcContext.pcGlobalLabel).Join(ifcContext.argumentLabel(0)));
         }
         else
         {
             // printf("IFC check in setLastChild failed\n");
-            JSC::JSLabel::ABORT_FLAG = true;
+            ifcContext.abortFlag = true;
             // return;
         }
         m_lastChild = child;
@@ -198,8 +200,8 @@ inline ContainerNode::ContainerNode(Document* document, ConstructionType type)
     , m_firstChild(0)
     , m_lastChild(0)
 {
-    setFCLabel(JSC::JSLabel::pcGlobalLabel);
-    setLCLabel(JSC::JSLabel::pcGlobalLabel);
+    setFCLabel(JSC::IFCContext::current().pcGlobalLabel);
+    setLCLabel(JSC::IFCContext::current().pcGlobalLabel);
 }
 
 inline void ContainerNode::attachAsNode()
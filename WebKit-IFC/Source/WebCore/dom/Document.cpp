@@ -521,10 +521,10 @@ Document::Document(Frame* frame, const KURL& url, bool isXHTML, bool isHTML)
         // JSC::JSLabel label;
         // if(temp) label = JSC::JSLabel(JSC::URLMap::urlmap().getLabel(docURL, 1));
         // label = JSC::JSLabel(JSC::URLMap::urlmap().getLabel(baseURI().string().utf8().data()));        // Setting the global label to the current documents label if it is already 0
-        // if (JSC::JSLabel::pcGlobalLabel == 0)
-        // JSC::JSLabel::pcGlobalLabel = label.Val();
-        // printf("PC Label is %lld\n", JSC::JSLabel::pcGlobalLabel.clabel);
-        // label = label.Join(JSC::JSLabel::pcGlobalLabel);
+        // if (JSC::IFCContext::current().pcGlobalLabel == 0)
+        // JSC::IFCContext::current().pcGlobalLabel = label.Val();
+        // printf("PC Label is %lld\n", JSC::IFCContext::current().pcGlobalLabel.clabel);
+        // label = label.Join(JSC::IFCContext::current().pcGlobalLabel);
         // this->setNodeLabel(label);
         // printf("Document's label is %llu\n", nodeLabel.Val());
     }
@@ -859,14 +859,14 @@ PassRefPtr<Element> Document::createElement(const AtomicString& name, ExceptionC
         // IFC4BC - join the argument labels
         PassRefPtr<Element> element = HTMLElementFactory::createHTMLElement(
                                                         QualifiedName(nullAtom, name, xhtmlNamespaceURI), this, 0, false);
-        element->joinNodeLabel(JSC::JSLabel(JSC::JSLabel::argLabel[1]));
+        element->joinNodeLabel(JSC::IFCContext::current().argumentLabel(0));
         return element;
         // return HTMLElementFactory::createHTMLElement(QualifiedName(nullAtom, name, xhtmlNamespaceURI), this, 0, false);
     }
 
     // IFC4BC - Join the label with the arglabel
     PassRefPtr<Element> element = createElement(QualifiedName(nullAtom, name, nullAtom), false);
-    element->joinNodeLabel(JSC::JSLabel(JSC::JSLabel::argLabel[1]));
+    element->joinNodeLabel(JSC::IFCContext::current().argumentLabel(0));
     return element;
     // return createElement(QualifiedName(nullAtom, name, nullAtom), false);
 }
@@ -880,7 +880,7 @@ PassRefPtr<Text> Document::createTextNode(const String& data)
 {
     // IFC4BC - Join the label with the arglabel
     PassRefPtr<Text> text = Text::create(this, data);
-    text->joinNodeLabel(JSC::JSLabel(JSC::JSLabel::argLabel[1]));
+    text->joinNodeLabel(JSC::IFCContext::current().argumentLabel(0));
     return text;
 
     // return Text::create(this, data);
@@ -890,7 +890,7 @@ PassRefPtr<Comment> Document::createComment(const String& data)
 {
     // IFC4BC - Join the label with the arglabel
     PassRefPtr<Comment> comment = Comment::create(this, data);
-    comment->joinNodeLabel(JSC::JSLabel(JSC::JSLabel::argLabel[1]));
+    comment->joinNodeLabel(JSC::IFCContext::current().argumentLabel(0));
     return comment;
 
     // return Comment::create(this, data);
@@ -904,7 +904,7 @@ PassRefPtr<CDATASection> Document::createCDATASection(const String& data, Except
     }
     // IFC4BC - Join the label with the arglabel
     PassRefPtr<CDATASection> cData = CDATASection::create(this, data);
-    cData->joinNodeLabel(JSC::JSLabel(JSC::JSLabel::argLabel[1]));
+    cData->joinNodeLabel(JSC::IFCContext::current().argumentLabel(0));
     return cData;
 
     // return CDATASection::create(this, data);
@@ -922,7 +922,7 @@ PassRefPtr<ProcessingInstruction> Document::createProcessingInstruction(const St
     }
     // IFC4BC - Join the label with the arglabel
     PassRefPtr<ProcessingInstruction> pI = ProcessingInstruction::create(this, target, data);
-    pI->joinNodeLabel(JSC::JSLabel(JSC::JSLabel::argLabel[1]).Join(JSC::JSLabel(JSC::JSLabel::argLabel[2])));
+    pI->joinNodeLabel(JSC::IFCContext::current().argumentLabel(0).Join(JSC::IFCContext::current().argumentLabel(1)));
     return pI;
 
     // return ProcessingInstruction::create(this, target, data);
@@ -940,7 +940,7 @@ PassRefPtr<EntityReference> Document::createEntityReference(const String& name,
     }
     // IFC4BC - Join the label with the arglabel
     PassRefPtr<EntityReference> eR = EntityReference::create(this, name);
-    eR->joinNodeLabel(JSC::JSLabel(JSC::JSLabel::argLabel[1]));
+    eR->joinNodeLabel(JSC::IFCContext::current().argumentLabel(0));
     return eR;
 
     // return EntityReference::create(this, name);
@@ -4202,7 +4202,7 @@ String Document::cookie(ExceptionCode& ec) const
         return String();
 
     // IFC4BC - Return the cookie's URL label
-    // JSC::JSLabel::returnLabel = JSC::JSLabel(JSC::URLMap::urlmap().getLabel(cookieURL.string().utf8().data())).getPair();
+    // JSC::IFCContext::current().setReturnLabel(JSC::JSLabel(JSC::URLMap::urlmap().getLabel(cookieURL.string().utf8().data())));
     return cookies(this, cookieURL);
 }
 
@@ -4734,7 +4734,7 @@ PassRefPtr<Attr> Document::createAttributeNS(const String& namespaceURI, const S
 
     // IFC4BC - Join the arg label
     PassRefPtr<Attr> attr = Attr::create(this, qName, emptyString());
-    attr->joinNodeLabel(JSC::JSLabel(JSC::JSLabel::argLabel[1]).Join(JSC::JSLabel(JSC::JSLabel::argLabel[2])));
+    attr->joinNodeLabel(JSC::IFCContext::current().argumentLabel(0).Join(JSC::IFCContext::current().argumentLabel(1)));
     return attr;
     
     // return Attr::create(this, qName, emptyString());
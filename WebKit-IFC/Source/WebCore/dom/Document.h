@@ -1547,7 +1547,7 @@ inline Node::Node(Document* document, ConstructionType type)
         // if(temp) label = JSC::JSLabel(JSC::URLMap::urlmap().getLabel(docURL, 1));
         // label = JSC::JSLabel(JSC::URLMap::urlmap().getLabel(m_document->documentURI().utf8().data()));
          
-        JSC::JSLabel pcLabel = JSC::JSLabel(JSC::JSLabel::pcGlobalLabel);
+        JSC::JSLabel pcLabel = JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel);
          
         // Joining pc Label to the newly created node's label
         // label = label.Join(pcLabel);
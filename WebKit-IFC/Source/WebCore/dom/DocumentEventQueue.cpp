@@ -77,8 +77,8 @@ bool DocumentEventQueue::enqueueEvent(PassRefPtr<Event> event)
         return false;
 
     // IFC4BC - Setting event label at the PC that it was queued
-    //printf("Setting the event label to %llu\n", JSC::JSLabel::pcGlobalLabel);
-    event->setEventLabel(JSC::JSLabel::pcGlobalLabel);
+    //printf("Setting the event label to %llu\n", JSC::IFCContext::current().pcGlobalLabel);
+    event->setEventLabel(JSC::IFCContext::current().pcGlobalLabel);
     
     ASSERT(event->target());
     bool wasAdded = m_queuedEvents.add(event).isNewEntry;
@@ -71,12 +71,12 @@ void DocumentOrderedMap::add(AtomicStringImpl* key, Element* element)
         // Fast path. The key is not already in m_duplicateCounts, so we assume that it's
         // also not already in m_map and try to add it. If that add succeeds, we're done.
         Map::AddResult addResult = m_map.add(key, element);
-        LabelMap::AddResult addLabel = m_labelMap.add(key, JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).Join(element->getParentLabel()));
+        LabelMap::AddResult addLabel = m_labelMap.add(key, JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel).Join(element->getParentLabel()));
         if (addResult.isNewEntry)
             return;
 
         JSC::JSLabel elementLabel = m_labelMap.get(key);
-        if (JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).NSU(elementLabel))
+        if (JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel).NSU(elementLabel))
         {
             // The add failed, so this key was already cached in m_map.
             // There are multiple elements with this key. Remove the m_map
@@ -87,7 +87,7 @@ void DocumentOrderedMap::add(AtomicStringImpl* key, Element* element)
         }
         else {
             // printf("IFC check in add-idMap failed\n");
-            JSC::JSLabel::ABORT_FLAG = true;
+            JSC::IFCContext::current().abortFlag = true;
             // return;
         }
     } else {
@@ -96,7 +96,7 @@ void DocumentOrderedMap::add(AtomicStringImpl* key, Element* element)
         Map::iterator cachedItem = m_map.find(key);
         LabelMap::iterator cachedLabel = m_labelMap.find(key);
         if (cachedItem != m_map.end()) {
-            if (JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).NSU(m_labelMap.get(key)))
+            if (JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel).NSU(m_labelMap.get(key)))
             {
                 m_map.remove(cachedItem);
                 m_labelMap.remove(cachedLabel);
@@ -104,7 +104,7 @@ void DocumentOrderedMap::add(AtomicStringImpl* key, Element* element)
             }
             else {
                 // printf("IFC check in add-idMap failed\n");
-                JSC::JSLabel::ABORT_FLAG = true;
+                JSC::IFCContext::current().abortFlag = true;
                 // return;
             }
         }
@@ -124,14 +124,14 @@ void DocumentOrderedMap::remove(AtomicStringImpl* key, Element* element)
     LabelMap::iterator cachedLabel = m_labelMap.find(key);
     if (cachedItem != m_map.end() && cachedItem->second == element)
     {
-        if (JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).NSU(m_labelMap.get(key)))
+        if (JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel).NSU(m_labelMap.get(key)))
         {
             m_map.remove(cachedItem);
             m_labelMap.remove(cachedLabel);
         }
         else {
             // printf("IFC check in remove-idMap failed\n");
-            JSC::JSLabel::ABORT_FLAG = true;
+            JSC::IFCContext::current().abortFlag = true;
             // return;
         }
     }
@@ -153,7 +153,7 @@ inline Element* DocumentOrderedMap::get(AtomicStringImpl* key, const TreeScope*
 
     if (element) {
         // IFC4BC
-        JSC::JSLabel::returnLabel = elementLabel.getPair();
+        JSC::IFCContext::current().setReturnLabel(elementLabel);
         return element;
     }
 
@@ -174,7 +174,7 @@ inline Element* DocumentOrderedMap::get(AtomicStringImpl* key, const TreeScope*
             m_duplicateCounts.remove(key);
             m_map.set(key, element);
             m_labelMap.set(key, elementLabel);
-            JSC::JSLabel::returnLabel = elementLabel.getPair();
+            JSC::IFCContext::current().setReturnLabel(elementLabel);
             return element;
         }
         ASSERT_NOT_REACHED();
@@ -184,7 +184,7 @@ inline Element* DocumentOrderedMap::get(AtomicStringImpl* key, const TreeScope*
         for (Node* node = scope->rootNode()->firstChild(); node; node = node->traverseNextNode()) {
             elementLabel = elementLabel.Join(node->getNextPointerLabel());
         }
-        JSC::JSLabel::returnLabel = elementLabel.getPair();
+        JSC::IFCContext::current().setReturnLabel(elementLabel);
     }
 
     return 0;
@@ -38,8 +38,8 @@ unsigned DynamicSubtreeNodeList::length() const
     if (isLengthCacheValid()) {
         nodeListLabel = getListLengthLabel();
         listLabel = nodeListLabel;
-//        if (!JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).NSU(listLabel)) {
-//            JSC::JSLabel::ABORT_FLAG = true;
+//        if (!JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel).NSU(listLabel)) {
+//            JSC::IFCContext::current().abortFlag = true;
 //            printf("Accessing child nodes list length in a different pc\n");
 //            // return -1;
 //        }
@@ -56,8 +56,8 @@ unsigned DynamicSubtreeNodeList::length() const
         listLabel = listLabel.Join(n->getNodeLabel().Join(n->getNextSiblingLabel()).Join(n->getFCLabel()));
     }
     // IFC4BC - Reading lists should not terminate the execution. return the label
-//    if (!JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).NSU(listLabel)) {
-//        JSC::JSLabel::ABORT_FLAG = true;
+//    if (!JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel).NSU(listLabel)) {
+//        JSC::IFCContext::current().abortFlag = true;
 //        printf("Accessing child nodes list length in a different pc\n");
 //        // return -1;
 //    }
@@ -127,8 +127,8 @@ Node* DynamicSubtreeNodeList::item(unsigned offset) const
         {
             // IFC4BC - get the cached item label
             nodeListLabel = getItemLabel();
-//            if (!JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).NSU(nodeListLabel)) {
-//                JSC::JSLabel::ABORT_FLAG = true;
+//            if (!JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel).NSU(nodeListLabel)) {
+//                JSC::IFCContext::current().abortFlag = true;
 //                printf("Accessing child nodes list item in a different pc\n");
 //                // return 0;
 //            }
@@ -148,8 +148,8 @@ Node* DynamicSubtreeNodeList::item(unsigned offset) const
     else
         returnNode = itemForwardsFromCurrent(start, offset, remainingOffset);
     
-//    if (!JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).NSU(nodeListLabel)) {
-//        JSC::JSLabel::ABORT_FLAG = true;
+//    if (!JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel).NSU(nodeListLabel)) {
+//        JSC::IFCContext::current().abortFlag = true;
 //        printf("Accessing child nodes list item in a different pc\n");
 //        // return 0;
 //    }
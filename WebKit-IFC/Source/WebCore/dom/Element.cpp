@@ -211,9 +211,9 @@ PassRefPtr<Attr> Element::detachAttribute(size_t index)
         attr = Attr::create(document(), attribute->name(), attribute->value());
 
     // IFC4BC - check for pc to set attribute
-    if (!JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).NSU(this->getNodeLabel())) {
+    if (!JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel).NSU(this->getNodeLabel())) {
         printf("Removing attribute for a node in higher pc\n");
-        JSC::JSLabel::ABORT_FLAG = true;
+        JSC::IFCContext::current().abortFlag = true;
         // return;
     }
     
@@ -227,9 +227,9 @@ void Element::removeAttribute(const QualifiedName& name)
         return;
 
     // IFC4BC - check for pc to set attribute
-    if (!JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).NSU(this->getNodeLabel())) {
+    if (!JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel).NSU(this->getNodeLabel())) {
         printf("Removing attribute for a node in higher pc\n");
-        JSC::JSLabel::ABORT_FLAG = true;
+        JSC::IFCContext::current().abortFlag = true;
         // return;
     }
     
@@ -654,9 +654,9 @@ const AtomicString& Element::getAttributeNS(const String& namespaceURI, const St
 void Element::setAttribute(const AtomicString& name, const AtomicString& value, ExceptionCode& ec)
 {
     // IFC4BC - check for pc to set attribute
-    if (!JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).NSU(this->getNodeLabel())) {
+    if (!JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel).NSU(this->getNodeLabel())) {
         printf("Setting attribute for a node in different pc\n");
-        JSC::JSLabel::ABORT_FLAG = true;
+        JSC::IFCContext::current().abortFlag = true;
         // return;
     }
 
@@ -691,17 +691,17 @@ inline void Element::setAttributeInternal(size_t index, const QualifiedName& nam
         // This is a source attribute. Parse value here
         if (strcmp(name.toString().utf8().data(),"src") == 0) {
             JSC::JSLabel urlLabel = JSC::JSLabel(JSC::URLMap::urlmap().getLabel(value.string().utf8().data()));
-            JSC::JSLabel pcLabel = JSC::JSLabel(JSC::JSLabel::pcGlobalLabel);
-            JSC::JSLabel valLabel = JSC::JSLabel(JSC::JSLabel::argLabel[0]);
+            JSC::JSLabel pcLabel = JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel);
+            JSC::JSLabel valLabel = JSC::JSLabel(JSC::IFCContext::current().valueLabel);
             if (!(pcLabel.NSU(urlLabel)))
             {
                 printf("IFC violation: Sending data on network in a high context\n");
-                JSC::JSLabel::ABORT_FLAG = true;
+                JSC::IFCContext::current().abortFlag = true;
             }
             if (!(valLabel.NSU(urlLabel)))
             {
                 printf("IFC violation: Sending high data on network\n");
-                JSC::JSLabel::ABORT_FLAG = true;
+                JSC::IFCContext::current().abortFlag = true;
             }
         }
         return;
@@ -283,7 +283,7 @@ bool EventDispatcher::dispatchEvent(PassRefPtr<Event> event)
     }
     
     
-    if (!JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).NSU(pathLabel))
+    if (!JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel).NSU(pathLabel))
     {
         printf("Should not dispatch event as the pc is higher than the event's label\n");
     }
@@ -300,7 +300,7 @@ bool EventDispatcher::dispatchEvent(PassRefPtr<Event> event)
     event->setEventPhase(Event::CAPTURING_PHASE);
 
     // IFC4BC - Run the policy first
-    JSC::JSLabel::eventContextLabel = JSC::JSLabel(1).getPair();
+    JSC::IFCContext::current().eventContextLabel = JSC::JSLabel(1).getPair();
     if (!m_ancestors[0].handleLocalEventsPolicy(event.get()))
     {
         size_t size = m_ancestors.size();
@@ -320,35 +320,35 @@ bool EventDispatcher::dispatchEvent(PassRefPtr<Event> event)
         goto doneDispatching;
 
     // IFC4BC - Setting specific user events.
-    JSC::JSLabel::eventNodeLabel = pathLabel.getPair();
-    // JSC::JSLabel::eventNodeLabel.ilabel = 0xffffffffffffffff;
+    JSC::IFCContext::current().eventNodeLabel = pathLabel.getPair();
+    // JSC::IFCContext::current().eventNodeLabel.ilabel = 0xffffffffffffffff;
     // The policy can specify User as the context, which means all the handlers should run in User context
     // If it is unchanged the policy did not specify a context, so run in user context for certain events
     
     // if (event->type() == eventNames().submitEvent) {    }
     
     
-    if ((JSC::JSLabel::eventContextLabel.clabel == 1) && //|| (JSC::JSLabel::eventContextLabel.clabel & 2) != 0) &&
+    if ((JSC::IFCContext::current().eventContextLabel.clabel == 1) && //|| (JSC::IFCContext::current().eventContextLabel.clabel & 2) != 0) &&
         (event->isUIEvent() || event->isMouseEvent() || event->isKeyboardEvent() ||
         event->isDragEvent() || event->isClipboardEvent()))
         // Context is 1, no policy or setContext was present
     {
-        JSC::JSLabel::eventNodeLabel = pathLabel.getPair();
+        JSC::IFCContext::current().eventNodeLabel = pathLabel.getPair();
         // Set the event label only for user events (2).
         // Set these to zero to indicate public visibility. We assume that the events are public by
         // default unless specified by the policy
-        // JSC::JSLabel::eventNodeLabel.clabel = 0;
-        // JSC::JSLabel::eventNodeLabel.ilabel = 0;
+        // JSC::IFCContext::current().eventNodeLabel.clabel = 0;
+        // JSC::IFCContext::current().eventNodeLabel.ilabel = 0;
     }
-    else if (JSC::JSLabel::eventContextLabel.clabel != 1){ // Context is not 1 -> setContext 
-        JSC::JSLabel::eventNodeLabel = pathLabel.Join(JSC::JSLabel::eventContextLabel).getPair();
-        // JSC::JSLabel::eventNodeLabel.ilabel = 0xffffffffffffffff;
+    else if (JSC::IFCContext::current().eventContextLabel.clabel != 1){ // Context is not 1 -> setContext 
+        JSC::IFCContext::current().eventNodeLabel = pathLabel.Join(JSC::IFCContext::current().eventContextLabel).getPair();
+        // JSC::IFCContext::current().eventNodeLabel.ilabel = 0xffffffffffffffff;
     }
     else { // Context is 1, no policy or setContext was present
-        JSC::JSLabel::eventNodeLabel = pathLabel.getPair();
-        // JSC::JSLabel::eventNodeLabel.ilabel = 0xffffffffffffffff;
+        JSC::IFCContext::current().eventNodeLabel = pathLabel.getPair();
+        // JSC::IFCContext::current().eventNodeLabel.ilabel = 0xffffffffffffffff;
     }
-    JSC::JSLabel::eventContextLabel = JSC::JSLabel(1).getPair();
+    JSC::IFCContext::current().eventContextLabel = JSC::JSLabel(1).getPair();
     ////////
     
     if (windowContext.handleLocalEvents(event.get()) && event->propagationStopped())
@@ -423,8 +423,8 @@ doneDispatching:
     }
 
     // IFC4BC
-    JSC::JSLabel::eventNodeLabel = JSC::JSLabel().getPair();
-    // JSC::JSLabel::eventNodeLabel.ilabel = 0xffffffffffffffff;
+    JSC::IFCContext::current().eventNodeLabel = JSC::JSLabel().getPair();
+    // JSC::IFCContext::current().eventNodeLabel.ilabel = 0xffffffffffffffff;
     ///////
 
 doneWithDefault:
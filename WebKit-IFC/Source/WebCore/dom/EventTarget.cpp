@@ -97,7 +97,7 @@ bool EventTarget::addEventListener(const AtomicString& eventType, PassRefPtr<Eve
     // IFC4BC - We can check here if the listener belongs to the same source URL as the node or not
     // Need to add a method in JSLazyEventListener to return the source URL of the listener.
     // IFC4BC - By default, all policy handlers are registered as capture phase handlers
-    if (JSC::JSLabel::pcGlobalLabel.clabel == 1)
+    if (JSC::IFCContext::current().pcGlobalLabel.clabel == 1)
         return d->eventPolicyMap.add(eventType, listener, true);
     else
         return d->eventListenerMap.add(eventType, listener, useCapture);
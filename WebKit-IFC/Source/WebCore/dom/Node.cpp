@@ -427,14 +427,14 @@ void Node::setDocument(Document* document)
         return;
     
     // IFC4BC - set the document label here
-    if (JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).NSU(getDocLabel()))
+    if (JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel).NSU(getDocLabel()))
     {
-        setDocLabel(JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).Join(JSC::JSLabel::argLabel[1]));
+        setDocLabel(JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel).Join(JSC::IFCContext::current().argumentLabel(0)));
     }
     else
     {
         // printf("IFC check in setDocument failed\n");
-        JSC::JSLabel::ABORT_FLAG = true;
+        JSC::IFCContext::current().abortFlag = true;
         // return;
     }
     m_document = document;
@@ -602,7 +602,7 @@ bool Node::insertBefore(PassRefPtr<Node> newChild, Node* refChild, ExceptionCode
         return false;
     }
     // IFC4BC - Havent added the label of refchild. Will this leak any information
-    // newChild->joinNodeLabel(JSC::JSLabel(JSC::JSLabel::argLabel[1]));
+    // newChild->joinNodeLabel(JSC::IFCContext::current().argumentLabel(0));
     return toContainerNode(this)->insertBefore(newChild, refChild, ec, shouldLazyAttach);
 }
 
@@ -2420,9 +2420,9 @@ bool Node::removeEventListener(const AtomicString& eventType, EventListener* lis
 {
     // IFC4BC - if the node on which the event occurred is not having same label as the label of the handler called
     // Then the handler is defined in some other script, which might be a security violation
-    if (!JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).NSU(this->getNodeLabel())) {
-        // printf("Aborting remove event listener (%lld,%lld)\n", JSC::JSLabel::pcGlobalLabel.clabel, JSC::JSLabel::pcGlobalLabel.plabel);
-        JSC::JSLabel::ABORT_FLAG = true;
+    if (!JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel).NSU(this->getNodeLabel())) {
+        // printf("Aborting remove event listener (%lld,%lld)\n", JSC::IFCContext::current().pcGlobalLabel.clabel, JSC::IFCContext::current().pcGlobalLabel.plabel);
+        JSC::IFCContext::current().abortFlag = true;
         // return false;
     }
     // IFC4BC -----------------------------------------------------------
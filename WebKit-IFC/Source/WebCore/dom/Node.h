@@ -265,27 +265,29 @@ public:
     
     // These low-level calls give the caller responsibility for maintaining the integrity of the tree.
     void setPreviousSibling(Node* previous) {
-        if (JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).NSU(getPrevSiblingLabel()))
+        JSC::IFCContext& ifcContext = JSC::IFCContext::current();
+        if (JSC::JSLabel(ifcContext.pcGlobalLabel).NSU(getPrevSiblingLabel()))
         {
-            setPrevSiblingLabel(JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).Join(JSC::JSLabel::argLabel[1]));
+            setPrevSiblingLabel(JSC::JSLabel(ifcContext.pcGlobalLabel).Join(ifcContext.argumentLabel(0)));
         }
         else
         {
             // printf("IFC check in setPrevSibling failed\n");
-            JSC::JSLabel::ABORT_FLAG = true;
+            ifcContext.abortFlag = true;
             // return;
         }
         m_previous = previous;
     }
     void setNextSibling(Node* next) {
-        if (JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).NSU(getNextSiblingLabel()))
+        JSC::IFCContext& ifcContext = JSC::IFCContext::current();
+        if (JSC::JSLabel(ifcContext.pcGlobalLabel).NSU(getNextSiblingLabel()))
         {
-            setNextSiblingLabel(JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).Join(JSC::JSLabel::argLabel[1]));
+            setNextSiblingLabel(JSC::JSLabel(ifcContext.pcGlobalLabel).Join(ifcContext.argumentLabel(0)));
         }
         else
         {
             // printf("IFC check in setNextSibling failed\n");
-            JSC::JSLabel::ABORT_FLAG = true;
+            ifcContext.abortFlag = true;
             // return;
         }
         m_next = next;
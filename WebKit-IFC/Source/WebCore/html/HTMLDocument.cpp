@@ -295,7 +295,7 @@ PassRefPtr<Element> HTMLDocument::createElement(const AtomicString& name, Except
     // IFC4BC - join the argument labels
     PassRefPtr<Element> element = HTMLElementFactory::createHTMLElement(
                                                     QualifiedName(nullAtom, name.lower(), xhtmlNamespaceURI), this, 0, false);
-    element->joinNodeLabel(JSC::JSLabel(JSC::JSLabel::argLabel[1]));
+    element->joinNodeLabel(JSC::IFCContext::current().argumentLabel(0));
     return element;
     
     // return HTMLElementFactory::createHTMLElement(QualifiedName(nullAtom, name.lower(), xhtmlNamespaceURI), this, 0, false);
@@ -124,7 +124,8 @@ void HTMLScriptElement::parseAttribute(const Attribute& attribute)
     else if (strcmp(attribute.localName().string().utf8().data(), "setContext")==0)
     {
         JSC::URLMap::urlmap().put(attribute.value().string().utf8().data(), 0);
-        JSC::JSLabel::pcGlobalLabel = JSC::URLMap::urlmap().getLabel(attribute.value().string().utf8().data()).getPair();
+        JSC::URLMap::urlmap().invalidateLabels();
+        JSC::IFCContext::current().pcGlobalLabel = JSC::URLMap::urlmap().getLabel(attribute.value().string().utf8().data()).getPair();
     }
     else
         HTMLElement::parseAttribute(attribute);
@@ -127,14 +127,14 @@ void DocumentWriter::begin(const KURL& urlReference, bool dispatch, Document* ow
 
     bool resetScripting = !(m_frame->loader()->stateMachine()->isDisplayingInitialEmptyDocument() && m_frame->document()->isSecureTransitionTo(url));
     // IFC4BC - Set the pcGlobalLabel to 0 for clearing
-    JSC::JSLabel::pair label = JSC::JSLabel::pcGlobalLabel;
-    JSC::JSLabel::pcGlobalLabel.clabel = 0;
-    // JSC::JSLabel::pcGlobalLabel.plabel = 0;
+    JSC::JSLabel::pair label = JSC::IFCContext::current().pcGlobalLabel;
+    JSC::IFCContext::current().pcGlobalLabel.clabel = 0;
+    // JSC::IFCContext::current().pcGlobalLabel.plabel = 0;
     // IFC4BC -----------------------------------------
     m_frame->loader()->clear(resetScripting, resetScripting);
     clear();
     // IFC4BC -----------------------------------------
-    JSC::JSLabel::pcGlobalLabel = label;
+    JSC::IFCContext::current().pcGlobalLabel = label;
     // IFC4BC -----------------------------------------
     if (resetScripting)
         m_frame->script()->updatePlatformScriptObjects();
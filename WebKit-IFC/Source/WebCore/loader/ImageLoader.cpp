@@ -171,17 +171,17 @@ void ImageLoader::updateFromElement()
         // printf("Request for an image: %s\n", sourceURI(attr).utf8().data());
         // TODO - USE NSU
         JSC::JSLabel urlLabel = JSC::JSLabel(JSC::URLMap::urlmap().getLabel(sourceURI(attr).utf8().data()));
-        JSC::JSLabel pcLabel = JSC::JSLabel(JSC::JSLabel::pcGlobalLabel);
-        JSC::JSLabel valLabel = JSC::JSLabel(JSC::JSLabel::argLabel[0]);
+        JSC::JSLabel pcLabel = JSC::JSLabel(JSC::IFCContext::current().pcGlobalLabel);
+        JSC::JSLabel valLabel = JSC::JSLabel(JSC::IFCContext::current().valueLabel);
         if (!(pcLabel.NSU(urlLabel)))
         {
             printf("IFC violation: Sending data on network in a high context\n");
-            JSC::JSLabel::ABORT_FLAG = true;
+            JSC::IFCContext::current().abortFlag = true;
         }
         if (!(valLabel.NSU(urlLabel)))
         {
             printf("IFC violation: Sending high data on network\n");
-            JSC::JSLabel::ABORT_FLAG = true;
+            JSC::IFCContext::current().abortFlag = true;
         }
         ResourceRequest request = ResourceRequest(document->completeURL(sourceURI(attr)));
 
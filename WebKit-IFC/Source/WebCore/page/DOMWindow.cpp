@@ -1003,8 +1003,8 @@ void DOMWindow::stop()
 void DOMWindow::alert(const String& message)
 {
     // IFC4BC - For now disabling alerts without policy permit
-    if (JSC::JSLabel::pcGlobalLabel.clabel != 0
-        /*|| JSC::JSLabel::pcGlobalLabel.plabel != 0*/)
+    if (JSC::IFCContext::current().pcGlobalLabel.clabel != 0
+        /*|| JSC::IFCContext::current().pcGlobalLabel.plabel != 0*/)
     {
         // printf("IFC violation! Alert user content\n");
         if (!m_frame)
@@ -1019,8 +1019,8 @@ void DOMWindow::alert(const String& message)
         return;
     }
     
-    if (JSC::JSLabel::argLabel[0].clabel != 0 ||
-        JSC::JSLabel::argLabel[1].clabel != 0 /*|| JSC::JSLabel::argLabel[0].plabel != 0*/)
+    if (JSC::IFCContext::current().thisLabel().Val() ||
+        JSC::IFCContext::current().argumentLabel(0).Val())
     {
         printf("IFC violation! Alert user content\n");
         if (!m_frame)
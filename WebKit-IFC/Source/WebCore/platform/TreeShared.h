@@ -99,15 +99,16 @@ public:
     void setParent(ParentNodeType* parent)
     { 
         ASSERT(isMainThread());
+        JSC::IFCContext& ifcContext = JSC::IFCContext::current();
         // Setting the parent's label to the context
-        if (JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).NSU(getParentLabel()))
+        if (JSC::JSLabel(ifcContext.pcGlobalLabel).NSU(getParentLabel()))
         {
-            setParentLabel(JSC::JSLabel(JSC::JSLabel::pcGlobalLabel).Join(JSC::JSLabel::argLabel[1]));
+            setParentLabel(JSC::JSLabel(ifcContext.pcGlobalLabel).Join(ifcContext.argumentLabel(0)));
         }
         else
         {
             // printf("IFC check in setParent failed\n");
-            JSC::JSLabel::ABORT_FLAG = true;
+            ifcContext.abortFlag = true;
             // return;
         }
         m_parent = parent;
@@ -65,6 +65,7 @@
 #include "TextIterator.h"
 #include "TextRun.h"
 #include "TreeScope.h"
+#include <JavaScriptCore/IFCStats.h>
 
 #if ENABLE(INPUT_TYPE_COLOR)
 #include "ColorChooser.h"
@@ -1138,6 +1139,16 @@ String Internals::counterValue(Element* element)
     return counterValueForElement(element);
 }
 
+String Internals::ifcStats() const
+{
+    return JSC::IFCStats::dump();
+}
+
+void Internals::resetIFCStats() const
+{
+    JSC::IFCStats::reset();
+}
+
 #if ENABLE(FULLSCREEN_API)
 void Internals::webkitWillEnterFullScreenForElement(Document* document, Element* element)
 {
@@ -185,6 +185,9 @@ public:
 
     String counterValue(Element*);
 
+    String ifcStats() const;
+    void resetIFCStats() const;
+
 #if ENABLE(FULLSCREEN_API)
     void webkitWillEnterFullScreenForElement(Document*, Element*);
     void webkitDidEnterFullScreenForElement(Document*, Element*);